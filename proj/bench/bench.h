@@ -0,0 +1,136 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       bench.h
+
+    \brief      Timing helpers shared by the hosted benchmark executables.
+
+    \details    Wall clock time is taken from CLOCK_MONOTONIC, cycles from the
+                time stamp counter on x86. On other architectures the cycle
+                count is not available and reported as 0.
+
+                Benchmarks print CSV to stdout, lines starting with '#' are
+                comments. Build with -DCMAKE_BUILD_TYPE=Release to get
+                meaningful numbers.
+*/
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_CYCLES 1
+#else
+#define BENCH_HAVE_CYCLES 0
+#endif
+
+/*!
+    \brief Measurement of a single benchmark run.
+*/
+typedef struct {
+    double seconds;     //!< Elapsed wall clock time
+    uint64_t cycles;    //!< Elapsed time stamp counter cycles, 0 if not available
+} bench_time_t;
+
+/*!
+    \brief Returns the monotonic wall clock time in seconds.
+*/
+static inline double bench_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/*!
+    \brief Returns the current time stamp counter, 0 if not available.
+*/
+static inline uint64_t bench_cycles(void)
+{
+#if BENCH_HAVE_CYCLES
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/*!
+    \brief Starts a measurement.
+*/
+static inline bench_time_t bench_start(void)
+{
+    bench_time_t start;
+    start.seconds = bench_seconds();
+    start.cycles = bench_cycles();
+    return start;
+}
+
+/*!
+    \brief Returns the time elapsed since `start`.
+*/
+static inline bench_time_t bench_stop(bench_time_t start)
+{
+    bench_time_t elapsed;
+    elapsed.cycles = bench_cycles() - start.cycles;
+    elapsed.seconds = bench_seconds() - start.seconds;
+    return elapsed;
+}
+
+/*!
+    \brief Fills a buffer with reproducible pseudo random bytes (xorshift32).
+*/
+static inline void bench_fill(uint8_t *data, size_t size, uint32_t seed)
+{
+    uint32_t state = seed ? seed : 0x9E3779B9UL;
+
+    while (size--)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        *data++ = (uint8_t)state;
+    }
+}
+
+/*!
+    \brief Sink for benchmark results, keeps the compiler from dropping the work.
+*/
+static volatile uint32_t bench_sink;
+
+#endif /* BENCH_H_ */
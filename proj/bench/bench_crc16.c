@@ -0,0 +1,303 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       bench_crc16.c
+
+    \brief      Throughput benchmark of all CRC16 algorithms and kernels.
+
+    \details    Times every algorithm of the crc16 catalogue with every kernel
+                available in this build for buffer sizes from 8 B up to 64 MiB
+                and prints one CSV line per measurement:
+
+                algorithm,kernel,size,iterations,cycles_per_byte,mb_per_s
+
+                Kernels:
+                - generic: `crc16()`, parameters loaded from the runtime table
+                - specialized: `crc16_<name>()`, parameters baked in as constants
+                - parallel: `crc16_parallel()`, only if `CRC16_ENABLE_PARALLEL`
+
+                Usage: bench_crc16 [max_size [min_seconds]]
+
+                max_size limits the largest buffer (default 64 MiB), min_seconds
+                the minimum measuring time per line (default 0.05 s).
+*/
+
+#include "bench.h"
+#include <string.h>
+#include "crc16.h"
+
+#define BENCH_CRC16_MIN_SIZE 8
+#define BENCH_CRC16_MAX_SIZE (64UL*1024*1024)
+
+/* large enough for crc16_parallel() to split into unequal chunks */
+#define BENCH_CRC16_CHECK_SIZE (4UL*CRC16_PARALLEL_MIN_CHUNK + 3)
+
+typedef uint16_t (*bench_crc16_specialized_t)(const uint8_t *data, size_t size);
+
+/* same order as crc16_id_t */
+static const bench_crc16_specialized_t bench_crc16_specialized[] = {
+#if defined(CRC16_ENABLE_ARC) || defined(UNITTEST)
+    crc16_arc,
+#endif
+#if defined(CRC16_ENABLE_CDMA2000) || defined(UNITTEST)
+    crc16_cdma2000,
+#endif
+#if defined(CRC16_ENABLE_CMS) || defined(UNITTEST)
+    crc16_cms,
+#endif
+#if defined(CRC16_ENABLE_DDS_110) || defined(UNITTEST)
+    crc16_dds_110,
+#endif
+#if defined(CRC16_ENABLE_DECT_R) || defined(UNITTEST)
+    crc16_dect_r,
+#endif
+#if defined(CRC16_ENABLE_DECT_X) || defined(UNITTEST)
+    crc16_dect_x,
+#endif
+#if defined(CRC16_ENABLE_DNP) || defined(UNITTEST)
+    crc16_dnp,
+#endif
+#if defined(CRC16_ENABLE_EN_13757) || defined(UNITTEST)
+    crc16_en_13757,
+#endif
+#if defined(CRC16_ENABLE_GENIBUS) || defined(UNITTEST)
+    crc16_genibus,
+#endif
+#if defined(CRC16_ENABLE_GSM) || defined(UNITTEST)
+    crc16_gsm,
+#endif
+#if defined(CRC16_ENABLE_IBM_3740) || defined(UNITTEST)
+    crc16_ibm_3740,
+#endif
+#if defined(CRC16_ENABLE_IBM_SDLC) || defined(UNITTEST)
+    crc16_ibm_sdlc,
+#endif
+#if defined(CRC16_ENABLE_ISO_IEC_14443_3_A) || defined(UNITTEST)
+    crc16_iso_iec_14443_3_a,
+#endif
+#if defined(CRC16_ENABLE_KERMIT) || defined(UNITTEST)
+    crc16_kermit,
+#endif
+#if defined(CRC16_ENABLE_LJ1200) || defined(UNITTEST)
+    crc16_lj1200,
+#endif
+#if defined(CRC16_ENABLE_M17) || defined(UNITTEST)
+    crc16_m17,
+#endif
+#if defined(CRC16_ENABLE_MAXIM_DOW) || defined(UNITTEST)
+    crc16_maxim_dow,
+#endif
+#if defined(CRC16_ENABLE_MCRF4XX) || defined(UNITTEST)
+    crc16_mcrf4xx,
+#endif
+#if defined(CRC16_ENABLE_MODBUS) || defined(UNITTEST)
+    crc16_modbus,
+#endif
+#if defined(CRC16_ENABLE_NRSC_5) || defined(UNITTEST)
+    crc16_nrsc_5,
+#endif
+#if defined(CRC16_ENABLE_OPENSAFETY_A) || defined(UNITTEST)
+    crc16_opensafety_a,
+#endif
+#if defined(CRC16_ENABLE_OPENSAFETY_B) || defined(UNITTEST)
+    crc16_opensafety_b,
+#endif
+#if defined(CRC16_ENABLE_PROFIBUS) || defined(UNITTEST)
+    crc16_profibus,
+#endif
+#if defined(CRC16_ENABLE_RIELLO) || defined(UNITTEST)
+    crc16_riello,
+#endif
+#if defined(CRC16_ENABLE_SPI_FUJITSU) || defined(UNITTEST)
+    crc16_spi_fujitsu,
+#endif
+#if defined(CRC16_ENABLE_T10_DIF) || defined(UNITTEST)
+    crc16_t10_dif,
+#endif
+#if defined(CRC16_ENABLE_TELEDISK) || defined(UNITTEST)
+    crc16_teledisk,
+#endif
+#if defined(CRC16_ENABLE_TMS37157) || defined(UNITTEST)
+    crc16_tms37157,
+#endif
+#if defined(CRC16_ENABLE_UMTS) || defined(UNITTEST)
+    crc16_umts,
+#endif
+#if defined(CRC16_ENABLE_USB) || defined(UNITTEST)
+    crc16_usb,
+#endif
+#if defined(CRC16_ENABLE_XMODEM) || defined(UNITTEST)
+    crc16_xmodem,
+#endif
+};
+
+typedef enum {
+    BENCH_CRC16_GENERIC,
+    BENCH_CRC16_SPECIALIZED,
+#if defined(CRC16_ENABLE_PARALLEL)
+    BENCH_CRC16_PARALLEL,
+#endif
+    BENCH_CRC16_KERNELS
+} bench_crc16_kernel_t;
+
+static const char *bench_crc16_kernel_names[] = {
+    "generic",
+    "specialized",
+#if defined(CRC16_ENABLE_PARALLEL)
+    "parallel",
+#endif
+};
+
+static uint16_t bench_crc16_run(bench_crc16_kernel_t kernel, crc16_id_t id, uint8_t *data, size_t size)
+{
+    switch (kernel)
+    {
+        case BENCH_CRC16_SPECIALIZED:
+            return bench_crc16_specialized[id](data, size);
+#if defined(CRC16_ENABLE_PARALLEL)
+        case BENCH_CRC16_PARALLEL:
+            return crc16_parallel(id, data, size, 0);
+#endif
+        default:
+            return crc16(id, data, size);
+    }
+}
+
+static void bench_crc16_print_name(crc16_id_t id)
+{
+#ifdef UNITTEST
+    printf("%s", crc16_get_conf(id)->text);
+#else
+    printf("%d", (int)id);
+#endif
+}
+
+int main(int argc, char *argv[])
+{
+    size_t max_size = BENCH_CRC16_MAX_SIZE;
+    size_t data_size;
+    double min_seconds = 0.05;
+    uint8_t *data;
+    int id;
+    int kernel;
+    size_t size;
+
+    if (argc > 1)
+    {
+        max_size = (size_t)strtoull(argv[1], NULL, 0);
+    }
+
+    if (argc > 2)
+    {
+        min_seconds = strtod(argv[2], NULL);
+    }
+
+    if (max_size < BENCH_CRC16_MIN_SIZE)
+    {
+        max_size = BENCH_CRC16_MIN_SIZE;
+    }
+
+    data_size = max_size > BENCH_CRC16_CHECK_SIZE ? max_size : BENCH_CRC16_CHECK_SIZE;
+    data = malloc(data_size);
+
+    if (!data)
+    {
+        fprintf(stderr, "bench_crc16: cannot allocate %zu bytes\n", data_size);
+        return EXIT_FAILURE;
+    }
+
+    bench_fill(data, data_size, 0);
+
+    if (sizeof(bench_crc16_specialized)/sizeof(*bench_crc16_specialized) != (size_t)crc16_conf_count())
+    {
+        fprintf(stderr, "bench_crc16: specialized kernel table out of sync with crc16_conf[]\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("# crc16 throughput, cycles %s\n", BENCH_HAVE_CYCLES ? "from time stamp counter" : "not available");
+    printf("algorithm,kernel,size,iterations,cycles_per_byte,mb_per_s\n");
+
+    for (id = 0; id < crc16_conf_count(); id++)
+    {
+        for (kernel = 0; kernel < BENCH_CRC16_KERNELS; kernel++)
+        {
+            /* every kernel has to agree with the generic one, on a short buffer and on one split into chunks */
+            if (bench_crc16_run(kernel, id, data, BENCH_CRC16_MIN_SIZE) != crc16(id, data, BENCH_CRC16_MIN_SIZE) ||
+                bench_crc16_run(kernel, id, data, BENCH_CRC16_CHECK_SIZE) != crc16(id, data, BENCH_CRC16_CHECK_SIZE)
+#if defined(CRC16_ENABLE_PARALLEL)
+                || (kernel == BENCH_CRC16_PARALLEL && crc16_parallel(id, data, BENCH_CRC16_CHECK_SIZE, 4) != crc16(id, data, BENCH_CRC16_CHECK_SIZE))
+#endif
+                )
+            {
+                fprintf(stderr, "bench_crc16: kernel %s computes wrong results\n", bench_crc16_kernel_names[kernel]);
+                return EXIT_FAILURE;
+            }
+
+            /* 8 B, 64 B, 512 B, ... doubling by 8, the last step ends exactly at max_size */
+            for (size = BENCH_CRC16_MIN_SIZE; size <= max_size; size = (size == max_size) ? max_size + 1 : (size * 8 > max_size ? max_size : size * 8))
+            {
+                bench_time_t start, elapsed;
+                unsigned long iterations = 0;
+                unsigned long batch = 1;
+                double bytes;
+
+                start = bench_start();
+
+                do
+                {
+                    unsigned long n;
+
+                    for (n = 0; n < batch; n++)
+                    {
+                        bench_sink += bench_crc16_run(kernel, id, data, size);
+                    }
+
+                    iterations += batch;
+                    batch *= 2;
+                    elapsed = bench_stop(start);
+
+                } while (elapsed.seconds < min_seconds);
+
+                bytes = (double)size * (double)iterations;
+
+                bench_crc16_print_name(id);
+                printf(",%s,%zu,%lu,%.3f,%.1f\n",
+                       bench_crc16_kernel_names[kernel],
+                       size,
+                       iterations,
+                       (double)elapsed.cycles / bytes,
+                       bytes / elapsed.seconds / 1e6);
+            }
+        }
+    }
+
+    free(data);
+
+    return EXIT_SUCCESS;
+}
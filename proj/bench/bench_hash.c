@@ -0,0 +1,443 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       bench_hash.c
+
+    \brief      Quality and throughput harness for the hash module.
+
+    \details    Runs every hash function of hash.h through four tests and
+                prints one CSV table per test.
+
+                Throughput for key lengths from 4 B to 64 KiB:
+
+                hash,size,iterations,cycles_per_byte,ns_per_hash,mb_per_s
+
+                Bucket distribution of three key sets: sequential 32 bit
+                integers, short strings "key<n>" and 12 byte session tuples
+                (addresses and ports, only the client port and address
+                counting). Tables are power of two sized and indexed by
+                masking the low bits, or prime sized and indexed modulo.
+                chi2_per_dof is the chi-square statistic divided by the degrees
+                of freedom. Values around 1.0 are what a random function gives,
+                values far below mean sequential keys are spread almost without
+                collisions, values far above mean clustering:
+
+                hash,keys,key_count,table,buckets,chi2_per_dof,max_load
+
+                Avalanche and bit independence over random keys of 4 to 64
+                bytes. Every input bit is flipped for every sample key.
+                avalanche_mean is the mean probability of an output bit to
+                flip (ideal 0.5), avalanche_bias the largest deviation of a
+                single input/output bit pair from 0.5. bic_max is the largest
+                absolute correlation between the flips of two output bits for
+                the same input bit (ideal 0). Random noise alone gives values
+                of several times 1/sqrt(samples) for both maxima:
+
+                hash,key_size,samples,avalanche_mean,avalanche_bias,bic_max
+
+                xxh64 is reduced to its low 32 bits for all quality tests.
+
+                Usage: bench_hash [min_seconds [key_count [samples]]]
+
+                min_seconds is the minimum measuring time per throughput line
+                (default 0.05 s), key_count the number of keys of the
+                distribution test (default 1048576), samples the number of
+                random keys of the avalanche test (default 2000).
+*/
+
+#include "bench.h"
+#include <math.h>
+#include <string.h>
+#include "hash.h"
+
+#define BENCH_HASH_MAX_SIZE (64UL*1024)
+#define BENCH_HASH_MAX_KEY  64
+#define BENCH_HASH_BITS     32
+
+#if defined(UINT64_MAX)
+static uint32_t bench_hash_xxh64(uint32_t seed, void *data, size_t size)
+{
+    return (uint32_t)hash_xxh64(seed, data, size);
+}
+#endif
+
+typedef struct {
+    const char *name;
+    hash_func_t func;
+    uint32_t seed;
+} bench_hash_t;
+
+static const bench_hash_t bench_hashes[] = {
+    {"sdbm",    hash_sdbm,    0},
+    {"fnv1a",   hash_fnv1a,   HASH_FNV1A_INIT},
+    {"murmur3", hash_murmur3, 0},
+    {"xxh32",   hash_xxh32,   0},
+#if defined(UINT64_MAX)
+    {"xxh64",   bench_hash_xxh64, 0},
+#endif
+};
+
+#define BENCH_HASH_COUNT (sizeof(bench_hashes)/sizeof(*bench_hashes))
+
+static const size_t bench_hash_sizes[] = {4, 8, 16, 32, 64, 256, 4096, BENCH_HASH_MAX_SIZE};
+
+static const size_t bench_hash_key_sizes[] = {4, 8, 16, BENCH_HASH_MAX_KEY};
+
+typedef enum {
+    BENCH_HASH_KEYS_INT,
+    BENCH_HASH_KEYS_STRING,
+    BENCH_HASH_KEYS_TUPLE,
+    BENCH_HASH_KEY_SETS
+} bench_hash_keys_t;
+
+static const char *bench_hash_key_names[] = {"int", "string", "tuple"};
+
+static void bench_hash_throughput(const bench_hash_t *hash, uint8_t *data, double min_seconds)
+{
+    size_t idx;
+
+    for (idx = 0; idx < sizeof(bench_hash_sizes)/sizeof(*bench_hash_sizes); idx++)
+    {
+        size_t size = bench_hash_sizes[idx];
+        bench_time_t start, elapsed;
+        unsigned long iterations = 0;
+        unsigned long batch = 1;
+        double bytes;
+
+        start = bench_start();
+
+        do
+        {
+            unsigned long n;
+
+            for (n = 0; n < batch; n++)
+            {
+                /* chain the results, short keys are latency bound in a table lookup */
+                bench_sink = hash->func(hash->seed ^ bench_sink, data, size);
+            }
+
+            iterations += batch;
+            batch *= 2;
+            elapsed = bench_stop(start);
+
+        } while (elapsed.seconds < min_seconds);
+
+        bytes = (double)size * (double)iterations;
+
+        printf("%s,%zu,%lu,%.3f,%.2f,%.1f\n",
+               hash->name,
+               size,
+               iterations,
+               (double)elapsed.cycles / bytes,
+               elapsed.seconds * 1e9 / (double)iterations,
+               bytes / elapsed.seconds / 1e6);
+    }
+}
+
+static void bench_hash_put32(uint8_t *buffer, uint32_t value)
+{
+    buffer[0] = (uint8_t)value;
+    buffer[1] = (uint8_t)(value >> 8);
+    buffer[2] = (uint8_t)(value >> 16);
+    buffer[3] = (uint8_t)(value >> 24);
+}
+
+static uint32_t bench_hash_key(const bench_hash_t *hash, bench_hash_keys_t keys, uint32_t n)
+{
+    uint8_t buffer[16];
+    size_t size;
+
+    switch (keys)
+    {
+        case BENCH_HASH_KEYS_INT:
+            bench_hash_put32(buffer, n);
+            size = 4;
+            break;
+
+        case BENCH_HASH_KEYS_TUPLE:
+            /* client 10.0.x.x:port to server 192.168.0.1:443, 16 ports per client */
+            bench_hash_put32(buffer, 0x0A000000UL | (n >> 4));
+            bench_hash_put32(buffer + 4, 0xC0A80001UL);
+            buffer[8] = (uint8_t)(49152U >> 8);
+            buffer[9] = (uint8_t)(n & 15);
+            buffer[10] = (uint8_t)(443 >> 8);
+            buffer[11] = (uint8_t)443;
+            size = 12;
+            break;
+
+        default:
+            size = (size_t)sprintf((char*)buffer, "key%lu", (unsigned long)n);
+            break;
+    }
+
+    return hash->func(hash->seed, buffer, size);
+}
+
+/* largest prime not above limit, trial division is fast enough for table sizes */
+static unsigned long bench_hash_prime_below(unsigned long limit)
+{
+    unsigned long candidate;
+
+    for (candidate = limit; candidate > 2; candidate--)
+    {
+        unsigned long divisor;
+
+        for (divisor = 2; divisor * divisor <= candidate; divisor++)
+        {
+            if (candidate % divisor == 0)
+            {
+                break;
+            }
+        }
+
+        if (divisor * divisor > candidate)
+        {
+            return candidate;
+        }
+    }
+
+    return 2;
+}
+
+static void bench_hash_distribution(const bench_hash_t *hash, unsigned long key_count, unsigned long *buckets)
+{
+    int keys;
+    int prime;
+    unsigned long size;
+
+    for (keys = 0; keys < BENCH_HASH_KEY_SETS; keys++)
+    {
+        for (prime = 0; prime < 2; prime++)
+        {
+            /* from 16 keys per bucket down to 1/4 key per bucket */
+            for (size = key_count / 16; size && size <= key_count * 4; size *= 4)
+            {
+                unsigned long bucket_count = prime ? bench_hash_prime_below(size) : size;
+                unsigned long n;
+                unsigned long max_load = 0;
+                double expected = (double)key_count / (double)bucket_count;
+                double chi2 = 0;
+
+                memset(buckets, 0, bucket_count * sizeof(*buckets));
+
+                for (n = 0; n < key_count; n++)
+                {
+                    uint32_t value = bench_hash_key(hash, keys, (uint32_t)n);
+                    buckets[prime ? value % bucket_count : value & (bucket_count - 1)]++;
+                }
+
+                for (n = 0; n < bucket_count; n++)
+                {
+                    double diff = (double)buckets[n] - expected;
+                    chi2 += diff * diff / expected;
+
+                    if (buckets[n] > max_load)
+                    {
+                        max_load = buckets[n];
+                    }
+                }
+
+                printf("%s,%s,%lu,%s,%lu,%.3f,%lu\n",
+                       hash->name,
+                       bench_hash_key_names[keys],
+                       key_count,
+                       prime ? "prime" : "pow2",
+                       bucket_count,
+                       bucket_count > 1 ? chi2 / (double)(bucket_count - 1) : 0.0,
+                       max_load);
+            }
+        }
+    }
+}
+
+/*
+    Strict avalanche criterion and bit independence criterion. For every
+    input bit the flips of all output bits are counted, and for every pair
+    of output bits how often both flip together.
+*/
+static void bench_hash_avalanche(const bench_hash_t *hash, size_t key_size, unsigned long samples)
+{
+    static unsigned long flips[BENCH_HASH_BITS];
+    static unsigned long pairs[BENCH_HASH_BITS][BENCH_HASH_BITS];
+    uint8_t key[BENCH_HASH_MAX_KEY];
+    double mean = 0;
+    double bias = 0;
+    double bic = 0;
+    size_t bit;
+
+    for (bit = 0; bit < key_size * 8; bit++)
+    {
+        unsigned long sample;
+        int j, k;
+
+        memset(flips, 0, sizeof(flips));
+        memset(pairs, 0, sizeof(pairs));
+
+        for (sample = 0; sample < samples; sample++)
+        {
+            uint32_t base, diff;
+
+            bench_fill(key, key_size, (uint32_t)(sample * 0x9E3779B9UL + 1));
+            base = hash->func(hash->seed, key, key_size);
+            key[bit / 8] ^= (uint8_t)(1U << (bit % 8));
+            diff = base ^ hash->func(hash->seed, key, key_size);
+
+            for (j = 0; j < BENCH_HASH_BITS; j++)
+            {
+                if (diff & ((uint32_t)1 << j))
+                {
+                    flips[j]++;
+
+                    for (k = j + 1; k < BENCH_HASH_BITS; k++)
+                    {
+                        if (diff & ((uint32_t)1 << k))
+                        {
+                            pairs[j][k]++;
+                        }
+                    }
+                }
+            }
+        }
+
+        for (j = 0; j < BENCH_HASH_BITS; j++)
+        {
+            double pj = (double)flips[j] / (double)samples;
+
+            mean += pj;
+
+            if (fabs(pj - 0.5) > bias)
+            {
+                bias = fabs(pj - 0.5);
+            }
+
+            for (k = j + 1; k < BENCH_HASH_BITS; k++)
+            {
+                double pk = (double)flips[k] / (double)samples;
+                double pjk = (double)pairs[j][k] / (double)samples;
+                double var = pj * (1 - pj) * pk * (1 - pk);
+                /* an output bit that never or always flips is fully dependent */
+                double corr = var > 0 ? (pjk - pj * pk) / sqrt(var) : 1.0;
+
+                if (fabs(corr) > bic)
+                {
+                    bic = fabs(corr);
+                }
+            }
+        }
+    }
+
+    mean /= (double)(key_size * 8 * BENCH_HASH_BITS);
+
+    printf("%s,%zu,%lu,%.4f,%.4f,%.4f\n", hash->name, key_size, samples, mean, bias, bic);
+}
+
+int main(int argc, char *argv[])
+{
+    double min_seconds = 0.05;
+    unsigned long key_count = 1UL << 20;
+    unsigned long samples = 2000;
+    unsigned long *buckets;
+    uint8_t *data;
+    size_t idx;
+    size_t size;
+
+    if (argc > 1)
+    {
+        min_seconds = strtod(argv[1], NULL);
+    }
+
+    if (argc > 2)
+    {
+        key_count = strtoul(argv[2], NULL, 0);
+    }
+
+    if (argc > 3)
+    {
+        samples = strtoul(argv[3], NULL, 0);
+    }
+
+    /* power of two, the tables are indexed by masking */
+    while (key_count & (key_count - 1))
+    {
+        key_count &= key_count - 1;
+    }
+
+    if (key_count < 16)
+    {
+        key_count = 16;
+    }
+
+    if (samples < 1)
+    {
+        samples = 1;
+    }
+
+    data = malloc(BENCH_HASH_MAX_SIZE);
+    buckets = malloc(key_count * 4 * sizeof(*buckets));
+
+    if (!data || !buckets)
+    {
+        fprintf(stderr, "bench_hash: out of memory\n");
+        return EXIT_FAILURE;
+    }
+
+    bench_fill(data, BENCH_HASH_MAX_SIZE, 0);
+
+    printf("# hash throughput, cycles %s\n", BENCH_HAVE_CYCLES ? "from time stamp counter" : "not available");
+    printf("hash,size,iterations,cycles_per_byte,ns_per_hash,mb_per_s\n");
+
+    for (idx = 0; idx < BENCH_HASH_COUNT; idx++)
+    {
+        bench_hash_throughput(&bench_hashes[idx], data, min_seconds);
+    }
+
+    printf("# hash bucket distribution, pow2 tables are indexed by the low bits, prime tables modulo\n");
+    printf("hash,keys,key_count,table,buckets,chi2_per_dof,max_load\n");
+
+    for (idx = 0; idx < BENCH_HASH_COUNT; idx++)
+    {
+        bench_hash_distribution(&bench_hashes[idx], key_count, buckets);
+    }
+
+    printf("# hash avalanche and bit independence, noise level about %.4f\n", 1.0 / sqrt((double)samples));
+    printf("hash,key_size,samples,avalanche_mean,avalanche_bias,bic_max\n");
+
+    for (idx = 0; idx < BENCH_HASH_COUNT; idx++)
+    {
+        for (size = 0; size < sizeof(bench_hash_key_sizes)/sizeof(*bench_hash_key_sizes); size++)
+        {
+            bench_hash_avalanche(&bench_hashes[idx], bench_hash_key_sizes[size], samples);
+        }
+    }
+
+    free(buckets);
+    free(data);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,277 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       bench_hashmap.c
+
+    \brief      Chained hash map versus open addressing hash map.
+
+    \details    Fills the chained map of hashmap.h and the open addressing map
+                of swissmap.h with 1K to 10M entries of random 64 bit keys and
+                times, per operation:
+
+                - insert: all keys, the chained map has one bucket per entry
+                  allocated up front, the open addressing map starts empty
+                  and grows
+                - hit: looks up all keys in scattered order
+                - miss: looks up as many keys which are not present
+                - erase: removes all keys in scattered order
+
+                Both maps hash the keys with hash_xxh32(). Output is one CSV
+                line per map and entry count:
+
+                map,entries,insert_ns,hit_ns,miss_ns,erase_ns,bytes_per_entry
+
+                Usage: bench_hashmap [max_entries]
+
+                max_entries limits the largest fill (default 10000000).
+*/
+
+#include "bench.h"
+#include <string.h>
+#include "hash.h"
+#include "hashmap.h"
+#include "swissmap.h"
+
+#define BENCH_HASHMAP_MIN_ENTRIES 1000UL
+#define BENCH_HASHMAP_MAX_ENTRIES 10000000UL
+
+typedef struct {
+    hashmap_node_t node;
+    uint64_t key;
+    uint64_t value;
+} bench_chained_entry_t;
+
+typedef struct {
+    uint64_t key;
+    uint64_t value;
+} bench_flat_entry_t;
+
+/* multiplication by an odd constant is a bijection, so the keys are distinct */
+static uint64_t bench_hashmap_key(unsigned long n)
+{
+    return ((uint64_t)n + 1) * 0x9E3779B97F4A7C15ULL;
+}
+
+/*
+    Hits and erases visit the keys in a scattered order, otherwise the
+    chained map would walk its entry array sequentially. 2654435761 is
+    prime and therefore coprime to the entry counts.
+*/
+static unsigned long bench_hashmap_scatter(unsigned long n, unsigned long entries)
+{
+    return (unsigned long)(((uint64_t)n * 2654435761ULL) % entries);
+}
+
+static uint32_t bench_hashmap_hash(const void *key)
+{
+    return hash_xxh32(0, (void*)key, sizeof(uint64_t));
+}
+
+static bool bench_hashmap_chained_equal(const hashmap_node_t *node, const void *key)
+{
+    return container_of(node, bench_chained_entry_t, node)->key == *(const uint64_t*)key;
+}
+
+static void bench_hashmap_print(const char *name, unsigned long entries, double *seconds, size_t bytes)
+{
+    printf("%s,%lu,%.1f,%.1f,%.1f,%.1f,%.1f\n",
+           name,
+           entries,
+           seconds[0] * 1e9 / (double)entries,
+           seconds[1] * 1e9 / (double)entries,
+           seconds[2] * 1e9 / (double)entries,
+           seconds[3] * 1e9 / (double)entries,
+           (double)bytes / (double)entries);
+}
+
+static bool bench_hashmap_chained(unsigned long entries)
+{
+    size_t buckets = 1;
+    hashmap_t map;
+    slist_t *bucket_array;
+    bench_chained_entry_t *entry_array;
+    double seconds[4];
+    bench_time_t start;
+    unsigned long n;
+    uint64_t key;
+
+    while (buckets < entries)
+    {
+        buckets *= 2;
+    }
+
+    bucket_array = malloc(buckets * sizeof(*bucket_array));
+    entry_array = malloc(entries * sizeof(*entry_array));
+
+    if (!bucket_array || !entry_array)
+    {
+        free(bucket_array);
+        free(entry_array);
+        return false;
+    }
+
+    hashmap_init(&map, bucket_array, buckets, bench_hashmap_hash, bench_hashmap_chained_equal);
+
+    start = bench_start();
+
+    for (n = 0; n < entries; n++)
+    {
+        entry_array[n].key = bench_hashmap_key(n);
+        entry_array[n].value = n;
+        hashmap_insert(&map, &entry_array[n].node, &entry_array[n].key);
+    }
+
+    seconds[0] = bench_stop(start).seconds;
+    start = bench_start();
+
+    for (n = 0; n < entries; n++)
+    {
+        key = bench_hashmap_key(bench_hashmap_scatter(n, entries));
+        bench_sink += (uint32_t)container_of(hashmap_find(&map, &key), bench_chained_entry_t, node)->value;
+    }
+
+    seconds[1] = bench_stop(start).seconds;
+    start = bench_start();
+
+    for (n = 0; n < entries; n++)
+    {
+        key = bench_hashmap_key(n + entries);
+        bench_sink += hashmap_find(&map, &key) != NULL;
+    }
+
+    seconds[2] = bench_stop(start).seconds;
+    start = bench_start();
+
+    for (n = 0; n < entries; n++)
+    {
+        key = bench_hashmap_key(bench_hashmap_scatter(n, entries));
+        bench_sink += hashmap_remove(&map, &key) != NULL;
+    }
+
+    seconds[3] = bench_stop(start).seconds;
+
+    bench_hashmap_print("chained", entries, seconds, buckets * sizeof(*bucket_array) + entries * sizeof(*entry_array));
+
+    free(bucket_array);
+    free(entry_array);
+
+    return true;
+}
+
+static bool bench_hashmap_swiss(unsigned long entries)
+{
+    swissmap_t map;
+    double seconds[4];
+    bench_time_t start;
+    unsigned long n;
+    uint64_t key;
+    size_t bytes;
+
+    swissmap_init(&map, sizeof(bench_flat_entry_t), offsetof(bench_flat_entry_t, key), sizeof(uint64_t),
+                  bench_hashmap_hash, NULL);
+
+    start = bench_start();
+
+    for (n = 0; n < entries; n++)
+    {
+        bench_flat_entry_t *entry;
+
+        key = bench_hashmap_key(n);
+        entry = swissmap_insert(&map, &key, NULL);
+
+        if (!entry)
+        {
+            swissmap_free(&map);
+            return false;
+        }
+
+        entry->value = n;
+    }
+
+    seconds[0] = bench_stop(start).seconds;
+    bytes = map.groups * SWISSMAP_GROUP_SIZE * (sizeof(bench_flat_entry_t) + 1) + map.groups;
+    start = bench_start();
+
+    for (n = 0; n < entries; n++)
+    {
+        key = bench_hashmap_key(bench_hashmap_scatter(n, entries));
+        bench_sink += (uint32_t)((bench_flat_entry_t*)swissmap_find(&map, &key))->value;
+    }
+
+    seconds[1] = bench_stop(start).seconds;
+    start = bench_start();
+
+    for (n = 0; n < entries; n++)
+    {
+        key = bench_hashmap_key(n + entries);
+        bench_sink += swissmap_find(&map, &key) != NULL;
+    }
+
+    seconds[2] = bench_stop(start).seconds;
+    start = bench_start();
+
+    for (n = 0; n < entries; n++)
+    {
+        key = bench_hashmap_key(bench_hashmap_scatter(n, entries));
+        bench_sink += swissmap_remove(&map, &key);
+    }
+
+    seconds[3] = bench_stop(start).seconds;
+
+    bench_hashmap_print("swiss", entries, seconds, bytes);
+
+    swissmap_free(&map);
+
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned long max_entries = BENCH_HASHMAP_MAX_ENTRIES;
+    unsigned long entries;
+
+    if (argc > 1)
+    {
+        max_entries = strtoul(argv[1], NULL, 0);
+    }
+
+    printf("# chained versus open addressing hash map, nanoseconds per operation\n");
+    printf("map,entries,insert_ns,hit_ns,miss_ns,erase_ns,bytes_per_entry\n");
+
+    for (entries = BENCH_HASHMAP_MIN_ENTRIES; entries <= max_entries; entries *= 10)
+    {
+        if (!bench_hashmap_chained(entries) || !bench_hashmap_swiss(entries))
+        {
+            fprintf(stderr, "bench_hashmap: out of memory at %lu entries\n", entries);
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
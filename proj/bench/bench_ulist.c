@@ -0,0 +1,332 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       bench_ulist.c
+
+    \brief      Unrolled list versus doubly linked list and flat buffer.
+
+    \details    Holds 1K to 100K records of 8 bytes in the unrolled list of
+                ulist.h, in a dlist of nodes embedded into the records and in
+                a BUFFER_T array, and times:
+
+                - append: appends all records one by one
+                - iterate: sums a field of all records, repeated so that about
+                  10M records are visited
+                - insert: one pass over the records inserting a new one
+                  after every 64th, per inserted record including the walk
+
+                The dlist nodes are linked in a scattered order, as a list
+                of long lived records ends up after churn. The unrolled list
+                holds 16 records per chunk. Output is one CSV line per
+                container and record count:
+
+                container,items,append_ns,iterate_ns,insert_ns,bytes_per_item
+
+                Usage: bench_ulist [max_items]
+
+                max_items limits the largest fill (default and maximum 100000).
+*/
+
+#include "bench.h"
+#include <string.h>
+#include "buffer.h"
+#include "dlist.h"
+#include "ulist.h"
+
+#define BENCH_ULIST_MIN_ITEMS 1000UL
+#define BENCH_ULIST_MAX_ITEMS 100000UL
+#define BENCH_ULIST_VISITS 10000000UL
+#define BENCH_ULIST_INSERT_STRIDE 64
+#define BENCH_ULIST_CAPACITY 16
+
+typedef struct {
+    uint32_t key;
+    uint32_t value;
+} bench_record_t;
+
+typedef struct {
+    dlist_node_t node;
+    bench_record_t record;
+} bench_dlist_record_t;
+
+BUFFER_TYPEDEF(bench_records,bench_record_t,BENCH_ULIST_MAX_ITEMS + BENCH_ULIST_MAX_ITEMS / BENCH_ULIST_INSERT_STRIDE + 1);
+ULIST_TYPEDEF(bench_records,bench_record_t,BENCH_ULIST_CAPACITY,1);
+
+static BUFFER_T(bench_records) bench_buffer;
+
+/* 2654435761 is prime and therefore coprime to the item counts */
+static unsigned long bench_ulist_scatter(unsigned long n, unsigned long items)
+{
+    return (unsigned long)(((uint64_t)n * 2654435761ULL) % items);
+}
+
+static bench_record_t bench_ulist_record(unsigned long n)
+{
+    bench_record_t record;
+
+    record.key = (uint32_t)n;
+    record.value = (uint32_t)(n * 3);
+
+    return record;
+}
+
+static unsigned long bench_ulist_passes(unsigned long items)
+{
+    return items < BENCH_ULIST_VISITS ? BENCH_ULIST_VISITS / items : 1;
+}
+
+static void bench_ulist_print(const char *name, unsigned long items, double *seconds, size_t bytes)
+{
+    printf("%s,%lu,%.2f,%.2f,%.1f,%.1f\n",
+           name,
+           items,
+           seconds[0] * 1e9 / (double)items,
+           seconds[1] * 1e9 / (double)(items * bench_ulist_passes(items)),
+           seconds[2] * 1e9 / (double)(items / BENCH_ULIST_INSERT_STRIDE),
+           (double)bytes / (double)items);
+}
+
+static bool bench_ulist_dlist(unsigned long items)
+{
+    unsigned long inserts = items / BENCH_ULIST_INSERT_STRIDE;
+    bench_dlist_record_t *records = malloc((items + inserts) * sizeof(*records));
+    dlist_t list;
+    dlist_node_t *iterator;
+    double seconds[3];
+    bench_time_t start;
+    unsigned long n;
+    unsigned long pass;
+    uint32_t sum = 0;
+
+    if (!records)
+    {
+        return false;
+    }
+
+    for (n = 0; n < items + inserts; n++)
+    {
+        records[n].record = bench_ulist_record(n);
+    }
+
+    dlist_init(&list);
+    start = bench_start();
+
+    for (n = 0; n < items; n++)
+    {
+        dlist_push_back(&list, &records[bench_ulist_scatter(n, items)].node);
+    }
+
+    seconds[0] = bench_stop(start).seconds;
+    start = bench_start();
+
+    for (pass = bench_ulist_passes(items); pass; pass--)
+    {
+        dlist_foreach(&list, iterator)
+        {
+            sum += container_of(iterator, bench_dlist_record_t, node)->record.value;
+        }
+    }
+
+    seconds[1] = bench_stop(start).seconds;
+    n = 0;
+    start = bench_start();
+
+    dlist_foreach(&list, iterator)
+    {
+        if (++n % BENCH_ULIST_INSERT_STRIDE == 0)
+        {
+            dlist_insert_after(&list, iterator, &records[items + n / BENCH_ULIST_INSERT_STRIDE - 1].node);
+            iterator = dlist_next(&list, iterator);
+        }
+    }
+
+    seconds[2] = bench_stop(start).seconds;
+
+    bench_ulist_print("dlist", items, seconds, items * sizeof(*records));
+    bench_sink += sum;
+    free(records);
+
+    return true;
+}
+
+static bool bench_ulist_buffer(unsigned long items)
+{
+    unsigned long inserts = 0;
+    bench_record_t *record;
+    bench_record_t *end;
+    double seconds[3];
+    bench_time_t start;
+    unsigned long n;
+    unsigned long pass;
+    uint32_t sum = 0;
+
+    BUFFER_INIT(bench_buffer);
+    start = bench_start();
+
+    for (n = 0; n < items; n++)
+    {
+        BUFFER_APPEND(bench_buffer, bench_ulist_record(n));
+    }
+
+    seconds[0] = bench_stop(start).seconds;
+    start = bench_start();
+
+    for (pass = bench_ulist_passes(items); pass; pass--)
+    {
+        BUFFER_FOREACH(bench_buffer, record)
+        {
+            sum += record->value;
+        }
+    }
+
+    seconds[1] = bench_stop(start).seconds;
+    start = bench_start();
+
+    /* every insert moves the whole tail of the array */
+    for (n = BENCH_ULIST_INSERT_STRIDE; n <= items; n += BENCH_ULIST_INSERT_STRIDE)
+    {
+        record = &BUFFER_ITEMS(bench_buffer)[n + inserts];
+        end = BUFFER_PTR(bench_buffer);
+        memmove(record + 1, record, (size_t)(end - record) * sizeof(*record));
+        *record = bench_ulist_record(items + inserts);
+        BUFFER_NEXT(bench_buffer);
+        inserts++;
+    }
+
+    seconds[2] = bench_stop(start).seconds;
+
+    bench_ulist_print("buffer", items, seconds, items * sizeof(bench_record_t));
+    bench_sink += sum;
+
+    return true;
+}
+
+static bool bench_ulist_ulist(unsigned long items)
+{
+    unsigned long inserts = items / BENCH_ULIST_INSERT_STRIDE;
+    size_t chunks = (items + inserts) / BENCH_ULIST_CAPACITY * 2 + 2;
+    bench_records_ulist_chunk_t *pool = malloc(chunks * sizeof(*pool));
+    uint8_t *status = malloc(chunks);
+    ulist_t list;
+    ulist_iterator_t iterator;
+    bench_record_t record;
+    size_t bytes;
+    double seconds[3];
+    bench_time_t start;
+    unsigned long n;
+    unsigned long pass;
+    uint32_t sum = 0;
+
+    if (!pool || !status)
+    {
+        free(pool);
+        free(status);
+        return false;
+    }
+
+    ulist_init(&list, (uint8_t*)pool, status, sizeof(*pool), chunks, sizeof(bench_record_t),
+               offsetof(bench_records_ulist_chunk_t, items), BENCH_ULIST_CAPACITY);
+
+    start = bench_start();
+
+    for (n = 0; n < items; n++)
+    {
+        record = bench_ulist_record(n);
+        ulist_push_back(&list, &record);
+    }
+
+    seconds[0] = bench_stop(start).seconds;
+    bytes = dlist_size(&list.chunks) * sizeof(*pool);
+    start = bench_start();
+
+    for (pass = bench_ulist_passes(items); pass; pass--)
+    {
+        ulist_foreach(&list, iterator)
+        {
+            sum += ((bench_record_t*)ulist_item(&list, iterator))->value;
+        }
+    }
+
+    seconds[1] = bench_stop(start).seconds;
+    n = 0;
+    start = bench_start();
+
+    ulist_foreach(&list, iterator)
+    {
+        if (++n % BENCH_ULIST_INSERT_STRIDE == 0)
+        {
+            ulist_next(&list, iterator);
+            record = bench_ulist_record(items + n / BENCH_ULIST_INSERT_STRIDE - 1);
+
+            if (!ulist_insert(&list, &iterator, &record))
+            {
+                break;
+            }
+        }
+    }
+
+    seconds[2] = bench_stop(start).seconds;
+
+    bench_ulist_print("ulist", items, seconds, bytes);
+    bench_sink += sum;
+    free(pool);
+    free(status);
+
+    return ulist_size(&list) == items + inserts;
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned long max_items = BENCH_ULIST_MAX_ITEMS;
+    unsigned long items;
+
+    if (argc > 1)
+    {
+        max_items = strtoul(argv[1], NULL, 0);
+    }
+
+    if (max_items > BENCH_ULIST_MAX_ITEMS)
+    {
+        max_items = BENCH_ULIST_MAX_ITEMS;
+    }
+
+    printf("# unrolled list versus dlist and flat buffer, nanoseconds per record\n");
+    printf("container,items,append_ns,iterate_ns,insert_ns,bytes_per_item\n");
+
+    for (items = BENCH_ULIST_MIN_ITEMS; items <= max_items; items *= 10)
+    {
+        if (!bench_ulist_dlist(items) || !bench_ulist_buffer(items) || !bench_ulist_ulist(items))
+        {
+            fprintf(stderr, "bench_ulist: failed at %lu items\n", items);
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,253 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file bheap.h
+
+    \brief Generic binary heap (priority queue) implementation.
+
+    \details This file contains a generic implementation of a binary min heap
+    stored in a fixed size array, using preprocessor macros in the same way as
+    buffer.h and ringbuffer.h. Items are copied into the heap by value.
+
+    A binary heap is a complete binary tree kept in an array: the children of
+    the item at index i are at 2i+1 and 2i+2. No item orders before its parent,
+    so the smallest item is always at index 0. Reading it is O(1), pushing and
+    popping move an item along one path of the tree and are O(log n).
+    [Wikipedia - Binary heap](https://en.wikipedia.org/wiki/Binary_heap)
+
+    The ordering is given by a `less(a,b)` argument to the modifying macros,
+    either a function or a function like macro that is passed two items and
+    is true if `a` orders before `b`. Passing a greater-than comparison turns
+    the heap into a max heap.
+
+    Usage:
+    \code
+    typedef struct {
+        uint32_t deadline;
+        uint8_t id;
+    } event_t;
+
+    #define event_less(a,b) ((a).deadline < (b).deadline)
+
+    BHEAP_TYPEDEF(events,event_t,16);
+    BHEAP_T(events) events;
+
+    BHEAP_INIT(events);
+
+    if (!BHEAP_FULL(events))
+    {
+        BHEAP_PUSH(events,event,event_less);
+    }
+
+    while (!BHEAP_EMPTY(events) && BHEAP_TOP_PTR(events)->deadline <= now)
+    {
+        dispatch(BHEAP_TOP_PTR(events));
+        BHEAP_POP(events,event_less);
+    }
+    \endcode
+
+    For nodes that have to change their priority while queued, such as
+    rescheduled timers, see the intrusive pairing heap in pheap.h.
+*/
+
+#ifndef BHEAP_H_
+#define BHEAP_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*!
+    \brief Declares a binary heap type.
+
+    \details Creates a struct holding the current number of items, one scratch
+    item used while moving items and the item array.
+
+    \param name The unique identification name for the heap type. The actual type will be `name##_bheap_t`.
+    \param type The data type of the items that the heap will hold.
+    \param size The number of items of \a type that the heap can hold.
+*/
+#define BHEAP_TYPEDEF(name,type,size)   \
+    typedef struct {                    \
+        size_t count;                   \
+        type scratch;                   \
+        type items [size];              \
+    } name##_bheap_t
+
+/*!
+    \brief Defines a heap variable of a type declared with `BHEAP_TYPEDEF`.
+
+    \param name The unique identification name of the heap type, as used in `BHEAP_TYPEDEF`.
+*/
+#define BHEAP_T(name) \
+    name##_bheap_t
+
+/*!
+    \brief Retrieves the items array of a heap, in heap order.
+
+    \param heap The heap instance.
+*/
+#define BHEAP_ITEMS(heap) \
+    ((heap).items)
+
+/*!
+    \brief Retrieves the scratch item of a heap.
+
+    \details Used internally by `BHEAP_PUSH` and `BHEAP_POP`.
+
+    \param heap The heap instance.
+*/
+#define BHEAP_SCRATCH(heap) \
+    ((heap).scratch)
+
+/*!
+    \brief Returns the maximum number of items the heap can hold.
+
+    \param heap The heap instance.
+*/
+#define BHEAP_SIZE(heap) \
+    (sizeof(BHEAP_ITEMS(heap))/sizeof(BHEAP_ITEMS(heap)[0]))
+
+/*!
+    \brief Returns the current number of items in the heap.
+
+    \param heap The heap instance.
+*/
+#define BHEAP_COUNT(heap) \
+    ((heap).count)
+
+/*!
+    \brief Initializes the heap to be empty.
+
+    \param heap The heap instance.
+*/
+#define BHEAP_INIT(heap) \
+    do{ \
+        BHEAP_COUNT(heap) = 0; \
+    }while(0)
+
+/*!
+    \brief Checks if the heap is empty.
+
+    \param heap The heap instance.
+*/
+#define BHEAP_EMPTY(heap) \
+    (!BHEAP_COUNT(heap))
+
+/*!
+    \brief Checks if the heap is full.
+
+    \details Pushing into a full heap writes past the item array, check this
+    before `BHEAP_PUSH`.
+
+    \param heap The heap instance.
+*/
+#define BHEAP_FULL(heap) \
+    (BHEAP_COUNT(heap)>=BHEAP_SIZE(heap))
+
+/*!
+    \brief Returns a reference to the smallest item in O(1).
+
+    \param heap The heap instance, must not be empty.
+*/
+#define BHEAP_TOP_VAL(heap) \
+    (BHEAP_ITEMS(heap)[0])
+
+/*!
+    \brief Returns a pointer to the smallest item in O(1).
+
+    \details The item may be read or changed in place as long as its ordering
+    is not changed.
+
+    \param heap The heap instance, must not be empty.
+*/
+#define BHEAP_TOP_PTR(heap) \
+    (&BHEAP_TOP_VAL(heap))
+
+/*!
+    \brief Adds an item to the heap. O(log n).
+
+    \details The item moves up from the end of the array while it orders before
+    its parent, the parents move down into the hole it leaves.
+
+    \param heap The heap instance, must not be full.
+    \param value The item to add.
+    \param less Ordering of two items, see the file description.
+*/
+#define BHEAP_PUSH(heap,value,less)                                                             \
+    do {                                                                                        \
+        size_t bheap_idx_ = BHEAP_COUNT(heap)++;                                                \
+        BHEAP_SCRATCH(heap) = (value);                                                          \
+                                                                                                \
+        while (bheap_idx_ > 0 && less(BHEAP_SCRATCH(heap),BHEAP_ITEMS(heap)[(bheap_idx_-1)/2])) \
+        {                                                                                       \
+            BHEAP_ITEMS(heap)[bheap_idx_] = BHEAP_ITEMS(heap)[(bheap_idx_-1)/2];                \
+            bheap_idx_ = (bheap_idx_-1)/2;                                                      \
+        }                                                                                       \
+                                                                                                \
+        BHEAP_ITEMS(heap)[bheap_idx_] = BHEAP_SCRATCH(heap);                                    \
+    }while(0)
+
+/*!
+    \brief Removes the smallest item from the heap. O(log n).
+
+    \details The last item of the array moves down from the top while one of its
+    children orders before it, the smaller child moves up into the hole.
+    Read the item with `BHEAP_TOP_VAL` or `BHEAP_TOP_PTR` before.
+
+    \param heap The heap instance, must not be empty.
+    \param less Ordering of two items, see the file description.
+*/
+#define BHEAP_POP(heap,less)                                                                    \
+    do {                                                                                        \
+        size_t bheap_idx_ = 0;                                                                  \
+        size_t bheap_child_;                                                                    \
+        size_t bheap_count_ = --BHEAP_COUNT(heap);                                              \
+        BHEAP_SCRATCH(heap) = BHEAP_ITEMS(heap)[bheap_count_];                                  \
+                                                                                                \
+        while ((bheap_child_ = 2*bheap_idx_+1) < bheap_count_)                                  \
+        {                                                                                       \
+            if (bheap_child_+1 < bheap_count_ &&                                                \
+                less(BHEAP_ITEMS(heap)[bheap_child_+1],BHEAP_ITEMS(heap)[bheap_child_]))        \
+            {                                                                                   \
+                bheap_child_++;                                                                 \
+            }                                                                                   \
+                                                                                                \
+            if (!less(BHEAP_ITEMS(heap)[bheap_child_],BHEAP_SCRATCH(heap)))                     \
+            {                                                                                   \
+                break;                                                                          \
+            }                                                                                   \
+                                                                                                \
+            BHEAP_ITEMS(heap)[bheap_idx_] = BHEAP_ITEMS(heap)[bheap_child_];                    \
+            bheap_idx_ = bheap_child_;                                                          \
+        }                                                                                       \
+                                                                                                \
+        BHEAP_ITEMS(heap)[bheap_idx_] = BHEAP_SCRATCH(heap);                                    \
+    }while(0)
+
+#endif /* BHEAP_H_ */
@@ -137,4 +137,38 @@ typedef uint8_t bitarray_t;
     do{if((value) == 0){BITARRAY_RESET(name,bit);}else{BITARRAY_SET(name,bit);}}while(0)
 
 
+/*!
+ \brief Sets a specific bit to 1 in a bit array given by pointer.
+ \details Counterpart of `BITARRAY_SET` for functions working on bit arrays of
+          any size, the bit index may exceed the range of `unsigned`.
+
+ \param array Pointer to the first byte of the bit array.
+ \param bit The index of the bit to set (0-based).
+*/
+#define bitarray_set(array,bit) \
+    ((array)[((uint32_t)(bit))>>3] |= (bitarray_t)(1<<(((unsigned)(bit))&0x07)))
+
+/*!
+ \brief Resets a specific bit to 0 in a bit array given by pointer.
+ \details Counterpart of `BITARRAY_RESET`, see `bitarray_set`.
+
+ \param array Pointer to the first byte of the bit array.
+ \param bit The index of the bit to reset (0-based).
+*/
+#define bitarray_reset(array,bit) \
+    ((array)[((uint32_t)(bit))>>3] &= (bitarray_t)~(1<<(((unsigned)(bit))&0x07)))
+
+/*!
+ \brief Gets the value of a specific bit in a bit array given by pointer.
+ \details Counterpart of `BITARRAY_GET`, see `bitarray_set`.
+
+ \param array Pointer to the first byte of the bit array.
+ \param bit The index of the bit to get (0-based).
+
+ \return 1 if the bit is set, 0 otherwise.
+*/
+#define bitarray_get(array,bit) \
+    ((unsigned)(((array)[((uint32_t)(bit))>>3] >> (((unsigned)(bit))&0x07)) & 1))
+
+
 #endif /* BITARRAY_H_ */
@@ -0,0 +1,72 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       bits.c
+
+    \brief      Bitwise operations.
+
+    \details    see header file
+*/
+
+#include "bits.h"
+
+/*
+    The mantissa x is normalized into [1,2) as Q15. Each squaring doubles its
+    logarithm, an overflow past 2 yields the next one bit of the fraction.
+*/
+uint32_t bits_log2_q16(uint32_t x)
+{
+    uint32_t result = 15UL << 16;
+    uint32_t bit;
+
+    while (x >= 0x10000UL)
+    {
+        x >>= 1;
+        result += 0x10000UL;
+    }
+
+    while (x < 0x8000UL)
+    {
+        x <<= 1;
+        result -= 0x10000UL;
+    }
+
+    for (bit = 0x8000UL; bit; bit >>= 1)
+    {
+        x = (x * x) >> 15;
+
+        if (x >= 0x10000UL)
+        {
+            x >>= 1;
+            result += bit;
+        }
+    }
+
+    return result;
+}
@@ -41,6 +41,8 @@
 #ifndef BITS_H_
 #define BITS_H_
 
+#include <stdint.h>
+
 /*!
     \brief Extract specific bits from an integer.
 
@@ -129,4 +131,18 @@
 */
 #define BITS_TOGGLE(x,m)    ((x)^=(m))
 
+/*!
+    \brief Computes the base 2 logarithm of an integer in Q16 fixed point.
+
+    \details The integer part is the position of the highest set bit, the
+             fraction is found bit by bit by squaring the normalized Q15
+             mantissa. Needs neither floating point nor a 64 bit multiply,
+             the fraction is truncated and low by at most 8 units of 2^-16.
+
+    \param x The integer, at least 1.
+
+    \return log2(x) scaled by 65536.
+*/
+uint32_t bits_log2_q16(uint32_t x);
+
 #endif /* BITS_H_ */
@@ -0,0 +1,257 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       bloom.c
+
+    \brief      Bloom filter
+
+    \details    see header file
+*/
+#include <string.h>
+#include "bloom.h"
+#include "hash.h"
+#include "bits.h"
+
+#define BLOOM_SEED          0x9747B28CUL
+#define BLOOM_PPM           1000000UL
+
+/* log2(1000000) in Q16 */
+#define BLOOM_LOG2_MILLION  1306235UL
+
+/* second hash for double hashing, the murmur3 finalizer applied to h1 */
+static uint32_t bloom_remix(uint32_t hash)
+{
+    hash ^= 0x5BD1E995UL;
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6BUL;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35UL;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+void bloom_init(bloom_t *bloom, bitarray_t *bits, uint32_t size, uint8_t hashes)
+{
+    bloom->bits = bits;
+    bloom->size = size;
+    bloom->hashes = hashes;
+    bloom_clear(bloom);
+}
+
+void bloom_clear(bloom_t *bloom)
+{
+    memset(bloom->bits, 0x00, (size_t)((bloom->size + 7) >> 3));
+}
+
+/*
+    Walks the k positions h1 + i*h2 mod m. Both start values are reduced once,
+    afterwards a conditional subtraction keeps the position below m, which
+    avoids a 32 bit division per probe. Sizes that are a power of two are
+    reduced by masking. Returns false as soon as a probed bit is not set,
+    when testing only.
+*/
+static bool bloom_probe(bloom_t *bloom, void *key, size_t size, bool add)
+{
+    uint32_t h1 = hash_murmur3(BLOOM_SEED, key, size);
+    uint32_t h2 = bloom_remix(h1);
+    uint32_t m = bloom->size;
+    uint8_t k = bloom->hashes;
+
+    if ((m & (m - 1)) == 0)
+    {
+        h2 |= 1; /* odd steps visit distinct bits */
+
+        while (k--)
+        {
+            h1 &= m - 1;
+
+            if (add)
+            {
+                bitarray_set(bloom->bits, h1);
+            }
+            else if (!bitarray_get(bloom->bits, h1))
+            {
+                return false;
+            }
+
+            h1 += h2;
+        }
+
+        return true;
+    }
+
+    h1 %= m;
+    h2 %= m;
+
+    if (h2 == 0)
+    {
+        h2 = 1;
+    }
+
+    while (k--)
+    {
+        if (add)
+        {
+            bitarray_set(bloom->bits, h1);
+        }
+        else if (!bitarray_get(bloom->bits, h1))
+        {
+            return false;
+        }
+
+        h1 += h2;
+
+        if (h1 >= m)
+        {
+            h1 -= m;
+        }
+    }
+
+    return true;
+}
+
+void bloom_add(bloom_t *bloom, void *key, size_t size)
+{
+    bloom_probe(bloom, key, size, true);
+}
+
+bool bloom_contains(bloom_t *bloom, void *key, size_t size)
+{
+    return bloom_probe(bloom, key, size, false);
+}
+
+/* log2(1/p) in Q16 for a rate given in parts per million */
+static uint32_t bloom_log2_inverse(uint32_t fp_ppm)
+{
+    if (fp_ppm == 0)
+    {
+        fp_ppm = 1;
+    }
+
+    if (fp_ppm >= BLOOM_PPM)
+    {
+        fp_ppm = BLOOM_PPM - 1;
+    }
+
+    return BLOOM_LOG2_MILLION - bits_log2_q16(fp_ppm);
+}
+
+uint32_t bloom_size_for(uint32_t keys, uint32_t fp_ppm)
+{
+    /* bits per key as Q8, log2(1/p)/ln(2) with 1/ln(2) ~ 2955/2048 rounded up */
+    uint32_t per_key = ((bloom_log2_inverse(fp_ppm) * 2955UL) >> 11 >> 8) + 1;
+    uint32_t high = keys >> 8;
+    uint32_t bits;
+
+    if (high > (0x7FFFFFF8UL - per_key) / per_key)
+    {
+        return 0x7FFFFFF8UL;
+    }
+
+    bits = high * per_key + (((keys & 0xFF) * per_key + 0xFF) >> 8);
+
+    return (bits + 7) & ~7UL;
+}
+
+uint8_t bloom_hashes_for(uint32_t fp_ppm)
+{
+    uint32_t hashes = (bloom_log2_inverse(fp_ppm) + 0x8000UL) >> 16;
+
+    return (uint8_t)(hashes ? hashes : 1);
+}
+
+#if defined(BLOOM_ENABLE_BLOCKED) && defined(UINT64_MAX)
+
+void bloom_blocked_init(bloom_blocked_t *bloom, uint64_t *words, uint32_t blocks, uint8_t hashes)
+{
+    bloom->words = words;
+    bloom->blocks = blocks;
+    bloom->hashes = hashes;
+    bloom_blocked_clear(bloom);
+}
+
+void bloom_blocked_clear(bloom_blocked_t *bloom)
+{
+    memset(bloom->words, 0x00, (size_t)bloom->blocks * BLOOM_BLOCK_WORDS * sizeof(uint64_t));
+}
+
+/*
+    The high half of a single 64 bit hash picks the block by multiply and
+    shift instead of a division, the low half drives double hashing of the
+    bit positions within the 512 bit block.
+*/
+static uint64_t* bloom_blocked_block(bloom_blocked_t *bloom, uint64_t hash)
+{
+    return &bloom->words[((hash >> 32) * bloom->blocks >> 32) * BLOOM_BLOCK_WORDS];
+}
+
+void bloom_blocked_add(bloom_blocked_t *bloom, void *key, size_t size)
+{
+    uint64_t hash = hash_xxh64(BLOOM_SEED, key, size);
+    uint64_t *block = bloom_blocked_block(bloom, hash);
+    uint32_t h1 = (uint32_t)hash;
+    uint32_t h2 = (h1 >> 16) | 1;
+    uint8_t k;
+
+    for (k = bloom->hashes; k; k--)
+    {
+        block[(h1 >> 6) & 0x07] |= (uint64_t)1 << (h1 & 0x3F);
+        h1 += h2;
+    }
+}
+
+bool bloom_blocked_contains(bloom_blocked_t *bloom, void *key, size_t size)
+{
+    uint64_t hash = hash_xxh64(BLOOM_SEED, key, size);
+    uint64_t *block = bloom_blocked_block(bloom, hash);
+    uint32_t h1 = (uint32_t)hash;
+    uint32_t h2 = (h1 >> 16) | 1;
+    uint64_t miss = 0;
+    uint8_t k;
+
+    /* no early exit, the block is in cache and the loop stays branch free */
+    for (k = bloom->hashes; k; k--)
+    {
+        miss |= ~block[(h1 >> 6) & 0x07] & ((uint64_t)1 << (h1 & 0x3F));
+        h1 += h2;
+    }
+
+    return miss == 0;
+}
+
+uint32_t bloom_blocked_blocks_for(uint32_t keys, uint32_t fp_ppm)
+{
+    uint32_t bits = bloom_size_for(keys, fp_ppm);
+
+    bits += bits >> 3;
+
+    return (bits + 511) >> 9;
+}
+
+#endif /* BLOOM_ENABLE_BLOCKED */
@@ -0,0 +1,304 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       bloom.h
+
+    \brief      Bloom filter
+
+    \details    A Bloom filter answers "definitely not present" or "probably
+                present" for a key using a fixed number of bits, independent
+                of the key size. Adding a key sets k bits, a lookup checks the
+                same k bits. Keys cannot be removed.
+
+                The k bit positions are derived by double hashing: the key is
+                hashed once with `hash_murmur3` to h1, h2 is a remix of h1, and
+                the positions h1 + i*h2 modulo the filter size for i = 0..k-1
+                perform like k independent hashes. Only keys with the same 32
+                bit hash share all positions, so for filters below 2^31 bits the
+                single hash adds no measurable false positives.
+
+                Sizing: for n keys and a false positive rate p the filter needs
+                m = -n*ln(p)/ln(2)^2 bits (about 9.6 bits per key for 1%) and
+                k = log2(1/p) hashes. `BLOOM_BITS_FOR` computes the size at
+                compile time for rates of 2^-r, `bloom_size_for` at runtime for
+                rates in parts per million.
+
+                The blocked variant (hosted builds, `BLOOM_ENABLE_BLOCKED`) keeps
+                all k bits of a key within one 512 bit block, so a lookup
+                touches a single cache line. It needs about 1/8 more bits for
+                the same false positive rate, see `bloom_blocked_blocks_for`.
+*/
+
+#ifndef BLOOM_H_
+#define BLOOM_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "bitarray.h"
+
+/*!
+    \brief      Bloom filter control structure.
+*/
+typedef struct {
+    bitarray_t *bits;       //!< Filter bits
+    uint32_t size;          //!< Number of filter bits, m
+    uint8_t hashes;         //!< Number of bits per key, k
+} bloom_t;
+
+/*!
+    \brief      Defines a new Bloom filter type with a fixed number of bits.
+
+    \param name     The base name of the new type, the type is `name##_bloom_t`.
+    \param size     The number of filter bits, a multiple of 8.
+*/
+#define BLOOM_TYPEDEF(name,size) \
+    typedef struct { \
+        bloom_t bloom; \
+        BITARRAY(filter,size); \
+    }name##_bloom_t
+
+/*!
+    \brief      Names a Bloom filter type defined with `BLOOM_TYPEDEF`.
+
+    \param name     The base name as specified in `BLOOM_TYPEDEF`.
+*/
+#define BLOOM_T(name) \
+    name##_bloom_t
+
+/*!
+    \brief      Returns a pointer to the control structure of a Bloom filter
+                instance, plain or blocked.
+
+    \param bf       The variable of a type defined with `BLOOM_TYPEDEF`.
+*/
+#define BLOOM(bf) \
+    (&(bf).bloom)
+
+/*!
+    \brief      Initializes a Bloom filter instance to be empty.
+
+    \param bf       The variable of a type defined with `BLOOM_TYPEDEF`.
+    \param hashes   The number of bits per key, see `BLOOM_HASHES_FOR`.
+*/
+#define BLOOM_INIT(bf,hashes) \
+    bloom_init(BLOOM(bf),(bf).filter_bitarray,(uint32_t)BITARRAY_SIZE((bf).filter),hashes)
+
+/*!
+    \brief      Number of filter bits for a number of keys at a false positive
+                rate of 2^-fp_log2, a constant expression.
+
+    \details    Bits per key are fp_log2/ln(2), approximated from above by
+                fp_log2*2955/2048. The result is rounded up to a multiple of 8,
+                keys*fp_log2 must stay below 4 million.
+
+    \param keys     Number of keys the filter shall hold.
+    \param fp_log2  Negative base 2 logarithm of the false positive rate,
+                    7 for about 1%, 10 for about 0.1%.
+*/
+#define BLOOM_BITS_FOR(keys,fp_log2) \
+    (((uint32_t)(keys) * (fp_log2) + ((uint32_t)(keys) * (fp_log2) * 907UL + 2047) / 2048 + 7) & ~7UL)
+
+/*!
+    \brief      Optimal number of bits per key for a false positive rate of
+                2^-fp_log2, a constant expression.
+
+    \param fp_log2  Negative base 2 logarithm of the false positive rate.
+*/
+#define BLOOM_HASHES_FOR(fp_log2) \
+    ((uint8_t)(fp_log2))
+
+/*!
+    \brief      Initializes a Bloom filter on a bit array.
+
+    \param bloom    Pointer to the Bloom filter control structure.
+    \param bits     Bit array of `size` bits.
+    \param size     Number of filter bits, at least 8 and below 2^31.
+    \param hashes   Number of bits per key, at least 1.
+*/
+void bloom_init(bloom_t *bloom, bitarray_t *bits, uint32_t size, uint8_t hashes);
+
+/*!
+    \brief      Removes all keys from a Bloom filter.
+
+    \param bloom    Pointer to the Bloom filter control structure.
+*/
+void bloom_clear(bloom_t *bloom);
+
+/*!
+    \brief      Adds a key to a Bloom filter.
+
+    \param bloom    Pointer to the Bloom filter control structure.
+    \param key      Pointer to the key bytes.
+    \param size     Size of the key in bytes.
+*/
+void bloom_add(bloom_t *bloom, void *key, size_t size);
+
+/*!
+    \brief      Checks whether a key may have been added to a Bloom filter.
+
+    \param bloom    Pointer to the Bloom filter control structure.
+    \param key      Pointer to the key bytes.
+    \param size     Size of the key in bytes.
+
+    \return     False if the key has definitely not been added, true if it
+                probably has.
+*/
+bool bloom_contains(bloom_t *bloom, void *key, size_t size);
+
+/*!
+    \brief      Number of filter bits for a number of keys and a false positive rate.
+
+    \details    Computed in fixed point arithmetic, no floating point support
+                is needed. The result is rounded up to a multiple of 8.
+
+    \param keys     Number of keys the filter shall hold.
+    \param fp_ppm   False positive rate in parts per million, 10000 for 1%.
+
+    \return     The number of filter bits.
+*/
+uint32_t bloom_size_for(uint32_t keys, uint32_t fp_ppm);
+
+/*!
+    \brief      Optimal number of bits per key for a false positive rate.
+
+    \param fp_ppm   False positive rate in parts per million, 10000 for 1%.
+
+    \return     The number of bits per key, log2(1/p) rounded.
+*/
+uint8_t bloom_hashes_for(uint32_t fp_ppm);
+
+#if (defined(BLOOM_ENABLE_BLOCKED) && defined(UINT64_MAX)) || defined(DOXYGEN)
+
+/*!
+    \brief      Number of 64 bit words of a block of the blocked variant.
+*/
+#define BLOOM_BLOCK_WORDS 8
+
+#if defined(__GNUC__)
+#define BLOOM_BLOCK_ALIGNED __attribute__((aligned(64)))
+#else
+#define BLOOM_BLOCK_ALIGNED
+#endif
+
+/*!
+    \brief      Blocked Bloom filter control structure.
+*/
+typedef struct {
+    uint64_t *words;        //!< Filter blocks, BLOOM_BLOCK_WORDS words each
+    uint32_t blocks;        //!< Number of blocks
+    uint8_t hashes;         //!< Number of bits per key, k
+} bloom_blocked_t;
+
+/*!
+    \brief      Defines a new blocked Bloom filter type with a fixed number of
+                blocks, aligned to cache lines on gcc and clang.
+
+    \param name     The base name of the new type, the type is `name##_bloom_blocked_t`.
+    \param blocks   The number of 512 bit blocks.
+*/
+#define BLOOM_BLOCKED_TYPEDEF(name,blocks) \
+    typedef struct { \
+        bloom_blocked_t bloom; \
+        uint64_t words[(blocks)*BLOOM_BLOCK_WORDS] BLOOM_BLOCK_ALIGNED; \
+    }name##_bloom_blocked_t
+
+/*!
+    \brief      Names a blocked Bloom filter type defined with `BLOOM_BLOCKED_TYPEDEF`.
+
+    \param name     The base name as specified in `BLOOM_BLOCKED_TYPEDEF`.
+*/
+#define BLOOM_BLOCKED_T(name) \
+    name##_bloom_blocked_t
+
+/*!
+    \brief      Initializes a blocked Bloom filter instance to be empty.
+
+    \param bf       The variable of a type defined with `BLOOM_BLOCKED_TYPEDEF`.
+    \param hashes   The number of bits per key.
+*/
+#define BLOOM_BLOCKED_INIT(bf,hashes) \
+    bloom_blocked_init(BLOOM(bf),(bf).words, \
+                       (uint32_t)(sizeof((bf).words)/sizeof(*(bf).words)/BLOOM_BLOCK_WORDS),hashes)
+
+/*!
+    \brief      Initializes a blocked Bloom filter on an array of blocks.
+
+    \param bloom    Pointer to the blocked Bloom filter control structure.
+    \param words    Array of `blocks` * `BLOOM_BLOCK_WORDS` words, ideally
+                    aligned to 64 bytes.
+    \param blocks   Number of blocks, at least one.
+    \param hashes   Number of bits per key, at least 1.
+*/
+void bloom_blocked_init(bloom_blocked_t *bloom, uint64_t *words, uint32_t blocks, uint8_t hashes);
+
+/*!
+    \brief      Removes all keys from a blocked Bloom filter.
+
+    \param bloom    Pointer to the blocked Bloom filter control structure.
+*/
+void bloom_blocked_clear(bloom_blocked_t *bloom);
+
+/*!
+    \brief      Adds a key to a blocked Bloom filter.
+
+    \param bloom    Pointer to the blocked Bloom filter control structure.
+    \param key      Pointer to the key bytes.
+    \param size     Size of the key in bytes.
+*/
+void bloom_blocked_add(bloom_blocked_t *bloom, void *key, size_t size);
+
+/*!
+    \brief      Checks whether a key may have been added to a blocked Bloom filter.
+
+    \param bloom    Pointer to the blocked Bloom filter control structure.
+    \param key      Pointer to the key bytes.
+    \param size     Size of the key in bytes.
+
+    \return     False if the key has definitely not been added, true if it
+                probably has.
+*/
+bool bloom_blocked_contains(bloom_blocked_t *bloom, void *key, size_t size);
+
+/*!
+    \brief      Number of blocks for a number of keys and a false positive rate.
+
+    \details    Adds 1/8 to `bloom_size_for` to make up for the uneven load
+                of the blocks.
+
+    \param keys     Number of keys the filter shall hold.
+    \param fp_ppm   False positive rate in parts per million, 10000 for 1%.
+
+    \return     The number of 512 bit blocks.
+*/
+uint32_t bloom_blocked_blocks_for(uint32_t keys, uint32_t fp_ppm);
+
+#endif /* BLOOM_ENABLE_BLOCKED */
+
+#endif /* BLOOM_H_ */
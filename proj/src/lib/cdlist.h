@@ -0,0 +1,292 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*!
+    \file       cdlist.h
+
+    \brief      Counted circular doubly linked list header file
+
+    \details    A variant of the circular doubly linked list (see dlist.h) whose
+                control structure maintains the number of nodes. `cdlist_size`
+                and `cdlist_empty` are O(1) instead of walking the list, at the
+                cost of one counter per list and one increment or decrement per
+                update. Nodes are plain `dlist_node_t`.
+
+                The count is only correct as long as all updates go through the
+                cdlist macros. Read only dlist operations may be used on the
+                list returned by `cdlist_list`.
+*/
+
+#ifndef CDLIST_H_
+#define CDLIST_H_
+
+#include "dlist.h"
+
+/*!
+    \brief      Counted doubly linked list control structure.
+*/
+typedef struct {
+    dlist_t head;           //!< Control node of the circular list
+    size_t count;           //!< Number of nodes in the list
+} cdlist_t;
+
+/*!
+    \brief      Returns the circular doubly linked list of a counted list.
+
+    \param list A pointer to the counted list.
+
+    \return A pointer to the `dlist_t` control node.
+*/
+#define cdlist_list(list) \
+    (&((cdlist_t*)(list))->head)
+
+/*!
+    \brief      Iterates through a counted list, see `dlist_foreach`.
+
+    \param list      A pointer to the counted list.
+    \param iterator  A pointer to a `dlist_node_t` that will be used as the iterator.
+*/
+#define cdlist_foreach(list,iterator) \
+    dlist_foreach(cdlist_list(list),iterator)
+
+/*!
+    \brief      Retrieves the next node, see `dlist_next`.
+
+    \param list A pointer to the counted list.
+    \param node A pointer to the current node.
+*/
+#define cdlist_next(list,node) \
+    dlist_next(cdlist_list(list),node)
+
+/*!
+    \brief      Retrieves the node preceding the given node, see `dlist_prev`.
+
+    \param list A pointer to the counted list.
+    \param node A pointer to the node whose predecessor is to be found.
+*/
+#define cdlist_prev(list,node) \
+    dlist_prev(cdlist_list(list),((dlist_node_t*)(node)))
+
+/*!
+    \brief      Returns the node two positions before the given node, see `dlist_prev_prev`.
+
+    \param list A pointer to the counted list.
+    \param node A pointer to the node for which to find the node two positions before.
+*/
+#define cdlist_prev_prev(list,node) \
+    dlist_prev_prev(cdlist_list(list),((dlist_node_t*)(node)))
+
+/*!
+    \brief      Initializes a counted list to be empty.
+
+    \param list A pointer to the counted list.
+*/
+#define cdlist_init(list) \
+    do{ \
+        dlist_init(cdlist_list(list)); \
+        ((cdlist_t*)(list))->count = 0; \
+    }while(0)
+
+/*!
+    \brief      Returns a pointer to the first data node, or the list control node if empty.
+
+    \param list A pointer to the counted list.
+*/
+#define cdlist_begin(list) \
+    dlist_begin(cdlist_list(list))
+
+/*!
+    \brief      Returns a pointer to the first data node, alias for `cdlist_begin`.
+
+    \param list A pointer to the counted list.
+*/
+#define cdlist_front(list) \
+    dlist_front(cdlist_list(list))
+
+/*!
+    \brief      Returns a pointer to the past-the-end element, the list control node.
+
+    \param list A pointer to the counted list.
+*/
+#define cdlist_end(list) \
+    dlist_end(cdlist_list(list))
+
+/*!
+    \brief      Returns a pointer to the last data node, see `dlist_back`.
+
+    \param list A pointer to the counted list.
+*/
+#define cdlist_back(list) \
+    dlist_back(cdlist_list(list))
+
+/*!
+    \brief      Checks if the list is empty in O(1).
+
+    \param list A pointer to the counted list.
+
+    \return True if the list is empty, false otherwise.
+*/
+#define cdlist_empty(list) \
+    (((cdlist_t*)(list))->count == 0)
+
+/*!
+    \brief      Returns the number of nodes in the list in O(1).
+
+    \param list A pointer to the counted list.
+
+    \return The number of nodes in the list.
+*/
+#define cdlist_size(list) \
+    (((cdlist_t*)(list))->count)
+
+/*!
+    \brief      Inserts a new node at the beginning of the list.
+
+    \param list A pointer to the counted list.
+    \param node A pointer to the new node to be inserted.
+*/
+#define cdlist_push_front(list,node) \
+    do{ \
+        dlist_push_front(cdlist_list(list),node); \
+        ((cdlist_t*)(list))->count++; \
+    }while(0)
+
+/*!
+    \brief      Removes the first node from a non empty list.
+
+    \param list A pointer to the counted list.
+*/
+#define cdlist_pop_front(list) \
+    do{ \
+        dlist_pop_front(cdlist_list(list)); \
+        ((cdlist_t*)(list))->count--; \
+    }while(0)
+
+/*!
+    \brief      Inserts a new node at the end of the list.
+
+    \param list A pointer to the counted list.
+    \param node A pointer to the new node to be inserted.
+*/
+#define cdlist_push_back(list,node) \
+    do{ \
+        dlist_push_back(cdlist_list(list),node); \
+        ((cdlist_t*)(list))->count++; \
+    }while(0)
+
+/*!
+    \brief      Removes the last node from a non empty list.
+
+    \param list A pointer to the counted list.
+*/
+#define cdlist_pop_back(list) \
+    do{ \
+        dlist_pop_back(cdlist_list(list)); \
+        ((cdlist_t*)(list))->count--; \
+    }while(0)
+
+/*!
+    \brief      Removes a node from the list.
+
+    \param list A pointer to the counted list.
+    \param node A pointer to the node to be removed from the list.
+*/
+#define cdlist_erase(list,node) \
+    do{ \
+        dlist_erase(cdlist_list(list),node); \
+        ((cdlist_t*)(list))->count--; \
+    }while(0)
+
+/*!
+    \brief      Removes a node from the list and marks it as unlinked, see
+                `dlist_node_init`.
+
+    \param list A pointer to the counted list.
+    \param node A pointer to the node to be removed from the list.
+*/
+#define cdlist_erase_safe(list,node) \
+    do{ \
+        dlist_erase_safe(cdlist_list(list),node); \
+        ((cdlist_t*)(list))->count--; \
+    }while(0)
+
+/*!
+    \brief      Removes a node from the list if it is on it, see
+                `dlist_erase_if_linked`.
+
+    \param list A pointer to the counted list.
+    \param node A pointer to the node to be removed from the list.
+*/
+#define cdlist_erase_if_linked(list,node) \
+    do{ \
+        dlist_node_t *cdlist_linked_ = ((dlist_node_t*)(node)); \
+        if (dlist_node_is_linked(cdlist_linked_)) \
+        { \
+            cdlist_erase_safe(list,cdlist_linked_); \
+        } \
+    }while(0)
+
+/*!
+    \brief      Inserts a new node after a given position in the list.
+
+    \param list A pointer to the counted list.
+    \param pos A pointer to the node after which the new node should be inserted.
+    \param node A pointer to the new node to be inserted.
+*/
+#define cdlist_insert_after(list,pos,node) \
+    do{ \
+        dlist_insert_after(cdlist_list(list),pos,node); \
+        ((cdlist_t*)(list))->count++; \
+    }while(0)
+
+/*!
+    \brief      Inserts a new node before a given position in the list.
+
+    \param list A pointer to the counted list.
+    \param pos A pointer to the node before which the new node should be inserted.
+    \param node A pointer to the new node to be inserted.
+*/
+#define cdlist_insert_before(list,pos,node) \
+    do{ \
+        dlist_insert_before(cdlist_list(list),pos,node); \
+        ((cdlist_t*)(list))->count++; \
+    }while(0)
+
+/*!
+    \brief      Searches for a node within the list.
+
+    \param list A pointer to the counted list.
+    \param node The node to search for.
+
+    \return A pointer to the found node if it exists in the list, otherwise NULL.
+*/
+#define cdlist_find(list,node) \
+    dlist_find(cdlist_list(list),((dlist_node_t*)(node)))
+
+#endif /* CDLIST_H_ */
@@ -0,0 +1,259 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       cms.c
+
+    \brief      Count-min sketch with a top-K tracker
+
+    \details    see header file
+*/
+#include <string.h>
+#include "cms.h"
+#include "hash.h"
+
+#define CMS_SEED    0x61C88647UL
+
+#define cms_topk_entry(topk,idx) \
+    (&(topk)->entries[(size_t)(idx) * (topk)->stride])
+
+#define cms_topk_count(entry) \
+    (*(uint32_t*)(entry))
+
+/* per row remix of the key hash, the murmur3 finalizer over hash ^ seed */
+static uint32_t cms_row_hash(uint32_t hash, uint8_t row)
+{
+    hash ^= (uint32_t)(row + 1) * 0x9E3779B9UL;
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6BUL;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35UL;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+/* fills slots with a pointer to the counter of each row */
+static void cms_slots(cms_t *cms, void *key, size_t size, uint32_t **slots)
+{
+    uint32_t hash = hash_murmur3(CMS_SEED, key, size);
+    uint32_t *row = cms->counters;
+    uint8_t idx;
+
+    for (idx = 0; idx < cms->rows; idx++, row += cms->width)
+    {
+        uint32_t column = cms_row_hash(hash, idx);
+
+        /* masking is much cheaper than a 32 bit division on small targets */
+        if ((cms->width & (cms->width - 1)) == 0)
+        {
+            column &= cms->width - 1;
+        }
+        else
+        {
+            column %= cms->width;
+        }
+
+        slots[idx] = &row[column];
+    }
+}
+
+bool cms_init(cms_t *cms, uint32_t *counters, uint8_t rows, uint16_t width)
+{
+    /* an empty row would make every column index run out of bounds */
+    if (rows == 0 || width == 0)
+    {
+        cms->counters = counters;
+        cms->rows = 0;
+        cms->width = 0;
+        return false;
+    }
+
+    /* the per row slot arrays hold CMS_ROWS_MAX entries */
+    if (rows > CMS_ROWS_MAX)
+    {
+        rows = CMS_ROWS_MAX;
+    }
+
+    cms->counters = counters;
+    cms->rows = rows;
+    cms->width = width;
+    cms_clear(cms);
+
+    return true;
+}
+
+void cms_clear(cms_t *cms)
+{
+    memset(cms->counters, 0x00, (size_t)cms->rows * cms->width * sizeof(uint32_t));
+}
+
+uint32_t cms_add(cms_t *cms, void *key, size_t size, uint32_t count)
+{
+    uint32_t *slots[CMS_ROWS_MAX];
+    uint32_t estimate = UINT32_MAX;
+    uint8_t idx;
+
+    cms_slots(cms, key, size, slots);
+
+    for (idx = 0; idx < cms->rows; idx++)
+    {
+        if (*slots[idx] < estimate)
+        {
+            estimate = *slots[idx];
+        }
+    }
+
+    estimate = (estimate > UINT32_MAX - count) ? UINT32_MAX : estimate + count;
+
+    /* conservative update, raise only the counters below the new estimate */
+    for (idx = 0; idx < cms->rows; idx++)
+    {
+        if (*slots[idx] < estimate)
+        {
+            *slots[idx] = estimate;
+        }
+    }
+
+    return estimate;
+}
+
+uint32_t cms_estimate(cms_t *cms, void *key, size_t size)
+{
+    uint32_t *slots[CMS_ROWS_MAX];
+    uint32_t estimate = UINT32_MAX;
+    uint8_t idx;
+
+    cms_slots(cms, key, size, slots);
+
+    for (idx = 0; idx < cms->rows; idx++)
+    {
+        if (*slots[idx] < estimate)
+        {
+            estimate = *slots[idx];
+        }
+    }
+
+    return estimate;
+}
+
+void cms_topk_init(cms_topk_t *topk, uint8_t *entries, uint8_t size, size_t stride, size_t key_offset, size_t key_size)
+{
+    topk->entries = entries;
+    topk->size = size;
+    topk->stride = stride;
+    topk->key_offset = key_offset;
+    topk->key_size = key_size;
+    cms_topk_clear(topk);
+}
+
+void cms_topk_clear(cms_topk_t *topk)
+{
+    topk->used = 0;
+}
+
+bool cms_topk_offer(cms_topk_t *topk, void *key, uint32_t estimate)
+{
+    uint8_t *lightest = NULL;
+    uint8_t *entry;
+    uint8_t idx;
+
+    for (idx = 0; idx < topk->used; idx++)
+    {
+        entry = cms_topk_entry(topk, idx);
+
+        if (memcmp(entry + topk->key_offset, key, topk->key_size) == 0)
+        {
+            if (estimate > cms_topk_count(entry))
+            {
+                cms_topk_count(entry) = estimate;
+            }
+
+            return true;
+        }
+
+        if (!lightest || cms_topk_count(entry) < cms_topk_count(lightest))
+        {
+            lightest = entry;
+        }
+    }
+
+    if (topk->used < topk->size)
+    {
+        entry = cms_topk_entry(topk, topk->used++);
+    }
+    else if (lightest && estimate > cms_topk_count(lightest))
+    {
+        entry = lightest;
+    }
+    else
+    {
+        return false;
+    }
+
+    cms_topk_count(entry) = estimate;
+    memcpy(entry + topk->key_offset, key, topk->key_size);
+
+    return true;
+}
+
+/* swaps two entries bytewise, no buffer of the entry size is needed */
+static void cms_topk_swap(cms_topk_t *topk, uint8_t *a, uint8_t *b)
+{
+    size_t idx;
+
+    for (idx = 0; idx < topk->stride; idx++)
+    {
+        uint8_t temp = a[idx];
+        a[idx] = b[idx];
+        b[idx] = temp;
+    }
+}
+
+/* insertion sort, K is small and the entries are mostly in order already */
+void cms_topk_sort(cms_topk_t *topk)
+{
+    uint8_t idx;
+
+    for (idx = 1; idx < topk->used; idx++)
+    {
+        uint8_t pos;
+
+        for (pos = idx; pos > 0; pos--)
+        {
+            uint8_t *prev = cms_topk_entry(topk, pos - 1);
+            uint8_t *entry = cms_topk_entry(topk, pos);
+
+            if (cms_topk_count(prev) >= cms_topk_count(entry))
+            {
+                break;
+            }
+
+            cms_topk_swap(topk, prev, entry);
+        }
+    }
+}
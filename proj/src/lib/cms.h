@@ -0,0 +1,288 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       cms.h
+
+    \brief      Count-min sketch with a top-K tracker
+
+    \details    A count-min sketch estimates how often each key occurred in a
+                stream using a fixed table of d rows by w counters, regardless
+                of the number of distinct keys. Every row maps the key to one
+                counter, the estimate is the smallest of the d counters. It
+                never underestimates; with w = e/eps and d = ln(1/delta) the
+                overestimate exceeds eps times the total count with a
+                probability of at most delta.
+
+                Updates are conservative: only the counters below the new
+                estimate are raised, which keeps the error of light keys much
+                lower than incrementing all d counters.
+
+                The key is hashed once with `hash_murmur3`, each row remixes
+                that hash with its own seed. An update costs one hash over the
+                key and d counter accesses.
+
+                The top-K tracker keeps the K keys with the highest estimates
+                seen so far, fed with the estimate returned by `cms_add`:
+
+                \code
+                CMS_TYPEDEF(traffic,4,256);
+                CMS_TOPK_TYPEDEF(nodes,8,uint16_t);
+
+                CMS_T(traffic) traffic;
+                CMS_TOPK_T(nodes) top;
+
+                CMS_INIT(traffic);
+                CMS_TOPK_INIT(top);
+
+                uint32_t estimate = cms_add(CMS(traffic), &node, sizeof(node), 1);
+                cms_topk_offer(CMS_TOPK(top), &node, estimate);
+                \endcode
+*/
+
+#ifndef CMS_H_
+#define CMS_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/*!
+    \brief      Largest supported number of rows.
+*/
+#define CMS_ROWS_MAX    8
+
+/*!
+    \brief      Count-min sketch control structure.
+*/
+typedef struct {
+    uint32_t *counters;     //!< rows * width counters, row by row
+    uint16_t width;         //!< Number of counters per row, w
+    uint8_t rows;           //!< Number of rows, d
+} cms_t;
+
+/*!
+    \brief      Defines a new count-min sketch type.
+
+    \param name     The base name of the new type, the type is `name##_cms_t`.
+    \param rows     The number of rows, 1 to `CMS_ROWS_MAX`, checked at compile time.
+    \param width    The number of counters per row, 1 to 65535, checked at compile
+                    time. A power of two is cheapest.
+*/
+#define CMS_TYPEDEF(name,rows,width) \
+    typedef char name##_cms_check_t[((rows) >= 1 && (rows) <= CMS_ROWS_MAX && \
+                                     (width) >= 1 && (width) <= UINT16_MAX) ? 1 : -1]; \
+    typedef struct { \
+        cms_t cms; \
+        uint32_t counters[rows][width]; \
+    }name##_cms_t
+
+/*!
+    \brief      Names a count-min sketch type defined with `CMS_TYPEDEF`.
+
+    \param name     The base name as specified in `CMS_TYPEDEF`.
+*/
+#define CMS_T(name) \
+    name##_cms_t
+
+/*!
+    \brief      Returns a pointer to the control structure of a sketch instance.
+
+    \param sketch   The variable of a type defined with `CMS_TYPEDEF`.
+*/
+#define CMS(sketch) \
+    (&(sketch).cms)
+
+/*!
+    \brief      Initializes a sketch instance to be empty.
+
+    \param sketch   The variable of a type defined with `CMS_TYPEDEF`.
+*/
+#define CMS_INIT(sketch) \
+    cms_init(CMS(sketch),&(sketch).counters[0][0], \
+             (uint8_t)(sizeof((sketch).counters)/sizeof((sketch).counters[0])), \
+             (uint16_t)(sizeof((sketch).counters[0])/sizeof((sketch).counters[0][0])))
+
+/*!
+    \brief      Initializes a count-min sketch on an array of counters.
+
+    \param cms      Pointer to the sketch control structure.
+    \param counters Array of `rows` * `width` counters.
+    \param rows     Number of rows, between 1 and `CMS_ROWS_MAX`, larger
+                    values are clamped to `CMS_ROWS_MAX`.
+    \param width    Number of counters per row, at least 1.
+
+    \return     False if `rows` or `width` is 0, the sketch then has no rows,
+                so updates touch no counter.
+*/
+bool cms_init(cms_t *cms, uint32_t *counters, uint8_t rows, uint16_t width);
+
+/*!
+    \brief      Resets all counters of a sketch to zero.
+
+    \param cms      Pointer to the sketch control structure.
+*/
+void cms_clear(cms_t *cms);
+
+/*!
+    \brief      Counts occurrences of a key.
+
+    \param cms      Pointer to the sketch control structure.
+    \param key      Pointer to the key bytes.
+    \param size     Size of the key in bytes.
+    \param count    Number of occurrences to add.
+
+    \return     The estimated count of the key after the update, saturating
+                at UINT32_MAX.
+*/
+uint32_t cms_add(cms_t *cms, void *key, size_t size, uint32_t count);
+
+/*!
+    \brief      Estimates the count of a key.
+
+    \param cms      Pointer to the sketch control structure.
+    \param key      Pointer to the key bytes.
+    \param size     Size of the key in bytes.
+
+    \return     The estimated count, never below the true count.
+*/
+uint32_t cms_estimate(cms_t *cms, void *key, size_t size);
+
+/*!
+    \brief      Top-K tracker control structure.
+*/
+typedef struct {
+    uint8_t *entries;       //!< Entries, each a count followed by a key
+    uint8_t size;           //!< Number of entries, K
+    uint8_t used;           //!< Number of entries in use
+    size_t stride;          //!< Size of an entry in bytes
+    size_t key_offset;      //!< Offset of the key within an entry
+    size_t key_size;        //!< Size of the key in bytes
+} cms_topk_t;
+
+/*!
+    \brief      Defines a new top-K tracker type for keys of a given type.
+
+    \details    After `cms_topk_sort` the instance member `entries` holds the
+                `cms_topk_size` heaviest keys in `key` and their estimates in
+                `count`, heaviest first.
+
+    \param name     The base name of the new type, the type is `name##_cms_topk_t`.
+    \param k        The number of keys to track, at most 255.
+    \param type     The key type, compared bytewise.
+*/
+#define CMS_TOPK_TYPEDEF(name,k,type) \
+    typedef struct { \
+        cms_topk_t topk; \
+        struct { \
+            uint32_t count; \
+            type key; \
+        }entries[k]; \
+    }name##_cms_topk_t
+
+/*!
+    \brief      Names a top-K tracker type defined with `CMS_TOPK_TYPEDEF`.
+
+    \param name     The base name as specified in `CMS_TOPK_TYPEDEF`.
+*/
+#define CMS_TOPK_T(name) \
+    name##_cms_topk_t
+
+/*!
+    \brief      Returns a pointer to the control structure of a top-K tracker instance.
+
+    \param tracker  The variable of a type defined with `CMS_TOPK_TYPEDEF`.
+*/
+#define CMS_TOPK(tracker) \
+    (&(tracker).topk)
+
+/*!
+    \brief      Initializes a top-K tracker instance to be empty.
+
+    \param tracker  The variable of a type defined with `CMS_TOPK_TYPEDEF`.
+*/
+#define CMS_TOPK_INIT(tracker) \
+    cms_topk_init(CMS_TOPK(tracker),(uint8_t*)(tracker).entries, \
+                  (uint8_t)(sizeof((tracker).entries)/sizeof((tracker).entries[0])), \
+                  sizeof((tracker).entries[0]), \
+                  (size_t)((uint8_t*)&(tracker).entries[0].key - (uint8_t*)&(tracker).entries[0]), \
+                  sizeof((tracker).entries[0].key))
+
+/*!
+    \brief      Returns the number of keys tracked by a top-K tracker.
+
+    \param topk     Pointer to the tracker control structure.
+*/
+#define cms_topk_size(topk) \
+    ((topk)->used)
+
+/*!
+    \brief      Initializes a top-K tracker on an array of entries.
+
+    \details    Each entry starts with a `uint32_t` count, the key is stored at
+                `key_offset`.
+
+    \param topk         Pointer to the tracker control structure.
+    \param entries      Array of `size` entries of `stride` bytes.
+    \param size         Number of entries, K.
+    \param stride       Size of an entry in bytes.
+    \param key_offset   Offset of the key within an entry.
+    \param key_size     Size of the key in bytes.
+*/
+void cms_topk_init(cms_topk_t *topk, uint8_t *entries, uint8_t size, size_t stride, size_t key_offset, size_t key_size);
+
+/*!
+    \brief      Removes all keys from a top-K tracker.
+
+    \param topk     Pointer to the tracker control structure.
+*/
+void cms_topk_clear(cms_topk_t *topk);
+
+/*!
+    \brief      Offers a key with its current estimate to a top-K tracker.
+
+    \details    A tracked key gets its count updated. An untracked key takes a
+                free entry or replaces the lightest key if its estimate is
+                higher. Costs one pass over the K entries.
+
+    \param topk     Pointer to the tracker control structure.
+    \param key      Pointer to the key, `key_size` bytes.
+    \param estimate The estimated count of the key, as returned by `cms_add`.
+
+    \return     True if the key is tracked afterwards.
+*/
+bool cms_topk_offer(cms_topk_t *topk, void *key, uint32_t estimate);
+
+/*!
+    \brief      Sorts the tracked keys by their counts, heaviest first.
+
+    \param topk     Pointer to the tracker control structure.
+*/
+void cms_topk_sort(cms_topk_t *topk);
+
+#endif /* CMS_H_ */
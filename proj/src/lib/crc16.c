@@ -34,7 +34,17 @@
     \details    see header file
 */
 
+#if defined(CRC16_ENABLE_PARALLEL) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
 #include "crc16.h"
+#include "crc16_kernel.h"
+
+#if defined(CRC16_ENABLE_PARALLEL)
+#include <pthread.h>
+#include <unistd.h>
+#endif
 
 static const crc16_conf_t crc16_conf[] = {
 
@@ -45,11 +55,7 @@ static const crc16_conf_t crc16_conf[] = {
         0x57BE,
         0xBB3D,
     #endif
-        0x8005,
-        0x0000,
-        true,
-        true,
-        0x0000
+        CRC16_ARC_PARAMS
     },
 #endif
 
@@ -60,11 +66,7 @@ static const crc16_conf_t crc16_conf[] = {
         0xEABF,
         0x4C06,
     #endif
-        0xC867,
-        0xFFFF,
-        false,
-        false,
-        0x0000
+        CRC16_CDMA2000_PARAMS
     },
 #endif
 
@@ -75,11 +77,7 @@ static const crc16_conf_t crc16_conf[] = {
         0x64A5,
         0xAEE7,
     #endif
-        0x8005,
-        0xFFFF,
-        false,
-        false,
-        0x0000
+        CRC16_CMS_PARAMS
     },
 #endif
 
@@ -90,11 +88,7 @@ static const crc16_conf_t crc16_conf[] = {
         0x9765,
         0x9ECF,
     #endif
-        0x8005,
-        0x800D,
-        false,
-        false,
-        0x0000
+        CRC16_DDS_110_PARAMS
     },
 #endif
 
@@ -105,11 +99,7 @@ static const crc16_conf_t crc16_conf[] = {
         0x23FE,
         0x007E,
     #endif
-        0x0589,
-        0x0000,
-        false,
-        false,
-        0x0001
+        CRC16_DECT_R_PARAMS
     },
 #endif
 
@@ -120,11 +110,7 @@ static const crc16_conf_t crc16_conf[] = {
         0x23FF,
         0x007F,
     #endif
-        0x0589,
-        0x0000,
-        false,
-        false,
-        0x0000
+        CRC16_DECT_X_PARAMS
     },
 #endif
 
@@ -135,11 +121,7 @@ static const crc16_conf_t crc16_conf[] = {
         0x8A5A,
         0xEA82,
     #endif
-        0x3D65,
-        0x0000,
-        true,
-        true,
-        0xFFFF
+        CRC16_DNP_PARAMS
     },
 #endif
 
@@ -150,11 +132,7 @@ static const crc16_conf_t crc16_conf[] = {
         0x07C0,
         0xC2B7,
     #endif
-        0x3D65,
-        0x0000,
-        false,
-        false,
-        0xFFFF
+        CRC16_EN_13757_PARAMS
     },
 #endif
 
@@ -165,11 +143,7 @@ static const crc16_conf_t crc16_conf[] = {
         0x77D5,
         0xD64E,
     #endif
-        0x1021,
-        0xFFFF,
-        false,
-        false,
-        0xFFFF
+        CRC16_GENIBUS_PARAMS
     },
 #endif
 
@@ -180,11 +154,7 @@ static const crc16_conf_t crc16_conf[] = {
         0xF32C,
         0xCE3C,
     #endif
-        0x1021,
-        0x0000,
-        false,
-        false,
-        0xFFFF
+        CRC16_GSM_PARAMS
     },
 #endif
 
@@ -195,11 +165,7 @@ static const crc16_conf_t crc16_conf[] = {
         0x882A,
         0x29B1,
     #endif
-        0x1021,
-        0xFFFF,
-        false,
-        false,
-        0x0000
+        CRC16_IBM_3740_PARAMS
     },
 #endif
 
@@ -210,11 +176,7 @@ static const crc16_conf_t crc16_conf[] = {
         0x0BBB,
         0x906E,
     #endif
-        0x1021,
-        0xFFFF,
-        true,
-        true,
-        0xFFFF
+        CRC16_IBM_SDLC_PARAMS
     },
 #endif
 
@@ -225,11 +187,7 @@ static const crc16_conf_t crc16_conf[] = {
         0x4167,
         0xBF05,
     #endif
-        0x1021,
-        0xC6C6,
-        true,
-        true,
-        0x0000
+        CRC16_ISO_IEC_14443_3_A_PARAMS
     },
 #endif
 
@@ -240,11 +198,7 @@ static const crc16_conf_t crc16_conf[] = {
         0x6B65,
         0x2189,
     #endif
-        0x1021,
-        0x0000,
-        true,
-        true,
-        0x0000
+        CRC16_KERMIT_PARAMS
     },
 #endif
 
@@ -255,11 +209,7 @@ static const crc16_conf_t crc16_conf[] = {
         0xF77A,
         0xBDF4,
     #endif
-        0x6F63,
-        0x0000,
-        false,
-        false,
-        0x0000
+        CRC16_LJ1200_PARAMS
     },
 #endif
 
@@ -270,11 +220,7 @@ static const crc16_conf_t crc16_conf[] = {
         0x835A,
         0x772B,
     #endif
-        0x5935,
-        0xFFFF,
-        false,
-        false,
-        0x0000
+        CRC16_M17_PARAMS
     },
 #endif
 
@@ -285,11 +231,7 @@ static const crc16_conf_t crc16_conf[] = {
         0xA841,
         0x44C2,
     #endif
-        0x8005,
-        0x0000,
-        true,
-        true,
-        0xFFFF
+        CRC16_MAXIM_DOW_PARAMS
     },
 #endif
 
@@ -300,11 +242,7 @@ static const crc16_conf_t crc16_conf[] = {
         0xF444,
         0x6F91,
     #endif
-        0x1021,
-        0xFFFF,
-        true,
-        true,
-        0x0000
+        CRC16_MCRF4XX_PARAMS
     },
 #endif
 
@@ -315,11 +253,7 @@ static const crc16_conf_t crc16_conf[] = {
         0x55DA,
         0x4B37,
     #endif
-        0x8005,
-        0xFFFF,
-        true,
-        true,
-        0x0000
+        CRC16_MODBUS_PARAMS
     },
 #endif
 
@@ -330,11 +264,7 @@ static const crc16_conf_t crc16_conf[] = {
         0x7554,
         0xA066,
     #endif
-        0x080B,
-        0xFFFF,
-        true,
-        true,
-        0x0000
+        CRC16_NRSC_5_PARAMS
     },
 #endif
 
@@ -345,11 +275,7 @@ static const crc16_conf_t crc16_conf[] = {
         0x1091,
         0x5D38,
     #endif
-        0x5935,
-        0x0000,
-        false,
-        false,
-        0x0000
+        CRC16_OPENSAFETY_A_PARAMS
     },
 #endif
 
@@ -360,11 +286,7 @@ static const crc16_conf_t crc16_conf[] = {
         0x8162,
         0x20FE,
     #endif
-        0x755B,
-        0x0000,
-        false,
-        false,
-        0x0000
+        CRC16_OPENSAFETY_B_PARAMS
     },
 #endif
 
@@ -375,11 +297,7 @@ static const crc16_conf_t crc16_conf[] = {
         0xD5C0,
         0xA819,
     #endif
-        0x1DCF,
-        0xFFFF,
-        false,
-        false,
-        0xFFFF
+        CRC16_PROFIBUS_PARAMS
     },
 #endif
 
@@ -390,11 +308,7 @@ static const crc16_conf_t crc16_conf[] = {
         0x014E,
         0x63D0,
     #endif
-        0x1021,
-        0xB2AA,
-        true,
-        true,
-        0x0000
+        CRC16_RIELLO_PARAMS
     },
 #endif
 
@@ -405,11 +319,7 @@ static const crc16_conf_t crc16_conf[] = {
         0xA5B9,
         0xE5CC,
     #endif
-        0x1021,
-        0x1D0F,
-        false,
-        false,
-        0x0000
+        CRC16_SPI_FUJITSU_PARAMS
     },
 #endif
 
@@ -420,11 +330,7 @@ static const crc16_conf_t crc16_conf[] = {
         0x9744,
         0xD0DB,
     #endif
-        0x8BB7,
-        0x0000,
-        false,
-        false,
-        0x0000
+        CRC16_T10_DIF_PARAMS
     },
 #endif
 
@@ -435,11 +341,7 @@ static const crc16_conf_t crc16_conf[] = {
         0xB69F,
         0x0FB3,
     #endif
-        0xA097,
-        0x0000,
-        false,
-        false,
-        0x0000
+        CRC16_TELEDISK_PARAMS
     },
 #endif
 
@@ -450,11 +352,7 @@ static const crc16_conf_t crc16_conf[] = {
         0x6601,
         0x26B1,
     #endif
-        0x1021,
-        0x89EC,
-        true,
-        true,
-        0x0000
+        CRC16_TMS37157_PARAMS
     },
 #endif
 
@@ -465,11 +363,7 @@ static const crc16_conf_t crc16_conf[] = {
         0x42E5,
         0xFEE8,
     #endif
-        0x8005,
-        0x0000,
-        false,
-        false,
-        0x0000
+        CRC16_UMTS_PARAMS
     },
 #endif
 
@@ -480,11 +374,7 @@ static const crc16_conf_t crc16_conf[] = {
         0xAA25,
         0xB4C8,
     #endif
-        0x8005,
-        0xFFFF,
-        true,
-        true,
-        0xFFFF
+        CRC16_USB_PARAMS
     },
 #endif
 
@@ -495,11 +385,7 @@ static const crc16_conf_t crc16_conf[] = {
         0x0CD3,
         0x31C3,
     #endif
-        0x1021,
-        0x0000,
-        false,
-        false,
-        0x0000
+        CRC16_XMODEM_PARAMS
     },
 #endif
 
@@ -522,81 +408,405 @@ int crc16_conf_count(void)
 }
 
 
-/* Hilfsfunktion zum Spiegeln eines Bytes (Bitreihenfolge umkehren) */
-static uint8_t crc16_reflect8(uint8_t x)
+uint16_t crc16_update_byte(crc16_id_t id, uint16_t seed, uint8_t byte)
 {
-    /* Variante mit „bitweiser“ Umkehr durch Masken und Verschieben */
-    x = (uint8_t)((x & 0xF0) >> 4 | (x & 0x0F) << 4);
-    x = (uint8_t)((x & 0xCC) >> 2 | (x & 0x33) << 2);
-    x = (uint8_t)((x & 0xAA) >> 1 | (x & 0x55) << 1);
-    return x;
+    return crc16_kernel_update_byte(crc16_conf[id].poly, crc16_conf[id].refin, seed, byte);
 }
 
-uint16_t crc16_update_byte(crc16_id_t id, uint16_t seed, uint8_t byte)
+uint16_t crc16_update(crc16_id_t id, uint16_t seed, uint8_t *data, size_t size)
 {
-    unsigned char i;
+    const crc16_conf_t *conf = &crc16_conf[id];
 
-    /* Wenn RefIn = true, Byte vor der CRC-Berechnung spiegeln */
-    if (crc16_conf[id].refin) {
-        byte = crc16_reflect8(byte);
+    while (size--)
+    {
+        seed = crc16_kernel_update_byte(conf->poly, conf->refin, seed, *data++);
     }
 
-    for (i = 0; i < 8; i++) {
+    return seed;
+}
 
-        if (((seed & 0x8000) >> 8) ^ (byte & 0x80)){
-            seed = (seed << 1)  ^ crc16_conf[id].poly;
-        }else{
-            seed = (seed << 1);
+uint16_t crc16_finalize (crc16_id_t id, uint16_t seed)
+{
+    return crc16_kernel_finalize(crc16_conf[id].refout, crc16_conf[id].xorout, seed);
+}
+
+uint16_t crc16 (crc16_id_t id, uint8_t *data, size_t size)
+{
+    return crc16_finalize(id, crc16_update(id, crc16_conf[id].init, data, size));
+}
+
+uint16_t crc16_update_ring(crc16_id_t id, uint16_t seed, uint8_t *ring, size_t ringsize, size_t offset, size_t size)
+{
+    size_t first;
+
+    /* Vorbedingungen absichern, nur CRC16_UPDATE_RINGBUFFER garantiert sie */
+    if (ringsize == 0)
+    {
+        return seed;
+    }
+
+    if (offset >= ringsize)
+    {
+        offset %= ringsize;
+    }
+
+    if (size > ringsize)
+    {
+        size = ringsize;
+    }
+
+    /* Erstes Segment bis zum Ende des Arrays, der Rest ab dem Anfang */
+    first = ringsize - offset;
+
+    if (first > size)
+    {
+        first = size;
+    }
+
+    seed = crc16_update(id, seed, ring + offset, first);
+
+    return crc16_update(id, seed, ring, size - first);
+}
+
+
+/* Multipliziert die 16x16 GF(2) Matrix mat mit dem Vektor vec */
+static uint16_t crc16_gf2_matrix_times(const uint16_t *mat, uint16_t vec)
+{
+    uint16_t sum = 0;
+
+    while (vec)
+    {
+        if (vec & 1)
+        {
+            sum ^= *mat;
         }
 
-        byte <<= 1;
+        vec >>= 1;
+        mat++;
     }
 
-    return seed;
+    return sum;
 }
 
-uint16_t crc16_update(crc16_id_t id, uint16_t seed, uint8_t *data, size_t size)
+/* square = mat * mat */
+static void crc16_gf2_matrix_square(uint16_t *square, const uint16_t *mat)
 {
+    unsigned char n;
 
-    while (size--)
+    for (n = 0; n < 16; n++)
     {
-        seed = crc16_update_byte(id, seed, *data++);
+        square[n] = crc16_gf2_matrix_times(mat, mat[n]);
     }
+}
+
+/*
+    Schiebt das (nicht gespiegelte) Register über len Null-Bytes weiter,
+    analog zu crc32_combine() aus zlib: odd/even enthalten abwechselnd den
+    Operator für 2^k Null-Bits.
+*/
+static uint16_t crc16_shift_zeros(uint16_t poly, uint16_t seed, size_t len)
+{
+    uint16_t even[16];
+    uint16_t odd[16];
+    unsigned char n;
+
+    if (len == 0)
+    {
+        return seed;
+    }
+
+    /* Operator für ein Null-Bit */
+    for (n = 0; n < 15; n++)
+    {
+        odd[n] = (uint16_t)(1u << (n + 1));
+    }
+    odd[15] = poly;
+
+    crc16_gf2_matrix_square(even, odd);     /* zwei Null-Bits */
+    crc16_gf2_matrix_square(odd, even);     /* vier Null-Bits */
+
+    do
+    {
+        crc16_gf2_matrix_square(even, odd);
+
+        if (len & 1)
+        {
+            seed = crc16_gf2_matrix_times(even, seed);
+        }
+
+        len >>= 1;
+
+        if (len == 0)
+        {
+            break;
+        }
+
+        crc16_gf2_matrix_square(odd, even);
+
+        if (len & 1)
+        {
+            seed = crc16_gf2_matrix_times(odd, seed);
+        }
+
+        len >>= 1;
+
+    } while (len);
 
     return seed;
 }
 
+/* Macht crc16_kernel_finalize rückgängig (Spiegeln ist selbstinvers) */
+static uint16_t crc16_kernel_definalize(bool refout, uint16_t xorout, uint16_t crc)
+{
+    crc ^= xorout;
 
-/* Hilfsfunktion zum Spiegeln eines 16-Bit-Werts */
-static uint16_t crc16_reflect16(uint16_t x)
+    if (refout)
+    {
+        crc = crc16_reflect16(crc);
+    }
+
+    return crc;
+}
+
+uint16_t crc16_combine(crc16_id_t id, uint16_t crc_a, uint16_t crc_b, size_t len_b)
 {
-    /* Methode analog zum Reflect von 8 Bit, nur auf 16 Bit ausgeweitet */
-    x = (uint16_t)((x & 0xFF00) >> 8 | (x & 0x00FF) << 8);
-    x = (uint16_t)((x & 0xF0F0) >> 4 | (x & 0x0F0F) << 4);
-    x = (uint16_t)((x & 0xCCCC) >> 2 | (x & 0x3333) << 2);
-    x = (uint16_t)((x & 0xAAAA) >> 1 | (x & 0x5555) << 1);
-    return x;
+    const crc16_conf_t *conf = &crc16_conf[id];
+    uint16_t reg_a = crc16_kernel_definalize(conf->refout, conf->xorout, crc_a);
+    uint16_t reg_b = crc16_kernel_definalize(conf->refout, conf->xorout, crc_b);
+
+    /*
+        reg(A||B) = shift(reg(A), len_b) ^ reg(B) ^ shift(init, len_b), da reg(B)
+        ebenfalls mit init gestartet wurde. Die Verschiebung ist linear, also
+        reicht eine einzige Verschiebung von reg(A)^init.
+    */
+    reg_a = crc16_shift_zeros(conf->poly, reg_a ^ conf->init, len_b);
+
+    return crc16_kernel_finalize(conf->refout, conf->xorout, reg_a ^ reg_b);
 }
 
 
-uint16_t crc16_finalize (crc16_id_t id, uint16_t seed)
+#if defined(CRC16_ENABLE_PARALLEL)
+
+typedef struct {
+    crc16_id_t id;
+    uint8_t *data;
+    size_t size;
+    uint16_t crc;
+} crc16_parallel_job_t;
+
+static void* crc16_parallel_worker(void *arg)
 {
-    /* Wenn RefOut = true, erst den 16-Bit-Wert spiegeln */
-    if (crc16_conf[id].refout)
-    {
-        seed = crc16_reflect16(seed);
-    }
+    crc16_parallel_job_t *job = (crc16_parallel_job_t*)arg;
 
-    /* Dann den XorOut-Wert anwenden */
+    job->crc = crc16(job->id, job->data, job->size);
 
-    return seed^crc16_conf[id].xorout;
+    return NULL;
 }
 
-uint16_t crc16 (crc16_id_t id, uint8_t *data, size_t size)
+uint16_t crc16_parallel(crc16_id_t id, uint8_t *data, size_t size, unsigned threads)
 {
-    return crc16_finalize(id, crc16_update(id, crc16_conf[id].init, data, size));
+    crc16_parallel_job_t jobs[CRC16_PARALLEL_MAX_THREADS];
+    pthread_t workers[CRC16_PARALLEL_MAX_THREADS];
+    bool started[CRC16_PARALLEL_MAX_THREADS];
+    size_t chunk;
+    uint16_t crc;
+    unsigned n;
+
+    if (size < 2 * CRC16_PARALLEL_MIN_CHUNK)
+    {
+        return crc16(id, data, size);
+    }
+
+    if (threads == 0)
+    {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (cpus > 0) ? (unsigned)cpus : 1;
+    }
+
+    if (threads > CRC16_PARALLEL_MAX_THREADS)
+    {
+        threads = CRC16_PARALLEL_MAX_THREADS;
+    }
+
+    if (threads > size / CRC16_PARALLEL_MIN_CHUNK)
+    {
+        threads = (unsigned)(size / CRC16_PARALLEL_MIN_CHUNK);
+    }
+
+    if (threads < 2)
+    {
+        return crc16(id, data, size);
+    }
+
+    chunk = size / threads;
+
+    for (n = 0; n < threads; n++)
+    {
+        jobs[n].id = id;
+        jobs[n].data = data + n * chunk;
+        jobs[n].size = (n == threads - 1) ? size - n * chunk : chunk;
+    }
+
+    /* Der letzte Block wird im aufrufenden Thread berechnet */
+    for (n = 0; n < threads - 1; n++)
+    {
+        started[n] = (pthread_create(&workers[n], NULL, crc16_parallel_worker, &jobs[n]) == 0);
+
+        if (!started[n])
+        {
+            crc16_parallel_worker(&jobs[n]);
+        }
+    }
+
+    crc16_parallel_worker(&jobs[threads - 1]);
+
+    for (n = 0; n < threads - 1; n++)
+    {
+        if (started[n])
+        {
+            pthread_join(workers[n], NULL);
+        }
+    }
+
+    crc = jobs[0].crc;
+
+    for (n = 1; n < threads; n++)
+    {
+        crc = crc16_combine(id, crc, jobs[n].crc, jobs[n].size);
+    }
+
+    return crc;
 }
 
+#endif /* CRC16_ENABLE_PARALLEL */
+
+
+/* ohne CRC16_ENABLE_INLINE liegen die spezialisierten Einstiegspunkte hier */
+#if !defined(CRC16_ENABLE_INLINE)
+
+#if defined(CRC16_ENABLE_ARC) || defined(UNITTEST)
+CRC16_DEFINE(, arc, CRC16_ARC_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_CDMA2000) || defined(UNITTEST)
+CRC16_DEFINE(, cdma2000, CRC16_CDMA2000_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_CMS) || defined(UNITTEST)
+CRC16_DEFINE(, cms, CRC16_CMS_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_DDS_110) || defined(UNITTEST)
+CRC16_DEFINE(, dds_110, CRC16_DDS_110_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_DECT_R) || defined(UNITTEST)
+CRC16_DEFINE(, dect_r, CRC16_DECT_R_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_DECT_X) || defined(UNITTEST)
+CRC16_DEFINE(, dect_x, CRC16_DECT_X_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_DNP) || defined(UNITTEST)
+CRC16_DEFINE(, dnp, CRC16_DNP_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_EN_13757) || defined(UNITTEST)
+CRC16_DEFINE(, en_13757, CRC16_EN_13757_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_GENIBUS) || defined(UNITTEST)
+CRC16_DEFINE(, genibus, CRC16_GENIBUS_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_GSM) || defined(UNITTEST)
+CRC16_DEFINE(, gsm, CRC16_GSM_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_IBM_3740) || defined(UNITTEST)
+CRC16_DEFINE(, ibm_3740, CRC16_IBM_3740_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_IBM_SDLC) || defined(UNITTEST)
+CRC16_DEFINE(, ibm_sdlc, CRC16_IBM_SDLC_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_ISO_IEC_14443_3_A) || defined(UNITTEST)
+CRC16_DEFINE(, iso_iec_14443_3_a, CRC16_ISO_IEC_14443_3_A_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_KERMIT) || defined(UNITTEST)
+CRC16_DEFINE(, kermit, CRC16_KERMIT_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_LJ1200) || defined(UNITTEST)
+CRC16_DEFINE(, lj1200, CRC16_LJ1200_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_M17) || defined(UNITTEST)
+CRC16_DEFINE(, m17, CRC16_M17_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_MAXIM_DOW) || defined(UNITTEST)
+CRC16_DEFINE(, maxim_dow, CRC16_MAXIM_DOW_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_MCRF4XX) || defined(UNITTEST)
+CRC16_DEFINE(, mcrf4xx, CRC16_MCRF4XX_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_MODBUS) || defined(UNITTEST)
+CRC16_DEFINE(, modbus, CRC16_MODBUS_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_NRSC_5) || defined(UNITTEST)
+CRC16_DEFINE(, nrsc_5, CRC16_NRSC_5_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_OPENSAFETY_A) || defined(UNITTEST)
+CRC16_DEFINE(, opensafety_a, CRC16_OPENSAFETY_A_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_OPENSAFETY_B) || defined(UNITTEST)
+CRC16_DEFINE(, opensafety_b, CRC16_OPENSAFETY_B_PARAMS)
+#endif
 
+#if defined(CRC16_ENABLE_PROFIBUS) || defined(UNITTEST)
+CRC16_DEFINE(, profibus, CRC16_PROFIBUS_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_RIELLO) || defined(UNITTEST)
+CRC16_DEFINE(, riello, CRC16_RIELLO_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_SPI_FUJITSU) || defined(UNITTEST)
+CRC16_DEFINE(, spi_fujitsu, CRC16_SPI_FUJITSU_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_T10_DIF) || defined(UNITTEST)
+CRC16_DEFINE(, t10_dif, CRC16_T10_DIF_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_TELEDISK) || defined(UNITTEST)
+CRC16_DEFINE(, teledisk, CRC16_TELEDISK_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_TMS37157) || defined(UNITTEST)
+CRC16_DEFINE(, tms37157, CRC16_TMS37157_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_UMTS) || defined(UNITTEST)
+CRC16_DEFINE(, umts, CRC16_UMTS_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_USB) || defined(UNITTEST)
+CRC16_DEFINE(, usb, CRC16_USB_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_XMODEM) || defined(UNITTEST)
+CRC16_DEFINE(, xmodem, CRC16_XMODEM_PARAMS)
+#endif
 
+#endif /* !CRC16_ENABLE_INLINE */
 
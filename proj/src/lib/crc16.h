@@ -239,6 +239,49 @@ typedef struct {
 }crc16_conf_t;
 
 
+/*!
+    \brief Parameter sets of the catalogued CRC16 algorithms.
+
+    \details Each macro expands to the comma separated list
+    `poly, init, refin, refout, xorout` of one algorithm. They feed both the
+    runtime configuration table `crc16_conf[]` and the compile-time specialized
+    entry points generated by `CRC16_DECLARE`/`CRC16_DEFINE`, so the constants
+    are maintained in a single place.
+*/
+#define CRC16_ARC_PARAMS                     0x8005, 0x0000, true,  true,  0x0000
+#define CRC16_CDMA2000_PARAMS                0xC867, 0xFFFF, false, false, 0x0000
+#define CRC16_CMS_PARAMS                     0x8005, 0xFFFF, false, false, 0x0000
+#define CRC16_DDS_110_PARAMS                 0x8005, 0x800D, false, false, 0x0000
+#define CRC16_DECT_R_PARAMS                  0x0589, 0x0000, false, false, 0x0001
+#define CRC16_DECT_X_PARAMS                  0x0589, 0x0000, false, false, 0x0000
+#define CRC16_DNP_PARAMS                     0x3D65, 0x0000, true,  true,  0xFFFF
+#define CRC16_EN_13757_PARAMS                0x3D65, 0x0000, false, false, 0xFFFF
+#define CRC16_GENIBUS_PARAMS                 0x1021, 0xFFFF, false, false, 0xFFFF
+#define CRC16_GSM_PARAMS                     0x1021, 0x0000, false, false, 0xFFFF
+#define CRC16_IBM_3740_PARAMS                0x1021, 0xFFFF, false, false, 0x0000
+#define CRC16_IBM_SDLC_PARAMS                0x1021, 0xFFFF, true,  true,  0xFFFF
+#define CRC16_ISO_IEC_14443_3_A_PARAMS       0x1021, 0xC6C6, true,  true,  0x0000
+#define CRC16_KERMIT_PARAMS                  0x1021, 0x0000, true,  true,  0x0000
+#define CRC16_LJ1200_PARAMS                  0x6F63, 0x0000, false, false, 0x0000
+#define CRC16_M17_PARAMS                     0x5935, 0xFFFF, false, false, 0x0000
+#define CRC16_MAXIM_DOW_PARAMS               0x8005, 0x0000, true,  true,  0xFFFF
+#define CRC16_MCRF4XX_PARAMS                 0x1021, 0xFFFF, true,  true,  0x0000
+#define CRC16_MODBUS_PARAMS                  0x8005, 0xFFFF, true,  true,  0x0000
+#define CRC16_NRSC_5_PARAMS                  0x080B, 0xFFFF, true,  true,  0x0000
+#define CRC16_OPENSAFETY_A_PARAMS            0x5935, 0x0000, false, false, 0x0000
+#define CRC16_OPENSAFETY_B_PARAMS            0x755B, 0x0000, false, false, 0x0000
+#define CRC16_PROFIBUS_PARAMS                0x1DCF, 0xFFFF, false, false, 0xFFFF
+#define CRC16_RIELLO_PARAMS                  0x1021, 0xB2AA, true,  true,  0x0000
+#define CRC16_SPI_FUJITSU_PARAMS             0x1021, 0x1D0F, false, false, 0x0000
+#define CRC16_T10_DIF_PARAMS                 0x8BB7, 0x0000, false, false, 0x0000
+#define CRC16_TELEDISK_PARAMS                0xA097, 0x0000, false, false, 0x0000
+#define CRC16_TMS37157_PARAMS                0x1021, 0x89EC, true,  true,  0x0000
+#define CRC16_UMTS_PARAMS                    0x8005, 0x0000, false, false, 0x0000
+#define CRC16_USB_PARAMS                     0x8005, 0xFFFF, true,  true,  0xFFFF
+#define CRC16_XMODEM_PARAMS                  0x1021, 0x0000, false, false, 0x0000
+
+
+
 
 /*!
     \brief Accumulates a CRC16 checksum for a single byte.
@@ -287,4 +330,286 @@ int crc16_conf_count(void);
 uint16_t crc16 (crc16_id_t id, uint8_t *data, size_t size);
 
 
+/*!
+    \brief Combines the checksums of two consecutive data blocks.
+
+    \details Given `crc_a = crc16(id, A, len_a)` and `crc_b = crc16(id, B, len_b)`
+    this function returns `crc16(id, A||B, len_a + len_b)` without touching the
+    data again. Chunks can thus be checksummed independently, out of order or on
+    different threads, and merged afterwards.
+
+    As in zlib's `crc32_combine()`, the register of A is advanced over `len_b`
+    zero bytes by GF(2) matrix exponentiation, so the cost is O(log(len_b))
+    16x16 bit matrix squarings regardless of the block sizes. The algorithm's
+    init, refout and xorout parameters are taken into account.
+
+    \param id The CRC16 algorithm both checksums have been computed with.
+    \param crc_a The final CRC16 of the first block.
+    \param crc_b The final CRC16 of the second block.
+    \param len_b The length of the second block in bytes.
+
+    \return The final CRC16 of the concatenation of both blocks.
+*/
+uint16_t crc16_combine(crc16_id_t id, uint16_t crc_a, uint16_t crc_b, size_t len_b);
+
+
+/*!
+    \brief Accumulates a CRC16 checksum over a region of a circular byte array.
+
+    \details Processes `size` bytes starting at byte `offset` of `ring`, wrapping
+    around to the start of the array at its end. The data is walked in place as
+    at most two contiguous segments, so frames sitting in a ringbuffer can be
+    checked without copying them into a linear buffer first. See
+    `CRC16_UPDATE_RINGBUFFER` for the ringbuffer.h binding.
+
+    \param id The CRC16 algorithm to use.
+    \param seed The initial or previously accumulated register value.
+    \param ring Pointer to the first byte of the circular array.
+    \param ringsize The size of the circular array in bytes.
+    \param offset The byte offset of the first byte to process, larger offsets
+    wrap around modulo `ringsize`.
+    \param size The number of bytes to process, clamped to `ringsize` so that
+    every byte of the array is processed at most once.
+
+    \return The updated register value.
+*/
+uint16_t crc16_update_ring(crc16_id_t id, uint16_t seed, uint8_t *ring, size_t ringsize, size_t offset, size_t size);
+
+/*!
+    \brief Accumulates a CRC16 checksum over the oldest items of a ringbuffer.
+
+    \details Processes the raw bytes of the first `count` items starting at
+    `RINGBUFFER_HEAD` in place by `crc16_update_ring()`. The ringbuffer is not
+    modified, pop the items afterwards if required. Requires ringbuffer.h.
+
+    \param id The CRC16 algorithm to use.
+    \param seed The initial or previously accumulated register value.
+    \param ringbuffer The ringbuffer instance, see `RINGBUFFER_TYPEDEF`.
+    \param count The number of items to process, not more than `RINGBUFFER_COUNT(ringbuffer)`.
+
+    \return The updated register value.
+*/
+#define CRC16_UPDATE_RINGBUFFER(id,seed,ringbuffer,count) \
+    crc16_update_ring((id), (seed), \
+        RINGBUFFER_RAW(ringbuffer), \
+        RINGBUFFER_SIZEOF(ringbuffer), \
+        RINGBUFFER_HEAD(ringbuffer)*sizeof(RINGBUFFER_ITEMS(ringbuffer)[0]), \
+        (count)*sizeof(RINGBUFFER_ITEMS(ringbuffer)[0]))
+
+/*!
+    \brief Computes the CRC16 checksum of the oldest items of a ringbuffer.
+
+    \details One-shot variant of `CRC16_UPDATE_RINGBUFFER`, starting with the
+    algorithm's init value and returning the finalized checksum.
+
+    \param id The CRC16 algorithm to use.
+    \param ringbuffer The ringbuffer instance, see `RINGBUFFER_TYPEDEF`.
+    \param count The number of items to process, not more than `RINGBUFFER_COUNT(ringbuffer)`.
+
+    \return The CRC16 checksum of the items.
+*/
+#define CRC16_RINGBUFFER(id,ringbuffer,count) \
+    crc16_finalize((id), CRC16_UPDATE_RINGBUFFER((id), crc16_get_conf(id)->init, ringbuffer, count))
+
+
+#if defined(CRC16_ENABLE_PARALLEL)
+
+#ifndef CRC16_PARALLEL_MAX_THREADS
+#define CRC16_PARALLEL_MAX_THREADS 16   //!< Upper bound of worker threads used by crc16_parallel()
+#endif
+
+#ifndef CRC16_PARALLEL_MIN_CHUNK
+#define CRC16_PARALLEL_MIN_CHUNK 65536  //!< Smallest chunk in bytes worth handing to a worker thread
+#endif
+
+/*!
+    \brief Computes the CRC16 checksum of a large data array on several threads.
+
+    \details Only available on hosted builds (`CRC16_ENABLE_PARALLEL`, POSIX threads).
+    The data is split into up to `threads` equally sized chunks of at least
+    `CRC16_PARALLEL_MIN_CHUNK` bytes, each chunk is checksummed on its own thread
+    and the partial results are merged with `crc16_combine()`. Buffers too small
+    to split are processed by `crc16()` on the calling thread.
+
+    \param id The CRC16 algorithm to use.
+    \param data Pointer to the data array over which the CRC16 is to be computed.
+    \param size The size of the data array in bytes.
+    \param threads The number of threads to use, 0 selects the number of online processors.
+
+    \return The CRC16 checksum of the data array, identical to `crc16(id,data,size)`.
+*/
+uint16_t crc16_parallel(crc16_id_t id, uint8_t *data, size_t size, unsigned threads);
+
+#endif /* CRC16_ENABLE_PARALLEL */
+
+
+/*!
+    \brief Declares the compile-time specialized entry points of a CRC16 algorithm.
+
+    \details The generic API dispatches through a `crc16_id_t` and loads the
+    algorithm parameters from `crc16_conf[]` at runtime. The functions declared
+    by this macro have all parameters baked in as constants instead, which lets
+    the compiler fold and unroll the bitwise kernel. The register semantics are
+    identical to the generic API, i.e. `crc16_<name>_update()` may be freely
+    mixed with `crc16_update()` for the same algorithm.
+
+    For an algorithm `name` the following functions are declared:
+
+    - `uint16_t crc16_<name>_init(void)` returns the initial register value
+    - `uint16_t crc16_<name>_update_byte(uint16_t seed, uint8_t byte)`
+    - `uint16_t crc16_<name>_update(uint16_t seed, const uint8_t *data, size_t size)`
+    - `uint16_t crc16_<name>_finalize(uint16_t seed)`
+    - `uint16_t crc16_<name>(const uint8_t *data, size_t size)` computes the complete checksum
+
+    They are generated for every algorithm enabled by its `CRC16_ENABLE_<NAME>`
+    switch. With `CRC16_ENABLE_INLINE` (set by hosted builds) they are defined
+    `static inline` right here, so callers in any translation unit can inline
+    and unroll them, see crc16_kernel.h. Otherwise they are compiled once in
+    crc16.c, which keeps the code small on cc65.
+
+    \param name Lower case algorithm name, e.g. `modbus` or `xmodem`.
+*/
+#define CRC16_DECLARE(name) \
+    uint16_t crc16_##name##_init(void); \
+    uint16_t crc16_##name##_update_byte(uint16_t seed, uint8_t byte); \
+    uint16_t crc16_##name##_update(uint16_t seed, const uint8_t *data, size_t size); \
+    uint16_t crc16_##name##_finalize(uint16_t seed); \
+    uint16_t crc16_##name(const uint8_t *data, size_t size)
+
+/*!
+    \brief Defines or declares the specialized entry points of an enabled algorithm.
+*/
+#if defined(CRC16_ENABLE_INLINE)
+#include "crc16_kernel.h"
+#define CRC16_SPECIALIZE(name, params) CRC16_DEFINE_EXPANDED(static inline, name, params)
+#else
+#define CRC16_SPECIALIZE(name, params) CRC16_DECLARE(name);
+#endif
+
+#if defined(CRC16_ENABLE_ARC) || defined(UNITTEST)
+CRC16_SPECIALIZE(arc, CRC16_ARC_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_CDMA2000) || defined(UNITTEST)
+CRC16_SPECIALIZE(cdma2000, CRC16_CDMA2000_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_CMS) || defined(UNITTEST)
+CRC16_SPECIALIZE(cms, CRC16_CMS_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_DDS_110) || defined(UNITTEST)
+CRC16_SPECIALIZE(dds_110, CRC16_DDS_110_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_DECT_R) || defined(UNITTEST)
+CRC16_SPECIALIZE(dect_r, CRC16_DECT_R_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_DECT_X) || defined(UNITTEST)
+CRC16_SPECIALIZE(dect_x, CRC16_DECT_X_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_DNP) || defined(UNITTEST)
+CRC16_SPECIALIZE(dnp, CRC16_DNP_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_EN_13757) || defined(UNITTEST)
+CRC16_SPECIALIZE(en_13757, CRC16_EN_13757_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_GENIBUS) || defined(UNITTEST)
+CRC16_SPECIALIZE(genibus, CRC16_GENIBUS_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_GSM) || defined(UNITTEST)
+CRC16_SPECIALIZE(gsm, CRC16_GSM_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_IBM_3740) || defined(UNITTEST)
+CRC16_SPECIALIZE(ibm_3740, CRC16_IBM_3740_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_IBM_SDLC) || defined(UNITTEST)
+CRC16_SPECIALIZE(ibm_sdlc, CRC16_IBM_SDLC_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_ISO_IEC_14443_3_A) || defined(UNITTEST)
+CRC16_SPECIALIZE(iso_iec_14443_3_a, CRC16_ISO_IEC_14443_3_A_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_KERMIT) || defined(UNITTEST)
+CRC16_SPECIALIZE(kermit, CRC16_KERMIT_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_LJ1200) || defined(UNITTEST)
+CRC16_SPECIALIZE(lj1200, CRC16_LJ1200_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_M17) || defined(UNITTEST)
+CRC16_SPECIALIZE(m17, CRC16_M17_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_MAXIM_DOW) || defined(UNITTEST)
+CRC16_SPECIALIZE(maxim_dow, CRC16_MAXIM_DOW_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_MCRF4XX) || defined(UNITTEST)
+CRC16_SPECIALIZE(mcrf4xx, CRC16_MCRF4XX_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_MODBUS) || defined(UNITTEST)
+CRC16_SPECIALIZE(modbus, CRC16_MODBUS_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_NRSC_5) || defined(UNITTEST)
+CRC16_SPECIALIZE(nrsc_5, CRC16_NRSC_5_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_OPENSAFETY_A) || defined(UNITTEST)
+CRC16_SPECIALIZE(opensafety_a, CRC16_OPENSAFETY_A_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_OPENSAFETY_B) || defined(UNITTEST)
+CRC16_SPECIALIZE(opensafety_b, CRC16_OPENSAFETY_B_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_PROFIBUS) || defined(UNITTEST)
+CRC16_SPECIALIZE(profibus, CRC16_PROFIBUS_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_RIELLO) || defined(UNITTEST)
+CRC16_SPECIALIZE(riello, CRC16_RIELLO_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_SPI_FUJITSU) || defined(UNITTEST)
+CRC16_SPECIALIZE(spi_fujitsu, CRC16_SPI_FUJITSU_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_T10_DIF) || defined(UNITTEST)
+CRC16_SPECIALIZE(t10_dif, CRC16_T10_DIF_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_TELEDISK) || defined(UNITTEST)
+CRC16_SPECIALIZE(teledisk, CRC16_TELEDISK_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_TMS37157) || defined(UNITTEST)
+CRC16_SPECIALIZE(tms37157, CRC16_TMS37157_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_UMTS) || defined(UNITTEST)
+CRC16_SPECIALIZE(umts, CRC16_UMTS_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_USB) || defined(UNITTEST)
+CRC16_SPECIALIZE(usb, CRC16_USB_PARAMS)
+#endif
+
+#if defined(CRC16_ENABLE_XMODEM) || defined(UNITTEST)
+CRC16_SPECIALIZE(xmodem, CRC16_XMODEM_PARAMS)
+#endif
+
+
+
 #endif /* CRC16_H_ */
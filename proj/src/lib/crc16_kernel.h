@@ -0,0 +1,153 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       crc16_kernel.h
+
+    \brief      Bitwise CRC16 kernel shared by the generic and the specialized API.
+
+    \details    Included by crc16.c for the generic API. With `CRC16_ENABLE_INLINE`
+                crc16.h includes it as well and defines the specialized entry
+                points `crc16_<name>()` as `static inline` functions in every
+                translation unit, so protocol handlers can inline and unroll
+                the checksum of their algorithm. Without it (cc65, which has no
+                `inline`) the kernel is private to crc16.c and the specialized
+                entry points are compiled there once.
+*/
+
+#ifndef CRC16_KERNEL_H_
+#define CRC16_KERNEL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#if defined(CRC16_ENABLE_INLINE)
+#define CRC16_KERNEL static inline
+#else
+#define CRC16_KERNEL static
+#endif
+
+/* Hilfsfunktion zum Spiegeln eines Bytes (Bitreihenfolge umkehren) */
+CRC16_KERNEL uint8_t crc16_reflect8(uint8_t x)
+{
+    /* Variante mit „bitweiser“ Umkehr durch Masken und Verschieben */
+    x = (uint8_t)((x & 0xF0) >> 4 | (x & 0x0F) << 4);
+    x = (uint8_t)((x & 0xCC) >> 2 | (x & 0x33) << 2);
+    x = (uint8_t)((x & 0xAA) >> 1 | (x & 0x55) << 1);
+    return x;
+}
+
+/* Hilfsfunktion zum Spiegeln eines 16-Bit-Werts */
+CRC16_KERNEL uint16_t crc16_reflect16(uint16_t x)
+{
+    /* Methode analog zum Reflect von 8 Bit, nur auf 16 Bit ausgeweitet */
+    x = (uint16_t)((x & 0xFF00) >> 8 | (x & 0x00FF) << 8);
+    x = (uint16_t)((x & 0xF0F0) >> 4 | (x & 0x0F0F) << 4);
+    x = (uint16_t)((x & 0xCCCC) >> 2 | (x & 0x3333) << 2);
+    x = (uint16_t)((x & 0xAAAA) >> 1 | (x & 0x5555) << 1);
+    return x;
+}
+
+/*
+    Bitweiser Kern, gemeinsam genutzt von der generischen (id-basierten) und
+    den spezialisierten Varianten. Werden poly und refin als Konstanten
+    übergeben, kann der Compiler die Schleife vollständig auflösen.
+*/
+CRC16_KERNEL uint16_t crc16_kernel_update_byte(uint16_t poly, bool refin, uint16_t seed, uint8_t byte)
+{
+    unsigned char i;
+
+    /* Wenn RefIn = true, Byte vor der CRC-Berechnung spiegeln */
+    if (refin) {
+        byte = crc16_reflect8(byte);
+    }
+
+    seed ^= (uint16_t)byte << 8;
+
+    for (i = 0; i < 8; i++) {
+
+        if (seed & 0x8000){
+            seed = (uint16_t)((seed << 1) ^ poly);
+        }else{
+            seed = (uint16_t)(seed << 1);
+        }
+    }
+
+    return seed;
+}
+
+CRC16_KERNEL uint16_t crc16_kernel_finalize(bool refout, uint16_t xorout, uint16_t seed)
+{
+    /* Wenn RefOut = true, erst den 16-Bit-Wert spiegeln */
+    if (refout)
+    {
+        seed = crc16_reflect16(seed);
+    }
+
+    /* Dann den XorOut-Wert anwenden */
+
+    return seed^xorout;
+}
+
+/*
+    Erzeugt die spezialisierten Einstiegspunkte eines Algorithmus (siehe
+    CRC16_DECLARE) mit der Speicherklasse storage. Die zusätzliche Ebene sorgt
+    dafür, dass die Parameterliste CRC16_<NAME>_PARAMS vor der Übergabe
+    expandiert wird.
+*/
+#define CRC16_DEFINE(storage, name, params) \
+    CRC16_DEFINE_EXPANDED(storage, name, params)
+
+#define CRC16_DEFINE_EXPANDED(storage, name, poly, init, refin, refout, xorout) \
+    storage uint16_t crc16_##name##_init(void) \
+    { \
+        return (init); \
+    } \
+    storage uint16_t crc16_##name##_update_byte(uint16_t seed, uint8_t byte) \
+    { \
+        return crc16_kernel_update_byte((poly), (refin), seed, byte); \
+    } \
+    storage uint16_t crc16_##name##_update(uint16_t seed, const uint8_t *data, size_t size) \
+    { \
+        while (size--) \
+        { \
+            seed = crc16_kernel_update_byte((poly), (refin), seed, *data++); \
+        } \
+        return seed; \
+    } \
+    storage uint16_t crc16_##name##_finalize(uint16_t seed) \
+    { \
+        return crc16_kernel_finalize((refout), (xorout), seed); \
+    } \
+    storage uint16_t crc16_##name(const uint8_t *data, size_t size) \
+    { \
+        return crc16_##name##_finalize(crc16_##name##_update((init), data, size)); \
+    }
+
+#endif /* CRC16_KERNEL_H_ */
@@ -0,0 +1,430 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       crc32.c
+
+    \brief      Implementation of 32-bit Cyclic Redundancy Check (CRC32).
+
+    \details    see header file
+*/
+
+#if defined(CRC32_ENABLE_PTHREAD) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "crc32.h"
+
+#if defined(CRC32_ENABLE_TABLE) && defined(CRC32_ENABLE_PTHREAD)
+#include <pthread.h>
+#endif
+
+#if defined(CRC32_ENABLE_SSE42) && !(defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)))
+#undef CRC32_ENABLE_SSE42
+#endif
+
+#if defined(CRC32_ENABLE_SSE42)
+#include <string.h>
+#include <nmmintrin.h>
+#endif
+
+static const crc32_conf_t crc32_conf[] = {
+
+#if defined(CRC32_ENABLE_AIXM) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-32/AIXM",
+        0x007C2675,
+        0x3010BF7F,
+    #endif
+        CRC32_AIXM_PARAMS
+    },
+#endif
+
+#if defined(CRC32_ENABLE_AUTOSAR) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-32/AUTOSAR",
+        0x4B1CD472,
+        0x1697D06A,
+    #endif
+        CRC32_AUTOSAR_PARAMS
+    },
+#endif
+
+#if defined(CRC32_ENABLE_BASE91_D) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-32/BASE91-D",
+        0xD9C5B0CD,
+        0x87315576,
+    #endif
+        CRC32_BASE91_D_PARAMS
+    },
+#endif
+
+#if defined(CRC32_ENABLE_BZIP2) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-32/BZIP2",
+        0x6B1A7CAE,
+        0xFC891918,
+    #endif
+        CRC32_BZIP2_PARAMS
+    },
+#endif
+
+#if defined(CRC32_ENABLE_CD_ROM_EDC) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-32/CD-ROM-EDC",
+        0xF9058BB0,
+        0x6EC2EDC4,
+    #endif
+        CRC32_CD_ROM_EDC_PARAMS
+    },
+#endif
+
+#if defined(CRC32_ENABLE_CKSUM) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-32/CKSUM",
+        0x6286288F,
+        0x765E7680,
+    #endif
+        CRC32_CKSUM_PARAMS
+    },
+#endif
+
+#if defined(CRC32_ENABLE_ISCSI) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-32/ISCSI",
+        0xFE6CF1DC,
+        0xE3069283,
+    #endif
+        CRC32_ISCSI_PARAMS
+    },
+#endif
+
+#if defined(CRC32_ENABLE_ISO_HDLC) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-32/ISO-HDLC",
+        0x1C291CA3,
+        0xCBF43926,
+    #endif
+        CRC32_ISO_HDLC_PARAMS
+    },
+#endif
+
+#if defined(CRC32_ENABLE_JAMCRC) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-32/JAMCRC",
+        0xE3D6E35C,
+        0x340BC6D9,
+    #endif
+        CRC32_JAMCRC_PARAMS
+    },
+#endif
+
+#if defined(CRC32_ENABLE_MEF) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-32/MEF",
+        0x97E5CD47,
+        0xD2C22F51,
+    #endif
+        CRC32_MEF_PARAMS
+    },
+#endif
+
+#if defined(CRC32_ENABLE_MPEG_2) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-32/MPEG-2",
+        0x94E58351,
+        0x0376E6E7,
+    #endif
+        CRC32_MPEG_2_PARAMS
+    },
+#endif
+
+#if defined(CRC32_ENABLE_XFER) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-32/XFER",
+        0x8456EBB6,
+        0xBD0BE338,
+    #endif
+        CRC32_XFER_PARAMS
+    },
+#endif
+
+};
+
+#define CRC32_CONF_COUNT (sizeof(crc32_conf)/sizeof(*crc32_conf))
+
+
+const crc32_conf_t* crc32_get_conf(crc32_id_t id)
+{
+    if ( (size_t)id >= CRC32_CONF_COUNT )
+    {
+        return NULL;
+    }
+
+    return &crc32_conf[id];
+}
+
+int crc32_conf_count(void)
+{
+    return CRC32_CONF_COUNT;
+}
+
+/* Hilfsfunktion zum Spiegeln eines Bytes (Bitreihenfolge umkehren) */
+static uint8_t crc32_reflect8(uint8_t x)
+{
+    x = (uint8_t)((x & 0xF0) >> 4 | (x & 0x0F) << 4);
+    x = (uint8_t)((x & 0xCC) >> 2 | (x & 0x33) << 2);
+    x = (uint8_t)((x & 0xAA) >> 1 | (x & 0x55) << 1);
+    return x;
+}
+
+/* Hilfsfunktion zum Spiegeln eines 32-Bit-Werts */
+static uint32_t crc32_reflect32(uint32_t x)
+{
+    x = ((x & 0xFFFF0000UL) >> 16) | ((x & 0x0000FFFFUL) << 16);
+    x = ((x & 0xFF00FF00UL) >>  8) | ((x & 0x00FF00FFUL) <<  8);
+    x = ((x & 0xF0F0F0F0UL) >>  4) | ((x & 0x0F0F0F0FUL) <<  4);
+    x = ((x & 0xCCCCCCCCUL) >>  2) | ((x & 0x33333333UL) <<  2);
+    x = ((x & 0xAAAAAAAAUL) >>  1) | ((x & 0x55555555UL) <<  1);
+    return x;
+}
+
+/* Bitweiser Kern, arbeitet wie crc16 auf dem nicht gespiegelten Register */
+static uint32_t crc32_kernel_update_byte(uint32_t poly, bool refin, uint32_t seed, uint8_t byte)
+{
+    unsigned char i;
+
+    /* Wenn RefIn = true, Byte vor der CRC-Berechnung spiegeln */
+    if (refin) {
+        byte = crc32_reflect8(byte);
+    }
+
+    seed ^= (uint32_t)byte << 24;
+
+    for (i = 0; i < 8; i++) {
+
+        if (seed & 0x80000000UL){
+            seed = (seed << 1) ^ poly;
+        }else{
+            seed = (seed << 1);
+        }
+    }
+
+    return seed;
+}
+
+
+#if defined(CRC32_ENABLE_TABLE)
+
+static uint32_t crc32_tables[CRC32_CONF_COUNT][256];
+
+#if defined(CRC32_ENABLE_PTHREAD)
+static pthread_once_t crc32_tables_once = PTHREAD_ONCE_INIT;
+#else
+static bool crc32_tables_ready;
+#endif
+
+/*
+    Baut die Tabellen aller Algorithmen auf.
+    Für RefIn wird die Tabelle des gespiegelten Registers abgelegt (wie bei
+    zlib), sonst die des nicht gespiegelten Registers.
+*/
+static void crc32_tables_build(void)
+{
+    size_t id;
+    unsigned n;
+
+    for (id = 0; id < CRC32_CONF_COUNT; id++)
+    {
+        for (n = 0; n < 256; n++)
+        {
+            if (crc32_conf[id].refin)
+            {
+                crc32_tables[id][n] = crc32_reflect32(crc32_kernel_update_byte(crc32_conf[id].poly, false, 0, crc32_reflect8((uint8_t)n)));
+            }
+            else
+            {
+                crc32_tables[id][n] = crc32_kernel_update_byte(crc32_conf[id].poly, false, 0, (uint8_t)n);
+            }
+        }
+    }
+}
+
+#endif /* CRC32_ENABLE_TABLE */
+
+
+void crc32_init(void)
+{
+#if defined(CRC32_ENABLE_TABLE) && defined(CRC32_ENABLE_PTHREAD)
+    pthread_once(&crc32_tables_once, crc32_tables_build);
+#elif defined(CRC32_ENABLE_TABLE)
+    if (!crc32_tables_ready)
+    {
+        crc32_tables_build();
+        crc32_tables_ready = true;
+    }
+#endif
+}
+
+
+#if defined(CRC32_ENABLE_SSE42)
+
+/*
+    CRC-32C über den SSE4.2 Befehl crc32. Der Befehl arbeitet auf dem
+    gespiegelten Register ohne Init/XorOut, passt also zu jedem Algorithmus
+    mit dem Castagnoli Polynom und RefIn = true.
+*/
+__attribute__((target("sse4.2")))
+static uint32_t crc32_sse42_update(uint32_t seed, const uint8_t *data, size_t size)
+{
+    while (size && ((uintptr_t)data & 7))
+    {
+        seed = _mm_crc32_u8(seed, *data++);
+        size--;
+    }
+
+#if defined(__x86_64__)
+    {
+        uint64_t seed64 = seed;
+        uint64_t word;
+
+        while (size >= 8)
+        {
+            memcpy(&word, data, sizeof(word));
+            seed64 = _mm_crc32_u64(seed64, word);
+            data += 8;
+            size -= 8;
+        }
+
+        seed = (uint32_t)seed64;
+    }
+#else
+    {
+        uint32_t word;
+
+        while (size >= 4)
+        {
+            memcpy(&word, data, sizeof(word));
+            seed = _mm_crc32_u32(seed, word);
+            data += 4;
+            size -= 4;
+        }
+    }
+#endif
+
+    while (size--)
+    {
+        seed = _mm_crc32_u8(seed, *data++);
+    }
+
+    return seed;
+}
+
+#endif /* CRC32_ENABLE_SSE42 */
+
+
+uint32_t crc32_update_byte(crc32_id_t id, uint32_t seed, uint8_t byte)
+{
+    return crc32_kernel_update_byte(crc32_conf[id].poly, crc32_conf[id].refin, seed, byte);
+}
+
+uint32_t crc32_update(crc32_id_t id, uint32_t seed, const uint8_t *data, size_t size)
+{
+    const crc32_conf_t *conf = &crc32_conf[id];
+
+#if defined(CRC32_ENABLE_SSE42)
+    if (conf->refin && conf->poly == CRC32_POLY_CASTAGNOLI && __builtin_cpu_supports("sse4.2"))
+    {
+        return crc32_reflect32(crc32_sse42_update(crc32_reflect32(seed), data, size));
+    }
+#endif
+
+#if defined(CRC32_ENABLE_TABLE)
+    {
+        const uint32_t *table = crc32_tables[id];
+
+        crc32_init();
+
+        /* Bei RefIn nur einmal pro Aufruf in das gespiegelte Register wechseln */
+        if (conf->refin)
+        {
+            seed = crc32_reflect32(seed);
+
+            while (size--)
+            {
+                seed = (seed >> 8) ^ table[(seed ^ *data++) & 0xFF];
+            }
+
+            return crc32_reflect32(seed);
+        }
+
+        while (size--)
+        {
+            seed = (seed << 8) ^ table[((seed >> 24) ^ *data++) & 0xFF];
+        }
+
+        return seed;
+    }
+#else
+    while (size--)
+    {
+        seed = crc32_kernel_update_byte(conf->poly, conf->refin, seed, *data++);
+    }
+
+    return seed;
+#endif
+}
+
+uint32_t crc32_finalize(crc32_id_t id, uint32_t seed)
+{
+    /* Wenn RefOut = true, erst das Register spiegeln */
+    if (crc32_conf[id].refout)
+    {
+        seed = crc32_reflect32(seed);
+    }
+
+    return seed^crc32_conf[id].xorout;
+}
+
+uint32_t crc32(crc32_id_t id, const uint8_t *data, size_t size)
+{
+    return crc32_finalize(id, crc32_update(id, crc32_conf[id].init, data, size));
+}
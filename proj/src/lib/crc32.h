@@ -0,0 +1,234 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file crc32.h
+
+    \brief Implementation of 32-bit Cyclic Redundancy Check (CRC32).
+
+    \details CRC-32 checksums are typically used on storage records and larger
+    frames (Ethernet, zip, iSCSI, ext4, ...). CRC-32/ISCSI is also known as CRC-32C.
+
+    The catalogue, the `CRC32_ENABLE_<NAME>` switches and the API follow crc16.h,
+    see there for a general description of cyclic redundancy checks. Result is
+    the checksum of "Hello World!", Check the checksum of "123456789".
+
+    Kernels:
+    - bitwise, without any lookup table (default, suited for small targets)
+    - table driven, enabled by `CRC32_ENABLE_TABLE`. A 1 KiB table per enabled
+      algorithm is built in RAM by `crc32_init()`, which `crc32_update()` calls
+      itself. With `CRC32_ENABLE_PTHREAD` the tables are built exactly once by
+      `pthread_once()`, so the first checksum may be computed by any thread.
+      Without it, call `crc32_init()` once before computing checksums from
+      several threads.
+    - SSE4.2 `crc32` instruction, enabled by `CRC32_ENABLE_SSE42` on x86 with
+      GCC or Clang. It is used for all algorithms with the Castagnoli polynomial
+      (`CRC32_POLY_CASTAGNOLI`, e.g. CRC-32/ISCSI) if the CPU supports SSE4.2 at
+      runtime, the other kernels are used otherwise.
+
+| CRC-32                     | Result     | Check      | Poly       | Init       | RefIn | RefOut | XorOut     |
+|----------------------------|------------|------------|------------|------------|-------|--------|------------|
+| CRC-32/AIXM                | 0x007C2675 | 0x3010BF7F | 0x814141AB | 0x00000000 | false | false  | 0x00000000 |
+| CRC-32/AUTOSAR             | 0x4B1CD472 | 0x1697D06A | 0xF4ACFB13 | 0xFFFFFFFF | true  | true   | 0xFFFFFFFF |
+| CRC-32/BASE91-D            | 0xD9C5B0CD | 0x87315576 | 0xA833982B | 0xFFFFFFFF | true  | true   | 0xFFFFFFFF |
+| CRC-32/BZIP2               | 0x6B1A7CAE | 0xFC891918 | 0x04C11DB7 | 0xFFFFFFFF | false | false  | 0xFFFFFFFF |
+| CRC-32/CD-ROM-EDC          | 0xF9058BB0 | 0x6EC2EDC4 | 0x8001801B | 0x00000000 | true  | true   | 0x00000000 |
+| CRC-32/CKSUM               | 0x6286288F | 0x765E7680 | 0x04C11DB7 | 0x00000000 | false | false  | 0xFFFFFFFF |
+| CRC-32/ISCSI               | 0xFE6CF1DC | 0xE3069283 | 0x1EDC6F41 | 0xFFFFFFFF | true  | true   | 0xFFFFFFFF |
+| CRC-32/ISO-HDLC            | 0x1C291CA3 | 0xCBF43926 | 0x04C11DB7 | 0xFFFFFFFF | true  | true   | 0xFFFFFFFF |
+| CRC-32/JAMCRC              | 0xE3D6E35C | 0x340BC6D9 | 0x04C11DB7 | 0xFFFFFFFF | true  | true   | 0x00000000 |
+| CRC-32/MEF                 | 0x97E5CD47 | 0xD2C22F51 | 0x741B8CD7 | 0xFFFFFFFF | true  | true   | 0x00000000 |
+| CRC-32/MPEG-2              | 0x94E58351 | 0x0376E6E7 | 0x04C11DB7 | 0xFFFFFFFF | false | false  | 0x00000000 |
+| CRC-32/XFER                | 0x8456EBB6 | 0xBD0BE338 | 0x000000AF | 0x00000000 | false | false  | 0x00000000 |
+
+
+*/
+
+
+#ifndef CRC32_H_
+#define CRC32_H_
+#include <stdint.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+typedef enum
+{
+#if defined(CRC32_ENABLE_AIXM) || defined(UNITTEST)
+    CRC32_AIXM,
+#endif
+
+#if defined(CRC32_ENABLE_AUTOSAR) || defined(UNITTEST)
+    CRC32_AUTOSAR,
+#endif
+
+#if defined(CRC32_ENABLE_BASE91_D) || defined(UNITTEST)
+    CRC32_BASE91_D,
+#endif
+
+#if defined(CRC32_ENABLE_BZIP2) || defined(UNITTEST)
+    CRC32_BZIP2,
+#endif
+
+#if defined(CRC32_ENABLE_CD_ROM_EDC) || defined(UNITTEST)
+    CRC32_CD_ROM_EDC,
+#endif
+
+#if defined(CRC32_ENABLE_CKSUM) || defined(UNITTEST)
+    CRC32_CKSUM,
+#endif
+
+#if defined(CRC32_ENABLE_ISCSI) || defined(UNITTEST)
+    CRC32_ISCSI,
+#endif
+
+#if defined(CRC32_ENABLE_ISO_HDLC) || defined(UNITTEST)
+    CRC32_ISO_HDLC,
+#endif
+
+#if defined(CRC32_ENABLE_JAMCRC) || defined(UNITTEST)
+    CRC32_JAMCRC,
+#endif
+
+#if defined(CRC32_ENABLE_MEF) || defined(UNITTEST)
+    CRC32_MEF,
+#endif
+
+#if defined(CRC32_ENABLE_MPEG_2) || defined(UNITTEST)
+    CRC32_MPEG_2,
+#endif
+
+#if defined(CRC32_ENABLE_XFER) || defined(UNITTEST)
+    CRC32_XFER,
+#endif
+
+} crc32_id_t;
+
+
+typedef struct {
+#ifdef UNITTEST
+    char *text;
+    uint32_t result;
+    uint32_t check;
+#endif
+    uint32_t poly;
+    uint32_t init;
+    bool refin;
+    bool refout;
+    uint32_t xorout;
+}crc32_conf_t;
+
+
+/*!
+    \brief Parameter sets of the catalogued CRC32 algorithms.
+
+    \details Each macro expands to the comma separated list
+    `poly, init, refin, refout, xorout` of one algorithm, see crc16.h.
+*/
+#define CRC32_AIXM_PARAMS                    0x814141AB, 0x00000000, false, false, 0x00000000
+#define CRC32_AUTOSAR_PARAMS                 0xF4ACFB13, 0xFFFFFFFF, true,  true,  0xFFFFFFFF
+#define CRC32_BASE91_D_PARAMS                0xA833982B, 0xFFFFFFFF, true,  true,  0xFFFFFFFF
+#define CRC32_BZIP2_PARAMS                   0x04C11DB7, 0xFFFFFFFF, false, false, 0xFFFFFFFF
+#define CRC32_CD_ROM_EDC_PARAMS              0x8001801B, 0x00000000, true,  true,  0x00000000
+#define CRC32_CKSUM_PARAMS                   0x04C11DB7, 0x00000000, false, false, 0xFFFFFFFF
+#define CRC32_ISCSI_PARAMS                   0x1EDC6F41, 0xFFFFFFFF, true,  true,  0xFFFFFFFF
+#define CRC32_ISO_HDLC_PARAMS                0x04C11DB7, 0xFFFFFFFF, true,  true,  0xFFFFFFFF
+#define CRC32_JAMCRC_PARAMS                  0x04C11DB7, 0xFFFFFFFF, true,  true,  0x00000000
+#define CRC32_MEF_PARAMS                     0x741B8CD7, 0xFFFFFFFF, true,  true,  0x00000000
+#define CRC32_MPEG_2_PARAMS                  0x04C11DB7, 0xFFFFFFFF, false, false, 0x00000000
+#define CRC32_XFER_PARAMS                    0x000000AF, 0x00000000, false, false, 0x00000000
+
+
+/*!
+    \brief Builds the lookup tables of the table driven kernel.
+
+    \details Does nothing without `CRC32_ENABLE_TABLE` or if the tables are
+    already built. Only needed before computing the first checksums from
+    several threads at once if `CRC32_ENABLE_PTHREAD` is not set.
+*/
+void crc32_init(void);
+
+/*!
+    \brief Accumulates a CRC32 checksum for a single byte.
+
+    \details Uses the bitwise kernel, which needs no lookup table.
+
+    \param id The CRC32 algorithm to use.
+    \param seed The initial or previously accumulated register value.
+    \param byte The byte of data to be accumulated.
+
+    \return The updated register value.
+*/
+uint32_t crc32_update_byte(crc32_id_t id, uint32_t seed, uint8_t byte);
+
+/*!
+    \brief Accumulates a CRC32 checksum over a data array.
+
+    \details Uses the fastest kernel available for the algorithm, see the
+    file description. The register value is compatible with `crc32_update_byte()`.
+
+    \param id The CRC32 algorithm to use.
+    \param seed The initial or previously accumulated register value.
+    \param data Pointer to the data array.
+    \param size The size of the data array in bytes.
+
+    \return The updated register value.
+*/
+uint32_t crc32_update(crc32_id_t id, uint32_t seed, const uint8_t *data, size_t size);
+
+/*!
+    \brief Applies RefOut and XorOut to an accumulated register value.
+
+    \param id The CRC32 algorithm to use.
+    \param seed The accumulated register value.
+
+    \return The final CRC32 checksum.
+*/
+uint32_t crc32_finalize(crc32_id_t id, uint32_t seed);
+
+const crc32_conf_t* crc32_get_conf(crc32_id_t id);
+int crc32_conf_count(void);
+
+/*!
+    \brief Computes the CRC32 checksum of a data array.
+
+    \param id The CRC32 algorithm to use.
+    \param data Pointer to the data array over which the CRC32 is to be computed.
+    \param size The size of the data array in bytes.
+
+    \return The CRC32 checksum of the data array.
+*/
+uint32_t crc32(crc32_id_t id, const uint8_t *data, size_t size);
+
+/*!
+    \brief Castagnoli polynomial of CRC-32C, computed in hardware by SSE4.2.
+*/
+#define CRC32_POLY_CASTAGNOLI 0x1EDC6F41UL
+
+
+#endif /* CRC32_H_ */
@@ -0,0 +1,434 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       crc8.c
+
+    \brief      Implementation of 8-bit Cyclic Redundancy Check (CRC8).
+
+    \details    see header file
+*/
+
+#if defined(CRC8_ENABLE_PTHREAD) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "crc8.h"
+
+#if defined(CRC8_ENABLE_TABLE) && defined(CRC8_ENABLE_PTHREAD)
+#include <pthread.h>
+#endif
+
+static const crc8_conf_t crc8_conf[] = {
+
+#if defined(CRC8_ENABLE_AUTOSAR) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-8/AUTOSAR",
+        0x37,
+        0xDF,
+    #endif
+        CRC8_AUTOSAR_PARAMS
+    },
+#endif
+
+#if defined(CRC8_ENABLE_BLUETOOTH) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-8/BLUETOOTH",
+        0x51,
+        0x26,
+    #endif
+        CRC8_BLUETOOTH_PARAMS
+    },
+#endif
+
+#if defined(CRC8_ENABLE_CDMA2000) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-8/CDMA2000",
+        0x23,
+        0xDA,
+    #endif
+        CRC8_CDMA2000_PARAMS
+    },
+#endif
+
+#if defined(CRC8_ENABLE_DARC) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-8/DARC",
+        0x3E,
+        0x15,
+    #endif
+        CRC8_DARC_PARAMS
+    },
+#endif
+
+#if defined(CRC8_ENABLE_DVB_S2) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-8/DVB-S2",
+        0x29,
+        0xBC,
+    #endif
+        CRC8_DVB_S2_PARAMS
+    },
+#endif
+
+#if defined(CRC8_ENABLE_GSM_A) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-8/GSM-A",
+        0xB2,
+        0x37,
+    #endif
+        CRC8_GSM_A_PARAMS
+    },
+#endif
+
+#if defined(CRC8_ENABLE_GSM_B) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-8/GSM-B",
+        0xE0,
+        0x94,
+    #endif
+        CRC8_GSM_B_PARAMS
+    },
+#endif
+
+#if defined(CRC8_ENABLE_HITAG) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-8/HITAG",
+        0xFE,
+        0xB4,
+    #endif
+        CRC8_HITAG_PARAMS
+    },
+#endif
+
+#if defined(CRC8_ENABLE_I_432_1) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-8/I-432-1",
+        0x49,
+        0xA1,
+    #endif
+        CRC8_I_432_1_PARAMS
+    },
+#endif
+
+#if defined(CRC8_ENABLE_I_CODE) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-8/I-CODE",
+        0x51,
+        0x7E,
+    #endif
+        CRC8_I_CODE_PARAMS
+    },
+#endif
+
+#if defined(CRC8_ENABLE_LTE) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-8/LTE",
+        0x76,
+        0xEA,
+    #endif
+        CRC8_LTE_PARAMS
+    },
+#endif
+
+#if defined(CRC8_ENABLE_MAXIM_DOW) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-8/MAXIM-DOW",
+        0x9E,
+        0xA1,
+    #endif
+        CRC8_MAXIM_DOW_PARAMS
+    },
+#endif
+
+#if defined(CRC8_ENABLE_MIFARE_MAD) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-8/MIFARE-MAD",
+        0x4B,
+        0x99,
+    #endif
+        CRC8_MIFARE_MAD_PARAMS
+    },
+#endif
+
+#if defined(CRC8_ENABLE_NRSC_5) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-8/NRSC-5",
+        0x26,
+        0xF7,
+    #endif
+        CRC8_NRSC_5_PARAMS
+    },
+#endif
+
+#if defined(CRC8_ENABLE_OPENSAFETY) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-8/OPENSAFETY",
+        0x7C,
+        0x3E,
+    #endif
+        CRC8_OPENSAFETY_PARAMS
+    },
+#endif
+
+#if defined(CRC8_ENABLE_ROHC) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-8/ROHC",
+        0x4C,
+        0xD0,
+    #endif
+        CRC8_ROHC_PARAMS
+    },
+#endif
+
+#if defined(CRC8_ENABLE_SAE_J1850) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-8/SAE-J1850",
+        0x01,
+        0x4B,
+    #endif
+        CRC8_SAE_J1850_PARAMS
+    },
+#endif
+
+#if defined(CRC8_ENABLE_SMBUS) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-8/SMBUS",
+        0x1C,
+        0xF4,
+    #endif
+        CRC8_SMBUS_PARAMS
+    },
+#endif
+
+#if defined(CRC8_ENABLE_TECH_3250) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-8/TECH-3250",
+        0x07,
+        0x97,
+    #endif
+        CRC8_TECH_3250_PARAMS
+    },
+#endif
+
+#if defined(CRC8_ENABLE_WCDMA) || defined(UNITTEST)
+    {
+    #ifdef UNITTEST
+        "CRC-8/WCDMA",
+        0x75,
+        0x25,
+    #endif
+        CRC8_WCDMA_PARAMS
+    },
+#endif
+
+};
+
+#define CRC8_CONF_COUNT (sizeof(crc8_conf)/sizeof(*crc8_conf))
+
+
+const crc8_conf_t* crc8_get_conf(crc8_id_t id)
+{
+    if ( (size_t)id >= CRC8_CONF_COUNT )
+    {
+        return NULL;
+    }
+
+    return &crc8_conf[id];
+}
+
+int crc8_conf_count(void)
+{
+    return CRC8_CONF_COUNT;
+}
+
+/* Hilfsfunktion zum Spiegeln eines Bytes (Bitreihenfolge umkehren) */
+static uint8_t crc8_reflect8(uint8_t x)
+{
+    x = (uint8_t)((x & 0xF0) >> 4 | (x & 0x0F) << 4);
+    x = (uint8_t)((x & 0xCC) >> 2 | (x & 0x33) << 2);
+    x = (uint8_t)((x & 0xAA) >> 1 | (x & 0x55) << 1);
+    return x;
+}
+
+/* Bitweiser Kern, arbeitet wie crc16 auf dem nicht gespiegelten Register */
+static uint8_t crc8_kernel_update_byte(uint8_t poly, bool refin, uint8_t seed, uint8_t byte)
+{
+    unsigned char i;
+
+    /* Wenn RefIn = true, Byte vor der CRC-Berechnung spiegeln */
+    if (refin) {
+        byte = crc8_reflect8(byte);
+    }
+
+    seed ^= byte;
+
+    for (i = 0; i < 8; i++) {
+
+        if (seed & 0x80){
+            seed = (uint8_t)((seed << 1) ^ poly);
+        }else{
+            seed = (uint8_t)(seed << 1);
+        }
+    }
+
+    return seed;
+}
+
+
+#if defined(CRC8_ENABLE_TABLE)
+
+static uint8_t crc8_tables[CRC8_CONF_COUNT][256];
+
+#if defined(CRC8_ENABLE_PTHREAD)
+static pthread_once_t crc8_tables_once = PTHREAD_ONCE_INIT;
+#else
+static bool crc8_tables_ready;
+#endif
+
+/*
+    Baut die Tabellen aller Algorithmen auf.
+    Bei einem 8-Bit Register ist das Register selbst der Tabellenindex. Für
+    RefIn wird die Tabelle des gespiegelten Registers abgelegt, damit die
+    Eingangsbytes nicht einzeln gespiegelt werden müssen.
+*/
+static void crc8_tables_build(void)
+{
+    size_t id;
+    unsigned n;
+
+    for (id = 0; id < CRC8_CONF_COUNT; id++)
+    {
+        for (n = 0; n < 256; n++)
+        {
+            if (crc8_conf[id].refin)
+            {
+                crc8_tables[id][n] = crc8_reflect8(crc8_kernel_update_byte(crc8_conf[id].poly, false, 0, crc8_reflect8((uint8_t)n)));
+            }
+            else
+            {
+                crc8_tables[id][n] = crc8_kernel_update_byte(crc8_conf[id].poly, false, 0, (uint8_t)n);
+            }
+        }
+    }
+}
+
+#endif /* CRC8_ENABLE_TABLE */
+
+
+void crc8_init(void)
+{
+#if defined(CRC8_ENABLE_TABLE) && defined(CRC8_ENABLE_PTHREAD)
+    pthread_once(&crc8_tables_once, crc8_tables_build);
+#elif defined(CRC8_ENABLE_TABLE)
+    if (!crc8_tables_ready)
+    {
+        crc8_tables_build();
+        crc8_tables_ready = true;
+    }
+#endif
+}
+
+
+uint8_t crc8_update_byte(crc8_id_t id, uint8_t seed, uint8_t byte)
+{
+    return crc8_kernel_update_byte(crc8_conf[id].poly, crc8_conf[id].refin, seed, byte);
+}
+
+uint8_t crc8_update(crc8_id_t id, uint8_t seed, const uint8_t *data, size_t size)
+{
+    const crc8_conf_t *conf = &crc8_conf[id];
+
+#if defined(CRC8_ENABLE_TABLE)
+    const uint8_t *table = crc8_tables[id];
+
+    crc8_init();
+
+    /* Bei RefIn nur einmal pro Aufruf in das gespiegelte Register wechseln */
+    if (conf->refin)
+    {
+        seed = crc8_reflect8(seed);
+
+        while (size--)
+        {
+            seed = table[seed ^ *data++];
+        }
+
+        return crc8_reflect8(seed);
+    }
+
+    while (size--)
+    {
+        seed = table[seed ^ *data++];
+    }
+
+    return seed;
+#else
+    while (size--)
+    {
+        seed = crc8_kernel_update_byte(conf->poly, conf->refin, seed, *data++);
+    }
+
+    return seed;
+#endif
+}
+
+uint8_t crc8_finalize(crc8_id_t id, uint8_t seed)
+{
+    /* Wenn RefOut = true, erst das Register spiegeln */
+    if (crc8_conf[id].refout)
+    {
+        seed = crc8_reflect8(seed);
+    }
+
+    return seed^crc8_conf[id].xorout;
+}
+
+uint8_t crc8(crc8_id_t id, const uint8_t *data, size_t size)
+{
+    return crc8_finalize(id, crc8_update(id, crc8_conf[id].init, data, size));
+}
@@ -0,0 +1,273 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file crc8.h
+
+    \brief Implementation of 8-bit Cyclic Redundancy Check (CRC8).
+
+    \details CRC-8 checksums are typically used on short frames of sensor and field
+    buses (SMBus, 1-Wire, SAE J1850, AUTOSAR, ...).
+
+    The catalogue, the `CRC8_ENABLE_<NAME>` switches and the API follow crc16.h,
+    see there for a general description of cyclic redundancy checks. Result is
+    the checksum of "Hello World!", Check the checksum of "123456789".
+
+    Kernels:
+    - bitwise, without any lookup table (default, suited for small targets)
+    - table driven, enabled by `CRC8_ENABLE_TABLE`. A 256 byte table per enabled
+      algorithm is built in RAM by `crc8_init()`, which `crc8_update()` calls
+      itself. With `CRC8_ENABLE_PTHREAD` the tables are built exactly once by
+      `pthread_once()`, so the first checksum may be computed by any thread.
+      Without it, call `crc8_init()` once before computing checksums from
+      several threads.
+
+| CRC-8                      | Result | Check | Poly | Init | RefIn | RefOut | XorOut |
+|----------------------------|------|------|------|------|-------|--------|------|
+| CRC-8/AUTOSAR              | 0x37 | 0xDF | 0x2F | 0xFF | false | false  | 0xFF |
+| CRC-8/BLUETOOTH            | 0x51 | 0x26 | 0xA7 | 0x00 | true  | true   | 0x00 |
+| CRC-8/CDMA2000             | 0x23 | 0xDA | 0x9B | 0xFF | false | false  | 0x00 |
+| CRC-8/DARC                 | 0x3E | 0x15 | 0x39 | 0x00 | true  | true   | 0x00 |
+| CRC-8/DVB-S2               | 0x29 | 0xBC | 0xD5 | 0x00 | false | false  | 0x00 |
+| CRC-8/GSM-A                | 0xB2 | 0x37 | 0x1D | 0x00 | false | false  | 0x00 |
+| CRC-8/GSM-B                | 0xE0 | 0x94 | 0x49 | 0x00 | false | false  | 0xFF |
+| CRC-8/HITAG                | 0xFE | 0xB4 | 0x1D | 0xFF | false | false  | 0x00 |
+| CRC-8/I-432-1              | 0x49 | 0xA1 | 0x07 | 0x00 | false | false  | 0x55 |
+| CRC-8/I-CODE               | 0x51 | 0x7E | 0x1D | 0xFD | false | false  | 0x00 |
+| CRC-8/LTE                  | 0x76 | 0xEA | 0x9B | 0x00 | false | false  | 0x00 |
+| CRC-8/MAXIM-DOW            | 0x9E | 0xA1 | 0x31 | 0x00 | true  | true   | 0x00 |
+| CRC-8/MIFARE-MAD           | 0x4B | 0x99 | 0x1D | 0xC7 | false | false  | 0x00 |
+| CRC-8/NRSC-5               | 0x26 | 0xF7 | 0x31 | 0xFF | false | false  | 0x00 |
+| CRC-8/OPENSAFETY           | 0x7C | 0x3E | 0x2F | 0x00 | false | false  | 0x00 |
+| CRC-8/ROHC                 | 0x4C | 0xD0 | 0x07 | 0xFF | true  | true   | 0x00 |
+| CRC-8/SAE-J1850            | 0x01 | 0x4B | 0x1D | 0xFF | false | false  | 0xFF |
+| CRC-8/SMBUS                | 0x1C | 0xF4 | 0x07 | 0x00 | false | false  | 0x00 |
+| CRC-8/TECH-3250            | 0x07 | 0x97 | 0x1D | 0xFF | true  | true   | 0x00 |
+| CRC-8/WCDMA                | 0x75 | 0x25 | 0x9B | 0x00 | true  | true   | 0x00 |
+
+
+*/
+
+
+#ifndef CRC8_H_
+#define CRC8_H_
+#include <stdint.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+typedef enum
+{
+#if defined(CRC8_ENABLE_AUTOSAR) || defined(UNITTEST)
+    CRC8_AUTOSAR,
+#endif
+
+#if defined(CRC8_ENABLE_BLUETOOTH) || defined(UNITTEST)
+    CRC8_BLUETOOTH,
+#endif
+
+#if defined(CRC8_ENABLE_CDMA2000) || defined(UNITTEST)
+    CRC8_CDMA2000,
+#endif
+
+#if defined(CRC8_ENABLE_DARC) || defined(UNITTEST)
+    CRC8_DARC,
+#endif
+
+#if defined(CRC8_ENABLE_DVB_S2) || defined(UNITTEST)
+    CRC8_DVB_S2,
+#endif
+
+#if defined(CRC8_ENABLE_GSM_A) || defined(UNITTEST)
+    CRC8_GSM_A,
+#endif
+
+#if defined(CRC8_ENABLE_GSM_B) || defined(UNITTEST)
+    CRC8_GSM_B,
+#endif
+
+#if defined(CRC8_ENABLE_HITAG) || defined(UNITTEST)
+    CRC8_HITAG,
+#endif
+
+#if defined(CRC8_ENABLE_I_432_1) || defined(UNITTEST)
+    CRC8_I_432_1,
+#endif
+
+#if defined(CRC8_ENABLE_I_CODE) || defined(UNITTEST)
+    CRC8_I_CODE,
+#endif
+
+#if defined(CRC8_ENABLE_LTE) || defined(UNITTEST)
+    CRC8_LTE,
+#endif
+
+#if defined(CRC8_ENABLE_MAXIM_DOW) || defined(UNITTEST)
+    CRC8_MAXIM_DOW,
+#endif
+
+#if defined(CRC8_ENABLE_MIFARE_MAD) || defined(UNITTEST)
+    CRC8_MIFARE_MAD,
+#endif
+
+#if defined(CRC8_ENABLE_NRSC_5) || defined(UNITTEST)
+    CRC8_NRSC_5,
+#endif
+
+#if defined(CRC8_ENABLE_OPENSAFETY) || defined(UNITTEST)
+    CRC8_OPENSAFETY,
+#endif
+
+#if defined(CRC8_ENABLE_ROHC) || defined(UNITTEST)
+    CRC8_ROHC,
+#endif
+
+#if defined(CRC8_ENABLE_SAE_J1850) || defined(UNITTEST)
+    CRC8_SAE_J1850,
+#endif
+
+#if defined(CRC8_ENABLE_SMBUS) || defined(UNITTEST)
+    CRC8_SMBUS,
+#endif
+
+#if defined(CRC8_ENABLE_TECH_3250) || defined(UNITTEST)
+    CRC8_TECH_3250,
+#endif
+
+#if defined(CRC8_ENABLE_WCDMA) || defined(UNITTEST)
+    CRC8_WCDMA,
+#endif
+
+} crc8_id_t;
+
+
+typedef struct {
+#ifdef UNITTEST
+    char *text;
+    uint8_t result;
+    uint8_t check;
+#endif
+    uint8_t poly;
+    uint8_t init;
+    bool refin;
+    bool refout;
+    uint8_t xorout;
+}crc8_conf_t;
+
+
+/*!
+    \brief Parameter sets of the catalogued CRC8 algorithms.
+
+    \details Each macro expands to the comma separated list
+    `poly, init, refin, refout, xorout` of one algorithm, see crc16.h.
+*/
+#define CRC8_AUTOSAR_PARAMS                  0x2F, 0xFF, false, false, 0xFF
+#define CRC8_BLUETOOTH_PARAMS                0xA7, 0x00, true,  true,  0x00
+#define CRC8_CDMA2000_PARAMS                 0x9B, 0xFF, false, false, 0x00
+#define CRC8_DARC_PARAMS                     0x39, 0x00, true,  true,  0x00
+#define CRC8_DVB_S2_PARAMS                   0xD5, 0x00, false, false, 0x00
+#define CRC8_GSM_A_PARAMS                    0x1D, 0x00, false, false, 0x00
+#define CRC8_GSM_B_PARAMS                    0x49, 0x00, false, false, 0xFF
+#define CRC8_HITAG_PARAMS                    0x1D, 0xFF, false, false, 0x00
+#define CRC8_I_432_1_PARAMS                  0x07, 0x00, false, false, 0x55
+#define CRC8_I_CODE_PARAMS                   0x1D, 0xFD, false, false, 0x00
+#define CRC8_LTE_PARAMS                      0x9B, 0x00, false, false, 0x00
+#define CRC8_MAXIM_DOW_PARAMS                0x31, 0x00, true,  true,  0x00
+#define CRC8_MIFARE_MAD_PARAMS               0x1D, 0xC7, false, false, 0x00
+#define CRC8_NRSC_5_PARAMS                   0x31, 0xFF, false, false, 0x00
+#define CRC8_OPENSAFETY_PARAMS               0x2F, 0x00, false, false, 0x00
+#define CRC8_ROHC_PARAMS                     0x07, 0xFF, true,  true,  0x00
+#define CRC8_SAE_J1850_PARAMS                0x1D, 0xFF, false, false, 0xFF
+#define CRC8_SMBUS_PARAMS                    0x07, 0x00, false, false, 0x00
+#define CRC8_TECH_3250_PARAMS                0x1D, 0xFF, true,  true,  0x00
+#define CRC8_WCDMA_PARAMS                    0x9B, 0x00, true,  true,  0x00
+
+
+/*!
+    \brief Builds the lookup tables of the table driven kernel.
+
+    \details Does nothing without `CRC8_ENABLE_TABLE` or if the tables are
+    already built. Only needed before computing the first checksums from
+    several threads at once if `CRC8_ENABLE_PTHREAD` is not set.
+*/
+void crc8_init(void);
+
+/*!
+    \brief Accumulates a CRC8 checksum for a single byte.
+
+    \details Uses the bitwise kernel, which needs no lookup table.
+
+    \param id The CRC8 algorithm to use.
+    \param seed The initial or previously accumulated register value.
+    \param byte The byte of data to be accumulated.
+
+    \return The updated register value.
+*/
+uint8_t crc8_update_byte(crc8_id_t id, uint8_t seed, uint8_t byte);
+
+/*!
+    \brief Accumulates a CRC8 checksum over a data array.
+
+    \details Uses the fastest kernel available for the algorithm, see the
+    file description. The register value is compatible with `crc8_update_byte()`.
+
+    \param id The CRC8 algorithm to use.
+    \param seed The initial or previously accumulated register value.
+    \param data Pointer to the data array.
+    \param size The size of the data array in bytes.
+
+    \return The updated register value.
+*/
+uint8_t crc8_update(crc8_id_t id, uint8_t seed, const uint8_t *data, size_t size);
+
+/*!
+    \brief Applies RefOut and XorOut to an accumulated register value.
+
+    \param id The CRC8 algorithm to use.
+    \param seed The accumulated register value.
+
+    \return The final CRC8 checksum.
+*/
+uint8_t crc8_finalize(crc8_id_t id, uint8_t seed);
+
+const crc8_conf_t* crc8_get_conf(crc8_id_t id);
+int crc8_conf_count(void);
+
+/*!
+    \brief Computes the CRC8 checksum of a data array.
+
+    \param id The CRC8 algorithm to use.
+    \param data Pointer to the data array over which the CRC8 is to be computed.
+    \param size The size of the data array in bytes.
+
+    \return The CRC8 checksum of the data array.
+*/
+uint8_t crc8(crc8_id_t id, const uint8_t *data, size_t size);
+
+
+#endif /* CRC8_H_ */
@@ -0,0 +1,317 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*!
+    \file       cslist.h
+
+    \brief      Counted circular singly linked list header file
+
+    \details    A variant of the circular singly linked list (see slist.h) whose
+                control structure maintains the number of nodes. `cslist_size`
+                and `cslist_empty` are O(1) instead of walking the list, at the
+                cost of one counter per list and one increment or decrement per
+                update. Nodes are plain `slist_node_t`.
+
+                The count is only correct as long as all updates go through the
+                cslist macros. Read only slist operations may be used on the
+                list returned by `cslist_list`.
+*/
+
+#ifndef CSLIST_H_
+#define CSLIST_H_
+
+#include "slist.h"
+
+/*!
+    \brief      Counted singly linked list control structure.
+*/
+typedef struct {
+    slist_t head;           //!< Control node of the circular list
+    size_t count;           //!< Number of nodes in the list
+} cslist_t;
+
+/*!
+    \brief      Returns the circular singly linked list of a counted list.
+
+    \param list A pointer to the counted list.
+
+    \return A pointer to the `slist_t` control node.
+*/
+#define cslist_list(list) \
+    (&((cslist_t*)(list))->head)
+
+/*!
+    \brief      Iterates through a counted list, see `slist_foreach`.
+
+    \param list      A pointer to the counted list.
+    \param iterator  A pointer to a `slist_node_t` that will be used as the iterator.
+*/
+#define cslist_foreach(list,iterator) \
+    slist_foreach(cslist_list(list),iterator)
+
+/*!
+    \brief      Iterates through a counted list keeping track of the predecessor,
+                see `slist_foreach_prev`.
+
+    \details    The loop body may remove the current node with
+                `cslist_erase_after(list,prev)`.
+
+    \param list      A pointer to the counted list.
+    \param prev      A pointer to a `slist_node_t` that tracks the predecessor.
+    \param iterator  A pointer to a `slist_node_t` that will be used as the iterator.
+*/
+#define cslist_foreach_prev(list,prev,iterator) \
+    slist_foreach_prev(cslist_list(list),prev,iterator)
+
+/*!
+    \brief      Retrieves the next node, see `slist_next`.
+
+    \param list A pointer to the counted list.
+    \param node A pointer to the current node.
+*/
+#define cslist_next(list,node) \
+    slist_next(cslist_list(list),node)
+
+/*!
+    \brief      Retrieves the node preceding the given node, see `slist_prev`. O(n).
+
+    \param list A pointer to the counted list.
+    \param node A pointer to the node whose predecessor is to be found.
+*/
+#define cslist_prev(list,node) \
+    slist_prev(cslist_list(list),((slist_node_t*)(node)))
+
+/*!
+    \brief      Returns the node two positions before the given node, see `slist_prev_prev`.
+
+    \param list A pointer to the counted list.
+    \param node A pointer to the node for which to find the node two positions before.
+*/
+#define cslist_prev_prev(list,node) \
+    slist_prev_prev(cslist_list(list),((slist_node_t*)(node)))
+
+/*!
+    \brief      Initializes a counted list to be empty.
+
+    \param list A pointer to the counted list.
+*/
+#define cslist_init(list) \
+    do{ \
+        slist_init(cslist_list(list)); \
+        ((cslist_t*)(list))->count = 0; \
+    }while(0)
+
+/*!
+    \brief      Returns a pointer to the first data node, or the list control node if empty.
+
+    \param list A pointer to the counted list.
+*/
+#define cslist_begin(list) \
+    slist_begin(cslist_list(list))
+
+/*!
+    \brief      Returns a pointer to the first data node, alias for `cslist_begin`.
+
+    \param list A pointer to the counted list.
+*/
+#define cslist_front(list) \
+    slist_front(cslist_list(list))
+
+/*!
+    \brief      Returns a pointer to the past-the-end element, the list control node.
+
+    \param list A pointer to the counted list.
+*/
+#define cslist_end(list) \
+    slist_end(cslist_list(list))
+
+/*!
+    \brief      Returns a pointer to the last data node, see `slist_back`. O(n).
+
+    \param list A pointer to the counted list.
+*/
+#define cslist_back(list) \
+    slist_back(cslist_list(list))
+
+/*!
+    \brief      Checks if the list is empty in O(1).
+
+    \param list A pointer to the counted list.
+
+    \return True if the list is empty, false otherwise.
+*/
+#define cslist_empty(list) \
+    (((cslist_t*)(list))->count == 0)
+
+/*!
+    \brief      Returns the number of nodes in the list in O(1).
+
+    \param list A pointer to the counted list.
+
+    \return The number of nodes in the list.
+*/
+#define cslist_size(list) \
+    (((cslist_t*)(list))->count)
+
+/*!
+    \brief      Inserts a new node at the beginning of the list.
+
+    \param list A pointer to the counted list.
+    \param node A pointer to the new node to be inserted.
+*/
+#define cslist_push_front(list,node) \
+    do{ \
+        slist_push_front(cslist_list(list),node); \
+        ((cslist_t*)(list))->count++; \
+    }while(0)
+
+/*!
+    \brief      Removes the first node from a non empty list.
+
+    \param list A pointer to the counted list.
+*/
+#define cslist_pop_front(list) \
+    do{ \
+        slist_pop_front(cslist_list(list)); \
+        ((cslist_t*)(list))->count--; \
+    }while(0)
+
+/*!
+    \brief      Inserts a new node at the end of the list. O(n).
+
+    \param list A pointer to the counted list.
+    \param node A pointer to the new node to be inserted.
+*/
+#define cslist_push_back(list,node) \
+    do{ \
+        slist_push_back(cslist_list(list),node); \
+        ((cslist_t*)(list))->count++; \
+    }while(0)
+
+/*!
+    \brief      Removes the last node from a non empty list. O(n).
+
+    \param list A pointer to the counted list.
+*/
+#define cslist_pop_back(list) \
+    do{ \
+        slist_pop_back(cslist_list(list)); \
+        ((cslist_t*)(list))->count--; \
+    }while(0)
+
+/*!
+    \brief      Removes a node from the list. O(n).
+
+    \param list A pointer to the counted list.
+    \param node A pointer to the node to be removed from the list.
+*/
+#define cslist_erase(list,node) \
+    do{ \
+        slist_erase(cslist_list(list),node); \
+        ((cslist_t*)(list))->count--; \
+    }while(0)
+
+/*!
+    \brief      Removes the node following a given position from the list in O(1).
+
+    \param list A pointer to the counted list.
+    \param pos A pointer to the node whose successor should be removed, the
+               list control node removes the first node.
+*/
+#define cslist_erase_after(list,pos) \
+    do{ \
+        slist_erase_after(cslist_list(list),pos); \
+        ((cslist_t*)(list))->count--; \
+    }while(0)
+
+/*!
+    \brief      Removes a node from the list and marks it as unlinked, see
+                `slist_node_init`. O(n).
+
+    \param list A pointer to the counted list.
+    \param node A pointer to the node to be removed from the list.
+*/
+#define cslist_erase_safe(list,node) \
+    do{ \
+        slist_erase_safe(cslist_list(list),node); \
+        ((cslist_t*)(list))->count--; \
+    }while(0)
+
+/*!
+    \brief      Removes the node following a given position and marks it as
+                unlinked in O(1), see `slist_node_init`.
+
+    \param list A pointer to the counted list.
+    \param pos A pointer to the node whose successor should be removed, the
+               list control node removes the first node.
+*/
+#define cslist_erase_after_safe(list,pos) \
+    do{ \
+        slist_erase_after_safe(cslist_list(list),pos); \
+        ((cslist_t*)(list))->count--; \
+    }while(0)
+
+/*!
+    \brief      Inserts a new node after a given position in the list.
+
+    \param list A pointer to the counted list.
+    \param pos A pointer to the node after which the new node should be inserted.
+    \param node A pointer to the new node to be inserted.
+*/
+#define cslist_insert_after(list,pos,node) \
+    do{ \
+        slist_insert_after(cslist_list(list),pos,node); \
+        ((cslist_t*)(list))->count++; \
+    }while(0)
+
+/*!
+    \brief      Inserts a new node before a given position in the list. O(n).
+
+    \param list A pointer to the counted list.
+    \param pos A pointer to the node before which the new node should be inserted.
+    \param node A pointer to the new node to be inserted.
+*/
+#define cslist_insert_before(list,pos,node) \
+    do{ \
+        slist_insert_before(cslist_list(list),pos,node); \
+        ((cslist_t*)(list))->count++; \
+    }while(0)
+
+/*!
+    \brief      Searches for a node within the list.
+
+    \param list A pointer to the counted list.
+    \param node The node to search for.
+
+    \return A pointer to the found node if it exists in the list, otherwise NULL.
+*/
+#define cslist_find(list,node) \
+    slist_find(cslist_list(list),((slist_node_t*)(node)))
+
+#endif /* CSLIST_H_ */
@@ -67,7 +67,170 @@ size_t dlist_size(dlist_t *list)
    return size;
 }
 
+/* merges two sorted NULL terminated chains linked by next, on equal keys first comes first */
+static dlist_node_t* dlist_merge_chains(dlist_node_t *first, dlist_node_t *second, dlist_compare_t compare)
+{
+    dlist_node_t head;
+    dlist_node_t *tail = &head;
+
+    while (first && second)
+    {
+        if (compare(second, first) < 0)
+        {
+            tail->next = second;
+            second = second->next;
+        }
+        else
+        {
+            tail->next = first;
+            first = first->next;
+        }
+
+        tail = tail->next;
+    }
+
+    tail->next = first ? first : second;
+
+    return head.next;
+}
+
+/*
+    Bottom up merge sort on the next links only, see slist_sort. The prev
+    links are restored in a final pass over the sorted list.
+*/
+void dlist_sort(dlist_t *list, dlist_compare_t compare)
+{
+    dlist_node_t *bins[sizeof(size_t) * 8];
+    dlist_node_t *chain;
+    dlist_node_t *run;
+    dlist_node_t *prev;
+    size_t used = 0;
+    size_t idx;
+
+    if (dlist_empty(list))
+    {
+        return;
+    }
+
+    list->prev->next = NULL;
+    chain = list->next;
+
+    while (chain)
+    {
+        run = chain;
+        chain = chain->next;
+        run->next = NULL;
+
+        for (idx = 0; idx < used && bins[idx]; idx++)
+        {
+            run = dlist_merge_chains(bins[idx], run, compare);
+            bins[idx] = NULL;
+        }
+
+        if (idx == used)
+        {
+            used++;
+        }
+
+        bins[idx] = run;
+    }
+
+    run = NULL;
+
+    for (idx = 0; idx < used; idx++)
+    {
+        if (bins[idx])
+        {
+            run = dlist_merge_chains(bins[idx], run, compare);
+        }
+    }
+
+    list->next = run;
+
+    for (prev = list; run; prev = run, run = run->next)
+    {
+        run->prev = prev;
+    }
+
+    prev->next = list;
+    list->prev = prev;
+}
+
+/* searches from the back, appending in order as with timeouts is O(1) */
+void dlist_insert_sorted(dlist_t *list, dlist_node_t *node, dlist_compare_t compare)
+{
+    dlist_node_t *pos = list->prev;
+
+    while (pos != list && compare(node, pos) < 0)
+    {
+        pos = pos->prev;
+    }
+
+    dlist_insert_after(list, pos, node);
+}
+
+void dlist_merge(dlist_t *list, dlist_t *other, dlist_compare_t compare)
+{
+    dlist_node_t *pos = list->next;
+
+    while (!dlist_empty(other))
+    {
+        dlist_node_t *node = dlist_front(other);
+
+        while (pos != list && compare(pos, node) <= 0)
+        {
+            pos = pos->next;
+        }
 
+        if (pos == list)
+        {
+            /* everything left in other orders after the list, append it as a whole */
+            other->next->prev = list->prev;
+            list->prev->next = other->next;
+            other->prev->next = list;
+            list->prev = other->prev;
+            dlist_init(other);
+            break;
+        }
+
+        dlist_pop_front(other);
+        dlist_insert_before(list, pos, node);
+    }
+}
+
+void dlist_splice_range(dlist_t *list, dlist_node_t *pos, dlist_node_t *first, dlist_node_t *last)
+{
+    (void)list;
+
+    first->prev->next = last->next;
+    last->next->prev = first->prev;
+
+    first->prev = pos->prev;
+    last->next = pos;
+    pos->prev->next = first;
+    pos->prev = last;
+}
 
+void dlist_splice(dlist_t *list, dlist_node_t *pos, dlist_t *other)
+{
+    if (!dlist_empty(other))
+    {
+        dlist_splice_range(list, pos, other->next, other->prev);
+    }
+}
 
+void dlist_cut(dlist_t *list, dlist_node_t *node, dlist_t *other)
+{
+    if (node == list)
+    {
+        dlist_init(other);
+        return;
+    }
 
+    other->next = node;
+    other->prev = list->prev;
+    list->prev = node->prev;
+    node->prev->next = list;
+    node->prev = other;
+    other->prev->next = other;
+}
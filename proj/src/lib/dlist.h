@@ -203,7 +203,7 @@ typedef dlist_node_t dlist_t;
  \return True if the list is empty, false otherwise.
 */
 #define dlist_empty(list) \
-    ((dlist_t*)(list))->next == ((dlist_t*)(list))
+    (((dlist_t*)(list))->next == ((dlist_t*)(list)))
 
 
 /*!
@@ -297,6 +297,86 @@ typedef dlist_node_t dlist_t;
     }while(0)
 
 
+/*!
+ \brief Marks a node as not being on any list.
+
+ \details Nodes follow an optional state convention: a node that is not on a
+       list has NULL links. Zero initialised static nodes are thus unlinked
+       without calling this macro. As long as nodes are only removed with
+       the `_safe` macros, `dlist_node_is_linked` tells in O(1) whether a node
+       is on a list, replacing a `dlist_find` scan before erasing it.
+       The plain erase and pop macros leave the stale links in the node.
+
+ \param node A pointer to the node.
+*/
+#define dlist_node_init(node) \
+    do{ \
+        ((dlist_node_t*)(node))->next = NULL; \
+        ((dlist_node_t*)(node))->prev = NULL; \
+    }while(0)
+
+/*!
+ \brief Checks if a node is on a list.
+
+ \details O(1), see `dlist_node_init` for the convention this relies on.
+
+ \param node A pointer to the node.
+
+ \return True if the node is on a list, false otherwise.
+*/
+#define dlist_node_is_linked(node) \
+    (((dlist_node_t*)(node))->next != NULL)
+
+/*!
+ \brief Removes a node from the list and marks it as unlinked.
+
+ \details Like `dlist_erase`, but resets the links of the node afterwards,
+       see `dlist_node_init`. The node is evaluated once.
+
+ \param list A pointer to the list control node.
+ \param node A pointer to the node to be removed from the list.
+*/
+#define dlist_erase_safe(list,node) \
+    do{ \
+        dlist_node_t *dlist_erased_ = ((dlist_node_t*)(node)); \
+        dlist_erase(list,dlist_erased_); \
+        dlist_node_init(dlist_erased_); \
+    }while(0)
+
+/*!
+ \brief Removes a node from the list if it is on it.
+
+ \details Does nothing for an unlinked node, so cancelling something twice
+       is harmless. Relies on the convention described at `dlist_node_init`.
+
+ \param list A pointer to the list control node.
+ \param node A pointer to the node to be removed from the list.
+*/
+#define dlist_erase_if_linked(list,node) \
+    do{ \
+        dlist_node_t *dlist_linked_ = ((dlist_node_t*)(node)); \
+        if (dlist_node_is_linked(dlist_linked_)) \
+        { \
+            dlist_erase_safe(list,dlist_linked_); \
+        } \
+    }while(0)
+
+/*!
+ \brief Removes the first node from the list and marks it as unlinked.
+
+ \param list A pointer to the list control node, the list must not be empty.
+*/
+#define dlist_pop_front_safe(list) \
+    dlist_erase_safe(list,dlist_front(list))
+
+/*!
+ \brief Removes the last node from the list and marks it as unlinked.
+
+ \param list A pointer to the list control node, the list must not be empty.
+*/
+#define dlist_pop_back_safe(list) \
+    dlist_erase_safe(list,dlist_back(list))
+
 /*!
  \brief Inserts a new node after a given position in the list.
 
@@ -354,6 +434,101 @@ size_t dlist_size(dlist_t *list);
 */
 dlist_node_t* dlist_find(dlist_t* list, dlist_node_t* node);
 
+/*!
+ \brief Compares two nodes for ordering.
+
+ \details User supplied ordering for `dlist_sort`, `dlist_insert_sorted` and
+       `dlist_merge`, typically comparing members of the containing structures
+       obtained with `container_of`.
+
+ \param a The first node.
+ \param b The second node.
+
+ \return Less than zero if a orders before b, zero if they are equal, greater
+       than zero if a orders after b.
+*/
+typedef int (*dlist_compare_t)(const dlist_node_t *a, const dlist_node_t *b);
+
+/*!
+ \brief Sorts the list in place.
+
+ \details Stable bottom up merge sort, O(n log n) comparisons and no memory
+       allocation. Nodes that compare equal keep their relative order.
+
+ \param list A pointer to the list control node.
+ \param compare The ordering of the nodes.
+*/
+void dlist_sort(dlist_t *list, dlist_compare_t compare);
+
+/*!
+ \brief Inserts a node into a sorted list keeping it sorted.
+
+ \details The node is inserted after all nodes that compare equal to it, so
+       nodes with equal keys stay in insertion order. The position is searched
+       from the back, so inserting nodes that mostly arrive in order, such as
+       timeouts, is close to O(1); O(n) in the worst case.
+
+ \param list A pointer to the list control node of a sorted list.
+ \param node A pointer to the new node to be inserted.
+ \param compare The ordering the list is sorted by.
+*/
+void dlist_insert_sorted(dlist_t *list, dlist_node_t *node, dlist_compare_t compare);
+
+/*!
+ \brief Merges a sorted list into another sorted list.
+
+ \details Moves all nodes of `other` into `list` keeping it sorted, `other`
+       is empty afterwards. On equal keys the nodes of `list` come first.
+       O(n + m) comparisons, the nodes are relinked, not copied.
+
+ \param list A pointer to the list control node of the sorted target list.
+ \param other A pointer to the list control node of the sorted list to merge.
+ \param compare The ordering both lists are sorted by.
+*/
+void dlist_merge(dlist_t *list, dlist_t *other, dlist_compare_t compare);
+
+/*!
+ \brief Moves all nodes of another list into the list before a given position.
+
+ \details O(1), `other` is empty afterwards. Typically used to hand over a
+       batch of queued nodes: `dlist_splice(list, dlist_end(list), other)`
+       appends `other` to `list`.
+
+ \param list A pointer to the list control node of the target list.
+ \param pos A pointer to the node before which the nodes are inserted, the
+       list control node appends them.
+ \param other A pointer to the list control node of the list to move.
+*/
+void dlist_splice(dlist_t *list, dlist_node_t *pos, dlist_t *other);
+
+/*!
+ \brief Moves a range of nodes before a given position.
+
+ \details Unlinks the nodes from `first` to `last` inclusive from the list
+       they are in and inserts them before `pos`, O(1). The source list may
+       be `list` itself, `pos` must not be within the range.
+
+ \param list A pointer to the list control node of the target list.
+ \param pos A pointer to the node before which the nodes are inserted.
+ \param first A pointer to the first node of the range.
+ \param last A pointer to the last node of the range, reachable from `first`.
+*/
+void dlist_splice_range(dlist_t *list, dlist_node_t *pos, dlist_node_t *first, dlist_node_t *last);
+
+/*!
+ \brief Splits a list at a node.
+
+ \details Moves `node` and all nodes after it into `other` in O(1), `list`
+       keeps the nodes before `node`. Previous contents of `other` are
+       discarded, it does not need to be initialized.
+
+ \param list A pointer to the list control node of the list to split.
+ \param node A pointer to the first node to move, the list control node
+       moves nothing.
+ \param other A pointer to the list control node receiving the nodes.
+*/
+void dlist_cut(dlist_t *list, dlist_node_t *node, dlist_t *other);
+
 #endif /* DLIST_H_ */
 
 
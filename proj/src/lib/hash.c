@@ -35,23 +35,584 @@
 */
 
 #include "hash.h"
+#include <limits.h>
+#include <string.h>
+
+/*
+    Powers of the SDBM multiplier 65599 modulo 2^32. hash_sdbm_acc() is
+    equivalent to hash*65599 + byte, so n bytes can be folded in one step:
+
+    hash' = hash*P^n + b[0]*P^(n-1) + ... + b[n-2]*P + b[n-1]
+
+    The products are independent of each other and of the running hash,
+    which breaks the serial dependency chain of the byte loop.
+*/
+#define HASH_SDBM_P1 0x0001003FUL
+#define HASH_SDBM_P2 0x007E0F81UL
+#define HASH_SDBM_P3 0x2E86D0BFUL
+#define HASH_SDBM_P4 0x43EC5F01UL
+#define HASH_SDBM_P5 0x162C613FUL
+#define HASH_SDBM_P6 0xD62AEE81UL
+#define HASH_SDBM_P7 0xA311B1BFUL
+#define HASH_SDBM_P8 0xD319BE01UL
 
 uint32_t hash_sdbm(uint32_t seed, void *data, size_t size)
 {
-	int idx;
+    const uint8_t *bytes = (const uint8_t*)data;
+
+#if UINT_MAX >= 0xFFFFFFFFUL
+    /*
+        Eight bytes per step in two independent lanes. Only worth it where a
+        32 bit multiplication is cheap, small targets keep the shift/add loop.
+    */
+    while (size >= 8)
+    {
+        uint32_t lane0 = (uint32_t)(bytes[0] * HASH_SDBM_P7 + bytes[1] * HASH_SDBM_P6
+                                  + bytes[2] * HASH_SDBM_P5 + bytes[3] * HASH_SDBM_P4);
+        uint32_t lane1 = (uint32_t)(bytes[4] * HASH_SDBM_P3 + bytes[5] * HASH_SDBM_P2
+                                  + bytes[6] * HASH_SDBM_P1 + bytes[7]);
+
+        seed = (uint32_t)(seed * HASH_SDBM_P8) + lane0 + lane1;
+        bytes += 8;
+        size -= 8;
+    }
+#endif
+
+    while (size--)
+    {
+        seed = hash_sdbm_acc(seed, *bytes++);
+    }
+
+    return seed;
+}
+
+/*
+    Byte order independent loads, compilers turn these into a single load
+    on little endian targets.
+*/
+static uint32_t hash_read32(const uint8_t *bytes)
+{
+    return (uint32_t)bytes[0]
+        | ((uint32_t)bytes[1] << 8)
+        | ((uint32_t)bytes[2] << 16)
+        | ((uint32_t)bytes[3] << 24);
+}
+
+#define hash_rotl32(value, bits) \
+    ((uint32_t)(((value) << (bits)) | ((value) >> (32 - (bits)))))
+
+uint32_t hash_fnv1a(uint32_t seed, void *data, size_t size)
+{
+    const uint8_t *bytes = (const uint8_t*)data;
+
+    while (size--)
+    {
+#if UINT_MAX >= 0xFFFFFFFFUL
+        seed = hash_fnv1a_acc(seed, *bytes++);
+#else
+        /* 0x01000193 = 2^24 + 2^8 + 2^7 + 2^4 + 2^1 + 2^0 */
+        seed ^= *bytes++;
+        seed += (seed << 1) + (seed << 4) + (seed << 7) + (seed << 8) + (seed << 24);
+#endif
+    }
+
+    return seed;
+}
+
+void hash_sdbm_init(hash_sdbm_ctx_t *ctx, uint32_t seed)
+{
+    ctx->hash = seed;
+}
+
+void hash_sdbm_update(hash_sdbm_ctx_t *ctx, void *data, size_t size)
+{
+    ctx->hash = hash_sdbm(ctx->hash, data, size);
+}
+
+uint32_t hash_sdbm_final(hash_sdbm_ctx_t *ctx)
+{
+    return ctx->hash;
+}
+
+void hash_fnv1a_init(hash_fnv1a_ctx_t *ctx, uint32_t seed)
+{
+    ctx->hash = seed;
+}
+
+void hash_fnv1a_update(hash_fnv1a_ctx_t *ctx, void *data, size_t size)
+{
+    ctx->hash = hash_fnv1a(ctx->hash, data, size);
+}
+
+uint32_t hash_fnv1a_final(hash_fnv1a_ctx_t *ctx)
+{
+    return ctx->hash;
+}
+
+#define HASH_MURMUR3_C1 0xCC9E2D51UL
+#define HASH_MURMUR3_C2 0x1B873593UL
+
+static uint32_t hash_murmur3_mix(uint32_t block)
+{
+    block = (uint32_t)(block * HASH_MURMUR3_C1);
+    block = hash_rotl32(block, 15);
+    return (uint32_t)(block * HASH_MURMUR3_C2);
+}
+
+/* processes all complete 4 byte blocks, returns the number of bytes consumed */
+static size_t hash_murmur3_blocks(uint32_t *hash, const uint8_t *bytes, size_t size)
+{
+    uint32_t h = *hash;
+    size_t blocks = size / 4;
+
+    while (blocks--)
+    {
+        h ^= hash_murmur3_mix(hash_read32(bytes));
+        h = hash_rotl32(h, 13);
+        h = (uint32_t)(h * 5 + 0xE6546B64UL);
+        bytes += 4;
+    }
+
+    *hash = h;
+
+    return size & ~(size_t)3;
+}
+
+/* tail of less than 4 bytes, total length and avalanche */
+static uint32_t hash_murmur3_finish(uint32_t hash, const uint8_t *bytes, size_t remaining, uint32_t total)
+{
+    uint32_t tail = 0;
+
+    switch (remaining)
+    {
+        case 3: tail ^= (uint32_t)bytes[2] << 16; /* fall through */
+        case 2: tail ^= (uint32_t)bytes[1] << 8;  /* fall through */
+        case 1: tail ^= (uint32_t)bytes[0];
+                hash ^= hash_murmur3_mix(tail);
+    }
+
+    hash ^= total;
+    hash ^= hash >> 16;
+    hash = (uint32_t)(hash * 0x85EBCA6BUL);
+    hash ^= hash >> 13;
+    hash = (uint32_t)(hash * 0xC2B2AE35UL);
+    hash ^= hash >> 16;
+
+    return hash;
+}
+
+uint32_t hash_murmur3(uint32_t seed, void *data, size_t size)
+{
+    const uint8_t *bytes = (const uint8_t*)data;
+    size_t consumed = hash_murmur3_blocks(&seed, bytes, size);
+
+    return hash_murmur3_finish(seed, bytes + consumed, size - consumed, (uint32_t)size);
+}
+
+void hash_murmur3_init(hash_murmur3_ctx_t *ctx, uint32_t seed)
+{
+    ctx->hash = seed;
+    ctx->total = 0;
+    ctx->buffered = 0;
+}
+
+void hash_murmur3_update(hash_murmur3_ctx_t *ctx, void *data, size_t size)
+{
+    const uint8_t *bytes = (const uint8_t*)data;
+    size_t consumed;
+
+    ctx->total += (uint32_t)size;
+
+    /* complete a block left over from the previous update */
+    if (ctx->buffered)
+    {
+        while (size && ctx->buffered < sizeof(ctx->buffer))
+        {
+            ctx->buffer[ctx->buffered++] = *bytes++;
+            size--;
+        }
+
+        if (ctx->buffered < sizeof(ctx->buffer))
+        {
+            return;
+        }
+
+        hash_murmur3_blocks(&ctx->hash, ctx->buffer, sizeof(ctx->buffer));
+        ctx->buffered = 0;
+    }
+
+    consumed = hash_murmur3_blocks(&ctx->hash, bytes, size);
+    memcpy(ctx->buffer, bytes + consumed, size - consumed);
+    ctx->buffered = (uint8_t)(size - consumed);
+}
+
+uint32_t hash_murmur3_final(hash_murmur3_ctx_t *ctx)
+{
+    return hash_murmur3_finish(ctx->hash, ctx->buffer, ctx->buffered, ctx->total);
+}
+
+#define HASH_XXH32_P1 0x9E3779B1UL
+#define HASH_XXH32_P2 0x85EBCA77UL
+#define HASH_XXH32_P3 0xC2B2AE3DUL
+#define HASH_XXH32_P4 0x27D4EB2FUL
+#define HASH_XXH32_P5 0x165667B1UL
+
+static uint32_t hash_xxh32_round(uint32_t acc, uint32_t input)
+{
+    acc = (uint32_t)(acc + input * HASH_XXH32_P2);
+    acc = hash_rotl32(acc, 13);
+#if defined(__GNUC__) && defined(__SSE2__) && !defined(__SSE4_1__)
+    /*
+        Keeps gcc from vectorizing the four lanes, SSE2 has no 32 bit
+        multiplication and the emulation is twice as slow as scalar code.
+    */
+    __asm__("" : "+r" (acc));
+#endif
+    return (uint32_t)(acc * HASH_XXH32_P1);
+}
+
+static void hash_xxh32_lanes_init(uint32_t *lanes, uint32_t seed)
+{
+    lanes[0] = (uint32_t)(seed + HASH_XXH32_P1 + HASH_XXH32_P2);
+    lanes[1] = (uint32_t)(seed + HASH_XXH32_P2);
+    lanes[2] = seed;
+    lanes[3] = (uint32_t)(seed - HASH_XXH32_P1);
+}
+
+/* processes all complete 16 byte stripes, returns the number of bytes consumed */
+static size_t hash_xxh32_stripes(uint32_t *lanes, const uint8_t *bytes, size_t size)
+{
+    uint32_t v1 = lanes[0];
+    uint32_t v2 = lanes[1];
+    uint32_t v3 = lanes[2];
+    uint32_t v4 = lanes[3];
+    size_t stripes = size / 16;
+
+    while (stripes--)
+    {
+        v1 = hash_xxh32_round(v1, hash_read32(bytes));
+        v2 = hash_xxh32_round(v2, hash_read32(bytes+4));
+        v3 = hash_xxh32_round(v3, hash_read32(bytes+8));
+        v4 = hash_xxh32_round(v4, hash_read32(bytes+12));
+        bytes += 16;
+    }
+
+    lanes[0] = v1;
+    lanes[1] = v2;
+    lanes[2] = v3;
+    lanes[3] = v4;
+
+    return size & ~(size_t)15;
+}
+
+static uint32_t hash_xxh32_converge(const uint32_t *lanes)
+{
+    return (uint32_t)(hash_rotl32(lanes[0], 1) + hash_rotl32(lanes[1], 7)
+                    + hash_rotl32(lanes[2], 12) + hash_rotl32(lanes[3], 18));
+}
+
+/* tail of less than 16 bytes and avalanche */
+static uint32_t hash_xxh32_finish(uint32_t hash, const uint8_t *bytes, size_t remaining)
+{
+    while (remaining >= 4)
+    {
+        hash = (uint32_t)(hash + hash_read32(bytes) * HASH_XXH32_P3);
+        hash = (uint32_t)(hash_rotl32(hash, 17) * HASH_XXH32_P4);
+        bytes += 4;
+        remaining -= 4;
+    }
+
+    while (remaining--)
+    {
+        hash = (uint32_t)(hash + *bytes++ * HASH_XXH32_P5);
+        hash = (uint32_t)(hash_rotl32(hash, 11) * HASH_XXH32_P1);
+    }
+
+    hash ^= hash >> 15;
+    hash = (uint32_t)(hash * HASH_XXH32_P2);
+    hash ^= hash >> 13;
+    hash = (uint32_t)(hash * HASH_XXH32_P3);
+    hash ^= hash >> 16;
+
+    return hash;
+}
+
+uint32_t hash_xxh32(uint32_t seed, void *data, size_t size)
+{
+    const uint8_t *bytes = (const uint8_t*)data;
+    uint32_t hash;
+    size_t consumed = 0;
+
+    if (size >= 16)
+    {
+        uint32_t lanes[4];
+
+        hash_xxh32_lanes_init(lanes, seed);
+        consumed = hash_xxh32_stripes(lanes, bytes, size);
+        hash = hash_xxh32_converge(lanes);
+    }
+    else
+    {
+        hash = (uint32_t)(seed + HASH_XXH32_P5);
+    }
+
+    hash = (uint32_t)(hash + size);
+
+    return hash_xxh32_finish(hash, bytes + consumed, size - consumed);
+}
+
+void hash_xxh32_init(hash_xxh32_ctx_t *ctx, uint32_t seed)
+{
+    hash_xxh32_lanes_init(ctx->lanes, seed);
+    ctx->seed = seed;
+    ctx->total = 0;
+    ctx->large = 0;
+    ctx->buffered = 0;
+}
+
+void hash_xxh32_update(hash_xxh32_ctx_t *ctx, void *data, size_t size)
+{
+    const uint8_t *bytes = (const uint8_t*)data;
+    size_t consumed;
+
+    ctx->total = (uint32_t)(ctx->total + size);
+
+    /* complete a stripe left over from the previous update */
+    if (ctx->buffered)
+    {
+        while (size && ctx->buffered < sizeof(ctx->buffer))
+        {
+            ctx->buffer[ctx->buffered++] = *bytes++;
+            size--;
+        }
+
+        if (ctx->buffered < sizeof(ctx->buffer))
+        {
+            return;
+        }
+
+        hash_xxh32_stripes(ctx->lanes, ctx->buffer, sizeof(ctx->buffer));
+        ctx->buffered = 0;
+        ctx->large = 1;
+    }
+
+    consumed = hash_xxh32_stripes(ctx->lanes, bytes, size);
 
-	for(idx = 0; idx < size; idx++)
-	{
-		seed = hash_sdbm_acc(seed,((uint8_t*)data)[idx]);		
-	}
+    if (consumed)
+    {
+        ctx->large = 1;
+    }
 
-    	return seed;
+    memcpy(ctx->buffer, bytes + consumed, size - consumed);
+    ctx->buffered = (uint8_t)(size - consumed);
 }
 
+uint32_t hash_xxh32_final(hash_xxh32_ctx_t *ctx)
+{
+    uint32_t hash;
+
+    if (ctx->large)
+    {
+        hash = hash_xxh32_converge(ctx->lanes);
+    }
+    else
+    {
+        hash = (uint32_t)(ctx->seed + HASH_XXH32_P5);
+    }
 
+    hash = (uint32_t)(hash + ctx->total);
 
+    return hash_xxh32_finish(hash, ctx->buffer, ctx->buffered);
+}
 
+#if defined(UINT64_MAX)
 
+#define HASH_XXH64_P1 0x9E3779B185EBCA87ULL
+#define HASH_XXH64_P2 0xC2B2AE3D27D4EB4FULL
+#define HASH_XXH64_P3 0x165667B19E3779F9ULL
+#define HASH_XXH64_P4 0x85EBCA77C2B2AE63ULL
+#define HASH_XXH64_P5 0x27D4EB2F165667C5ULL
 
+#define hash_rotl64(value, bits) \
+    ((uint64_t)(((value) << (bits)) | ((value) >> (64 - (bits)))))
+
+static uint64_t hash_read64(const uint8_t *bytes)
+{
+    return (uint64_t)hash_read32(bytes) | ((uint64_t)hash_read32(bytes+4) << 32);
+}
+
+static uint64_t hash_xxh64_round(uint64_t acc, uint64_t input)
+{
+    acc += input * HASH_XXH64_P2;
+    acc = hash_rotl64(acc, 31);
+    return acc * HASH_XXH64_P1;
+}
+
+static uint64_t hash_xxh64_merge(uint64_t acc, uint64_t lane)
+{
+    acc ^= hash_xxh64_round(0, lane);
+    return acc * HASH_XXH64_P1 + HASH_XXH64_P4;
+}
+
+static void hash_xxh64_lanes_init(uint64_t *lanes, uint64_t seed)
+{
+    lanes[0] = seed + HASH_XXH64_P1 + HASH_XXH64_P2;
+    lanes[1] = seed + HASH_XXH64_P2;
+    lanes[2] = seed;
+    lanes[3] = seed - HASH_XXH64_P1;
+}
 
+/* processes all complete 32 byte stripes, returns the number of bytes consumed */
+static size_t hash_xxh64_stripes(uint64_t *lanes, const uint8_t *bytes, size_t size)
+{
+    uint64_t v1 = lanes[0];
+    uint64_t v2 = lanes[1];
+    uint64_t v3 = lanes[2];
+    uint64_t v4 = lanes[3];
+    size_t stripes = size / 32;
+
+    while (stripes--)
+    {
+        v1 = hash_xxh64_round(v1, hash_read64(bytes));
+        v2 = hash_xxh64_round(v2, hash_read64(bytes+8));
+        v3 = hash_xxh64_round(v3, hash_read64(bytes+16));
+        v4 = hash_xxh64_round(v4, hash_read64(bytes+24));
+        bytes += 32;
+    }
+
+    lanes[0] = v1;
+    lanes[1] = v2;
+    lanes[2] = v3;
+    lanes[3] = v4;
+
+    return size & ~(size_t)31;
+}
+
+static uint64_t hash_xxh64_converge(const uint64_t *lanes)
+{
+    uint64_t hash = hash_rotl64(lanes[0], 1) + hash_rotl64(lanes[1], 7)
+                  + hash_rotl64(lanes[2], 12) + hash_rotl64(lanes[3], 18);
+
+    hash = hash_xxh64_merge(hash, lanes[0]);
+    hash = hash_xxh64_merge(hash, lanes[1]);
+    hash = hash_xxh64_merge(hash, lanes[2]);
+    hash = hash_xxh64_merge(hash, lanes[3]);
+
+    return hash;
+}
+
+/* tail of less than 32 bytes and avalanche */
+static uint64_t hash_xxh64_finish(uint64_t hash, const uint8_t *bytes, size_t remaining)
+{
+    while (remaining >= 8)
+    {
+        hash ^= hash_xxh64_round(0, hash_read64(bytes));
+        hash = hash_rotl64(hash, 27) * HASH_XXH64_P1 + HASH_XXH64_P4;
+        bytes += 8;
+        remaining -= 8;
+    }
+
+    if (remaining >= 4)
+    {
+        hash ^= (uint64_t)hash_read32(bytes) * HASH_XXH64_P1;
+        hash = hash_rotl64(hash, 23) * HASH_XXH64_P2 + HASH_XXH64_P3;
+        bytes += 4;
+        remaining -= 4;
+    }
+
+    while (remaining--)
+    {
+        hash ^= *bytes++ * HASH_XXH64_P5;
+        hash = hash_rotl64(hash, 11) * HASH_XXH64_P1;
+    }
+
+    hash ^= hash >> 33;
+    hash *= HASH_XXH64_P2;
+    hash ^= hash >> 29;
+    hash *= HASH_XXH64_P3;
+    hash ^= hash >> 32;
+
+    return hash;
+}
+
+uint64_t hash_xxh64(uint64_t seed, void *data, size_t size)
+{
+    const uint8_t *bytes = (const uint8_t*)data;
+    uint64_t hash;
+    size_t consumed = 0;
+
+    if (size >= 32)
+    {
+        uint64_t lanes[4];
+
+        hash_xxh64_lanes_init(lanes, seed);
+        consumed = hash_xxh64_stripes(lanes, bytes, size);
+        hash = hash_xxh64_converge(lanes);
+    }
+    else
+    {
+        hash = seed + HASH_XXH64_P5;
+    }
+
+    hash += (uint64_t)size;
+
+    return hash_xxh64_finish(hash, bytes + consumed, size - consumed);
+}
+
+void hash_xxh64_init(hash_xxh64_ctx_t *ctx, uint64_t seed)
+{
+    hash_xxh64_lanes_init(ctx->lanes, seed);
+    ctx->seed = seed;
+    ctx->total = 0;
+    ctx->buffered = 0;
+}
+
+void hash_xxh64_update(hash_xxh64_ctx_t *ctx, void *data, size_t size)
+{
+    const uint8_t *bytes = (const uint8_t*)data;
+    size_t consumed;
+
+    ctx->total += (uint64_t)size;
+
+    /* complete a stripe left over from the previous update */
+    if (ctx->buffered)
+    {
+        while (size && ctx->buffered < sizeof(ctx->buffer))
+        {
+            ctx->buffer[ctx->buffered++] = *bytes++;
+            size--;
+        }
+
+        if (ctx->buffered < sizeof(ctx->buffer))
+        {
+            return;
+        }
+
+        hash_xxh64_stripes(ctx->lanes, ctx->buffer, sizeof(ctx->buffer));
+        ctx->buffered = 0;
+    }
+
+    consumed = hash_xxh64_stripes(ctx->lanes, bytes, size);
+    memcpy(ctx->buffer, bytes + consumed, size - consumed);
+    ctx->buffered = (uint8_t)(size - consumed);
+}
+
+uint64_t hash_xxh64_final(hash_xxh64_ctx_t *ctx)
+{
+    uint64_t hash;
+
+    if (ctx->total >= 32)
+    {
+        hash = hash_xxh64_converge(ctx->lanes);
+    }
+    else
+    {
+        hash = ctx->seed + HASH_XXH64_P5;
+    }
+
+    hash += ctx->total;
+
+    return hash_xxh64_finish(hash, ctx->buffer, ctx->buffered);
+}
 
+#endif /* UINT64_MAX */
@@ -78,6 +78,11 @@
                 distribution properties, making it a popular choice in situations
                 where a non-cryptographic hash is sufficient.
 
+                On targets with 32 bit `unsigned int` eight bytes are folded per
+                step using precomputed powers of the multiplier 65599, which
+                yields bit-identical results to the byte-wise accumulation with
+                `hash_sdbm_acc`.
+
 
     \param seed     The initial seed value for the hash computation.
     \param data     Pointer to the data block to be hashed.
@@ -87,6 +92,509 @@
 */
 uint32_t hash_sdbm(uint32_t seed, void *data, size_t size);
 
+/*!
+    \brief      Context of an incremental SDBM calculation.
+
+    \details    Allows hashing data that arrives in pieces, e.g. split across
+                ring buffer segments or packet fragments, without assembling
+                it first. Feeding the same bytes in any partitioning yields
+                the result of `hash_sdbm`.
+*/
+typedef struct {
+    uint32_t hash;          //!< Running hash value
+} hash_sdbm_ctx_t;
+
+/*!
+    \brief      Starts an incremental SDBM calculation.
+
+    \param ctx      The context to initialize.
+    \param seed     The seed value, same meaning as for `hash_sdbm`.
+*/
+void hash_sdbm_init(hash_sdbm_ctx_t *ctx, uint32_t seed);
+
+/*!
+    \brief      Feeds the next piece of data into an incremental SDBM calculation.
+
+    \param ctx      The context started with `hash_sdbm_init`.
+    \param data     Pointer to the next piece of data, may be empty.
+    \param size     Size of the piece in bytes.
+*/
+void hash_sdbm_update(hash_sdbm_ctx_t *ctx, void *data, size_t size);
+
+/*!
+    \brief      Returns the result of an incremental SDBM calculation.
+
+    \details    The context is not modified, more data may be fed afterwards
+                to get the hash of a longer key sharing the same prefix.
+
+    \param ctx      The context started with `hash_sdbm_init`.
+
+    \return         The hash of all data fed so far.
+*/
+uint32_t hash_sdbm_final(hash_sdbm_ctx_t *ctx);
+
+
+
+
+/*!
+    \brief      Common signature of the 32 bit hash functions.
+
+    \details    All 32 bit hash functions of this module share the same
+                signature, so they can be handed to containers or benchmarks
+                as a callback.
+*/
+typedef uint32_t (*hash_func_t)(uint32_t seed, void *data, size_t size);
+
+/*!
+    \brief      Offset basis of the 32 bit FNV-1a hash.
+
+    \details    Pass this value as seed to `hash_fnv1a` to get the standard
+                FNV-1a result. Any other seed yields a different hash family.
+*/
+#define HASH_FNV1A_INIT  0x811C9DC5UL
+
+/*!
+    \brief      Prime of the 32 bit FNV-1a hash.
+*/
+#define HASH_FNV1A_PRIME 0x01000193UL
+
+/*!
+    \brief      Accumulates a single byte into an ongoing FNV-1a hash calculation.
+
+    \details    The byte is xored into the hash first and the result is
+                multiplied by the FNV prime afterwards.
+
+    \param hash     The current hash value.
+    \param byte     The byte to be accumulated into the hash.
+
+    \return         The updated hash value after accumulating the byte.
+*/
+#define hash_fnv1a_acc(hash, byte) \
+ ((uint32_t)(((hash) ^ (uint8_t)(byte)) * HASH_FNV1A_PRIME))
+
+/*!
+    \brief      Calculates a hash value using the 32 bit FNV-1a algorithm.
+
+    \details    FNV-1a processes one byte per step and has no finalization, so
+                the result of one call can be fed as seed into the next one to
+                hash data in pieces. Short keys distribute much better than with
+                SDBM.
+
+                On targets without a cheap 32 bit multiplication the multiply
+                by the FNV prime is done with shifts and additions.
+
+    \param seed     The initial seed value, usually `HASH_FNV1A_INIT`.
+    \param data     Pointer to the data block to be hashed.
+    \param size     Size of the data block in bytes.
+
+    \return         The computed hash value as an unsigned 32-bit integer.
+*/
+uint32_t hash_fnv1a(uint32_t seed, void *data, size_t size);
+
+/*!
+    \brief      Context of an incremental FNV-1a calculation.
+
+    \details    Allows hashing data that arrives in pieces, e.g. split across
+                ring buffer segments or packet fragments, without assembling
+                it first. Feeding the same bytes in any partitioning yields
+                the result of `hash_fnv1a`.
+*/
+typedef struct {
+    uint32_t hash;          //!< Running hash value
+} hash_fnv1a_ctx_t;
+
+/*!
+    \brief      Starts an incremental FNV-1a calculation.
+
+    \param ctx      The context to initialize.
+    \param seed     The seed value, same meaning as for `hash_fnv1a`.
+*/
+void hash_fnv1a_init(hash_fnv1a_ctx_t *ctx, uint32_t seed);
+
+/*!
+    \brief      Feeds the next piece of data into an incremental FNV-1a calculation.
+
+    \param ctx      The context started with `hash_fnv1a_init`.
+    \param data     Pointer to the next piece of data, may be empty.
+    \param size     Size of the piece in bytes.
+*/
+void hash_fnv1a_update(hash_fnv1a_ctx_t *ctx, void *data, size_t size);
+
+/*!
+    \brief      Returns the result of an incremental FNV-1a calculation.
+
+    \details    The context is not modified, more data may be fed afterwards
+                to get the hash of a longer key sharing the same prefix.
+
+    \param ctx      The context started with `hash_fnv1a_init`.
+
+    \return         The hash of all data fed so far.
+*/
+uint32_t hash_fnv1a_final(hash_fnv1a_ctx_t *ctx);
+
+/*
+    Compile time hashing
+
+    Hashes of constant names can be computed by the compiler, so dispatch
+    tables and switch statements do not need to hash at runtime. Only SDBM
+    and FNV-1a are offered: MurmurHash3 and xxHash use every intermediate
+    state more than once per step (rotations, avalanche), which makes the
+    macro expansion grow exponentially with the key length.
+
+    The step macros below are written so that the running hash appears
+    exactly once, the expansion grows linearly with the key length.
+*/
+
+/*!
+    \brief      Maximum length of a string literal hashed by `HASH_SDBM_LITERAL`
+                and `HASH_FNV1A_LITERAL`.
+
+    \details    Longer literals fail to compile.
+*/
+#define HASH_LITERAL_MAX 64
+
+/*!
+    \brief      Maximum number of characters hashed by `HASH_SDBM_CHARS` and
+                `HASH_FNV1A_CHARS`.
+*/
+#define HASH_CHARS_MAX 32
+
+/*!
+    \brief      Hash of a string literal using the SDBM algorithm, computed at
+                compile time.
+
+    \details    Yields the same value as `hash_sdbm(seed, str, strlen(str))`
+                without the terminating zero. The result is a constant
+                expression usable in initializers of static tables, compilers
+                fold it even without optimization. Since C99 does not treat
+                characters of a string literal as integer constants it cannot
+                be used as case label, see `HASH_SDBM_CHARS` for that.
+
+                \code
+                static const uint32_t topics[] = {
+                    HASH_SDBM_LITERAL(0, "temperature"),
+                    HASH_SDBM_LITERAL(0, "humidity"),
+                };
+                \endcode
+
+    \param seed     The initial seed value, a constant.
+    \param str      A string literal of at most `HASH_LITERAL_MAX` characters.
+                    Pointers do not work, the length is taken with sizeof.
+
+    \return         The hash value as an unsigned 32-bit integer.
+*/
+#define HASH_SDBM_LITERAL(seed, str) \
+    ((uint32_t)(HASH_LITERAL_64(HASH_SDBM_LITERAL_STEP, seed, str, 0) + HASH_LITERAL_CHECK(str)))
+
+/*!
+    \brief      Hash of a string literal using the FNV-1a algorithm, computed at
+                compile time.
+
+    \details    Yields the same value as `hash_fnv1a(seed, str, strlen(str))`,
+                see `HASH_SDBM_LITERAL` for the restrictions.
+
+    \param seed     The initial seed value, usually `HASH_FNV1A_INIT`.
+    \param str      A string literal of at most `HASH_LITERAL_MAX` characters.
+
+    \return         The hash value as an unsigned 32-bit integer.
+*/
+#define HASH_FNV1A_LITERAL(seed, str) \
+    ((uint32_t)(HASH_LITERAL_64(HASH_FNV1A_LITERAL_STEP, seed, str, 0) + HASH_LITERAL_CHECK(str)))
+
+/*!
+    \brief      Hash of a character sequence using the SDBM algorithm, computed
+                at compile time.
+
+    \details    Yields the same value as `hash_sdbm` over the given characters.
+                The result is an integer constant expression and can be used
+                as case label:
+
+                \code
+                switch (hash_sdbm(0, name, strlen(name)))
+                {
+                    case HASH_SDBM_CHARS(0, 't','e','m','p'): ...
+                    case HASH_SDBM_CHARS(0, 'h','u','m'): ...
+                }
+                \endcode
+
+    \param seed     The initial seed value, a constant.
+    \param ...      One to `HASH_CHARS_MAX` character constants.
+
+    \return         The hash value as an unsigned 32-bit integer.
+*/
+#define HASH_SDBM_CHARS(seed, ...) \
+    ((uint32_t)HASH_FOLD(HASH_SDBM_CHARS_STEP, seed, __VA_ARGS__))
+
+/*!
+    \brief      Hash of a character sequence using the FNV-1a algorithm, computed
+                at compile time.
+
+    \details    Yields the same value as `hash_fnv1a` over the given characters,
+                see `HASH_SDBM_CHARS`.
+
+    \param seed     The initial seed value, usually `HASH_FNV1A_INIT`.
+    \param ...      One to `HASH_CHARS_MAX` character constants.
+
+    \return         The hash value as an unsigned 32-bit integer.
+*/
+#define HASH_FNV1A_CHARS(seed, ...) \
+    ((uint32_t)HASH_FOLD(hash_fnv1a_acc, seed, __VA_ARGS__))
+
+/* hash*65599 + byte is hash_sdbm_acc() with the running hash used once */
+#define HASH_SDBM_CHARS_STEP(hash, c) \
+    ((uint32_t)((hash) * 65599UL + (uint8_t)(c)))
+
+/* byte idx of str, 0 beyond its end, the index is clamped to stay inside the literal */
+#define HASH_LITERAL_BYTE(str, idx) \
+    ((idx) < sizeof(str) - 1 ? (uint8_t)(str)[(idx) < sizeof(str) ? (idx) : 0] : 0U)
+
+/* steps beyond the end of the literal leave the hash unchanged */
+#define HASH_SDBM_LITERAL_STEP(hash, str, idx) \
+    ((uint32_t)((hash) * ((idx) < sizeof(str) - 1 ? 65599UL : 1UL) + HASH_LITERAL_BYTE(str, idx)))
+
+#define HASH_FNV1A_LITERAL_STEP(hash, str, idx) \
+    ((uint32_t)(((hash) ^ HASH_LITERAL_BYTE(str, idx)) * ((idx) < sizeof(str) - 1 ? HASH_FNV1A_PRIME : 1UL)))
+
+/* 0, fails to compile if str is longer than HASH_LITERAL_MAX */
+#define HASH_LITERAL_CHECK(str) \
+    (0 * sizeof(char[1 - 2 * (sizeof(str) - 1 > HASH_LITERAL_MAX)]))
+
+#define HASH_LITERAL_4(step, hash, str, idx) \
+    step(step(step(step(hash, str, idx), str, (idx)+1), str, (idx)+2), str, (idx)+3)
+#define HASH_LITERAL_16(step, hash, str, idx) \
+    HASH_LITERAL_4(step, HASH_LITERAL_4(step, HASH_LITERAL_4(step, HASH_LITERAL_4(step, \
+    hash, str, idx), str, (idx)+4), str, (idx)+8), str, (idx)+12)
+#define HASH_LITERAL_64(step, hash, str, idx) \
+    HASH_LITERAL_16(step, HASH_LITERAL_16(step, HASH_LITERAL_16(step, HASH_LITERAL_16(step, \
+    hash, str, idx), str, (idx)+16), str, (idx)+32), str, (idx)+48)
+
+/* left fold of step over up to HASH_CHARS_MAX arguments */
+#define HASH_NARG(...) \
+    HASH_NARG_(__VA_ARGS__, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, \
+               16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define HASH_NARG_(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, \
+                   _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, count, ...) count
+
+#define HASH_FOLD(step, hash, ...) HASH_FOLD_N(HASH_NARG(__VA_ARGS__), step, hash, __VA_ARGS__)
+#define HASH_FOLD_N(count, step, hash, ...) HASH_FOLD_N_(count, step, hash, __VA_ARGS__)
+#define HASH_FOLD_N_(count, step, hash, ...) HASH_FOLD_##count(step, hash, __VA_ARGS__)
+#define HASH_FOLD_1(step, hash, c) step(hash, c)
+#define HASH_FOLD_2(step, hash, c, ...) HASH_FOLD_1(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_3(step, hash, c, ...) HASH_FOLD_2(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_4(step, hash, c, ...) HASH_FOLD_3(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_5(step, hash, c, ...) HASH_FOLD_4(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_6(step, hash, c, ...) HASH_FOLD_5(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_7(step, hash, c, ...) HASH_FOLD_6(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_8(step, hash, c, ...) HASH_FOLD_7(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_9(step, hash, c, ...) HASH_FOLD_8(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_10(step, hash, c, ...) HASH_FOLD_9(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_11(step, hash, c, ...) HASH_FOLD_10(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_12(step, hash, c, ...) HASH_FOLD_11(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_13(step, hash, c, ...) HASH_FOLD_12(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_14(step, hash, c, ...) HASH_FOLD_13(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_15(step, hash, c, ...) HASH_FOLD_14(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_16(step, hash, c, ...) HASH_FOLD_15(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_17(step, hash, c, ...) HASH_FOLD_16(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_18(step, hash, c, ...) HASH_FOLD_17(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_19(step, hash, c, ...) HASH_FOLD_18(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_20(step, hash, c, ...) HASH_FOLD_19(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_21(step, hash, c, ...) HASH_FOLD_20(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_22(step, hash, c, ...) HASH_FOLD_21(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_23(step, hash, c, ...) HASH_FOLD_22(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_24(step, hash, c, ...) HASH_FOLD_23(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_25(step, hash, c, ...) HASH_FOLD_24(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_26(step, hash, c, ...) HASH_FOLD_25(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_27(step, hash, c, ...) HASH_FOLD_26(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_28(step, hash, c, ...) HASH_FOLD_27(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_29(step, hash, c, ...) HASH_FOLD_28(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_30(step, hash, c, ...) HASH_FOLD_29(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_31(step, hash, c, ...) HASH_FOLD_30(step, step(hash, c), __VA_ARGS__)
+#define HASH_FOLD_32(step, hash, c, ...) HASH_FOLD_31(step, step(hash, c), __VA_ARGS__)
+
+/*!
+    \brief      Calculates a hash value using the MurmurHash3 x86_32 algorithm.
+
+    \details    Processes four bytes per step and finishes with an avalanche
+                step, every input bit affects every output bit. The result is
+                identical to the reference implementation `MurmurHash3_x86_32`
+                on any byte order.
+
+    \param seed     The seed value for the hash computation.
+    \param data     Pointer to the data block to be hashed.
+    \param size     Size of the data block in bytes.
+
+    \return         The computed hash value as an unsigned 32-bit integer.
+*/
+uint32_t hash_murmur3(uint32_t seed, void *data, size_t size);
+
+/*!
+    \brief      Context of an incremental MurmurHash3 calculation.
+
+    \details    Allows hashing data that arrives in pieces, e.g. split across
+                ring buffer segments or packet fragments, without assembling
+                it first. Feeding the same bytes in any partitioning yields
+                the result of `hash_murmur3`.
+*/
+typedef struct {
+    uint32_t hash;          //!< Hash over all complete blocks
+    uint32_t total;         //!< Number of bytes fed so far
+    uint8_t buffer[4];      //!< Incomplete block
+    uint8_t buffered;       //!< Number of bytes in buffer
+} hash_murmur3_ctx_t;
+
+/*!
+    \brief      Starts an incremental MurmurHash3 calculation.
+
+    \param ctx      The context to initialize.
+    \param seed     The seed value, same meaning as for `hash_murmur3`.
+*/
+void hash_murmur3_init(hash_murmur3_ctx_t *ctx, uint32_t seed);
+
+/*!
+    \brief      Feeds the next piece of data into an incremental MurmurHash3 calculation.
+
+    \param ctx      The context started with `hash_murmur3_init`.
+    \param data     Pointer to the next piece of data, may be empty.
+    \param size     Size of the piece in bytes.
+*/
+void hash_murmur3_update(hash_murmur3_ctx_t *ctx, void *data, size_t size);
+
+/*!
+    \brief      Returns the result of an incremental MurmurHash3 calculation.
+
+    \details    The context is not modified, more data may be fed afterwards
+                to get the hash of a longer key sharing the same prefix.
+
+    \param ctx      The context started with `hash_murmur3_init`.
+
+    \return         The hash of all data fed so far.
+*/
+uint32_t hash_murmur3_final(hash_murmur3_ctx_t *ctx);
+
+/*!
+    \brief      Calculates a hash value using the xxHash32 algorithm.
+
+    \details    Processes sixteen bytes per step in four independent lanes,
+                which makes it the fastest 32 bit hash of this module for long
+                inputs. The result is identical to the reference implementation
+                `XXH32` on any byte order.
+
+    \param seed     The seed value for the hash computation.
+    \param data     Pointer to the data block to be hashed.
+    \param size     Size of the data block in bytes.
+
+    \return         The computed hash value as an unsigned 32-bit integer.
+*/
+uint32_t hash_xxh32(uint32_t seed, void *data, size_t size);
+
+/*!
+    \brief      Context of an incremental xxHash32 calculation.
+
+    \details    Allows hashing data that arrives in pieces, e.g. split across
+                ring buffer segments or packet fragments, without assembling
+                it first. Feeding the same bytes in any partitioning yields
+                the result of `hash_xxh32`.
+*/
+typedef struct {
+    uint32_t lanes[4];      //!< Accumulators over all complete stripes
+    uint32_t seed;          //!< Seed, needed for keys shorter than a stripe
+    uint32_t total;         //!< Number of bytes fed so far, modulo 2^32
+    uint8_t buffer[16];     //!< Incomplete stripe
+    uint8_t buffered;       //!< Number of bytes in buffer
+    uint8_t large;          //!< At least one stripe has been processed
+} hash_xxh32_ctx_t;
+
+/*!
+    \brief      Starts an incremental xxHash32 calculation.
+
+    \param ctx      The context to initialize.
+    \param seed     The seed value, same meaning as for `hash_xxh32`.
+*/
+void hash_xxh32_init(hash_xxh32_ctx_t *ctx, uint32_t seed);
+
+/*!
+    \brief      Feeds the next piece of data into an incremental xxHash32 calculation.
+
+    \param ctx      The context started with `hash_xxh32_init`.
+    \param data     Pointer to the next piece of data, may be empty.
+    \param size     Size of the piece in bytes.
+*/
+void hash_xxh32_update(hash_xxh32_ctx_t *ctx, void *data, size_t size);
+
+/*!
+    \brief      Returns the result of an incremental xxHash32 calculation.
+
+    \details    The context is not modified, more data may be fed afterwards
+                to get the hash of a longer key sharing the same prefix.
+
+    \param ctx      The context started with `hash_xxh32_init`.
+
+    \return         The hash of all data fed so far.
+*/
+uint32_t hash_xxh32_final(hash_xxh32_ctx_t *ctx);
+
+#if defined(UINT64_MAX) || defined(DOXYGEN)
+/*!
+    \brief      Calculates a hash value using the xxHash64 algorithm.
+
+    \details    Processes thirty-two bytes per step in four independent lanes
+                of 64 bit. Only available on toolchains providing 64 bit
+                integers, cc65 for instance does not. The result is identical
+                to the reference implementation `XXH64` on any byte order.
+
+    \param seed     The seed value for the hash computation.
+    \param data     Pointer to the data block to be hashed.
+    \param size     Size of the data block in bytes.
+
+    \return         The computed hash value as an unsigned 64-bit integer.
+*/
+uint64_t hash_xxh64(uint64_t seed, void *data, size_t size);
+
+/*!
+    \brief      Context of an incremental xxHash64 calculation.
+
+    \details    Allows hashing data that arrives in pieces, e.g. split across
+                ring buffer segments or packet fragments, without assembling
+                it first. Feeding the same bytes in any partitioning yields
+                the result of `hash_xxh64`.
+*/
+typedef struct {
+    uint64_t lanes[4];      //!< Accumulators over all complete stripes
+    uint64_t seed;          //!< Seed, needed for keys shorter than a stripe
+    uint64_t total;         //!< Number of bytes fed so far
+    uint8_t buffer[32];     //!< Incomplete stripe
+    uint8_t buffered;       //!< Number of bytes in buffer
+} hash_xxh64_ctx_t;
+
+/*!
+    \brief      Starts an incremental xxHash64 calculation.
+
+    \param ctx      The context to initialize.
+    \param seed     The seed value, same meaning as for `hash_xxh64`.
+*/
+void hash_xxh64_init(hash_xxh64_ctx_t *ctx, uint64_t seed);
+
+/*!
+    \brief      Feeds the next piece of data into an incremental xxHash64 calculation.
+
+    \param ctx      The context started with `hash_xxh64_init`.
+    \param data     Pointer to the next piece of data, may be empty.
+    \param size     Size of the piece in bytes.
+*/
+void hash_xxh64_update(hash_xxh64_ctx_t *ctx, void *data, size_t size);
+
+/*!
+    \brief      Returns the result of an incremental xxHash64 calculation.
+
+    \details    The context is not modified, more data may be fed afterwards
+                to get the hash of a longer key sharing the same prefix.
+
+    \param ctx      The context started with `hash_xxh64_init`.
+
+    \return         The hash of all data fed so far.
+*/
+uint64_t hash_xxh64_final(hash_xxh64_ctx_t *ctx);
+#endif
 
 
 
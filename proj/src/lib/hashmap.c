@@ -0,0 +1,174 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       hashmap.c
+
+    \brief      Intrusive chained hash map with a statically allocated bucket array
+
+    \details    see header file
+*/
+#include "hashmap.h"
+
+static slist_t* hashmap_bucket(hashmap_t *map, uint32_t hash)
+{
+    /* masking is much cheaper than a 32 bit division on small targets */
+    if ((map->size & (map->size - 1)) == 0)
+    {
+        return &map->buckets[hash & (map->size - 1)];
+    }
+
+    return &map->buckets[hash % map->size];
+}
+
+void hashmap_init(hashmap_t *map, slist_t *buckets, size_t size, hashmap_hash_t hash, hashmap_equal_t equal)
+{
+    map->hash = hash;
+    map->equal = equal;
+    map->buckets = buckets;
+    map->size = size;
+    hashmap_clear(map);
+}
+
+void hashmap_clear(hashmap_t *map)
+{
+    size_t idx;
+
+    for (idx = 0; idx < map->size; idx++)
+    {
+        slist_init(&map->buckets[idx]);
+    }
+
+    map->count = 0;
+}
+
+/* searches the chain of the bucket of hash for key */
+static hashmap_node_t* hashmap_lookup(hashmap_t *map, slist_t *bucket, uint32_t hash, const void *key)
+{
+    slist_node_t *iterator;
+
+    slist_foreach(bucket,iterator)
+    {
+        hashmap_node_t *node = container_of(iterator, hashmap_node_t, link);
+
+        if (node->hash == hash && map->equal(node, key))
+        {
+            return node;
+        }
+    }
+
+    return NULL;
+}
+
+hashmap_node_t* hashmap_insert(hashmap_t *map, hashmap_node_t *node, const void *key)
+{
+    uint32_t hash = map->hash(key);
+    slist_t *bucket = hashmap_bucket(map, hash);
+    hashmap_node_t *existing = hashmap_lookup(map, bucket, hash, key);
+
+    if (existing)
+    {
+        return existing;
+    }
+
+    node->hash = hash;
+    slist_push_front(bucket, &node->link);
+    map->count++;
+
+    return node;
+}
+
+hashmap_node_t* hashmap_find(hashmap_t *map, const void *key)
+{
+    uint32_t hash = map->hash(key);
+
+    return hashmap_lookup(map, hashmap_bucket(map, hash), hash, key);
+}
+
+void hashmap_erase(hashmap_t *map, hashmap_node_t *node)
+{
+    /* the chain is circular, the predecessor is found walking from the node itself */
+    slist_erase(hashmap_bucket(map, node->hash), &node->link);
+    map->count--;
+}
+
+hashmap_node_t* hashmap_remove(hashmap_t *map, const void *key)
+{
+    uint32_t hash = map->hash(key);
+    slist_t *bucket = hashmap_bucket(map, hash);
+    slist_node_t *prev;
+    slist_node_t *iterator;
+
+    /* a single walk, the predecessor is known when the key is found */
+    slist_foreach_prev(bucket,prev,iterator)
+    {
+        hashmap_node_t *node = container_of(iterator, hashmap_node_t, link);
+
+        if (node->hash == hash && map->equal(node, key))
+        {
+            slist_erase_after(bucket, prev);
+            map->count--;
+            return node;
+        }
+    }
+
+    return NULL;
+}
+
+/* first node of the buckets starting at bucket, NULL if they are all empty */
+static hashmap_node_t* hashmap_scan(hashmap_t *map, slist_t *bucket)
+{
+    slist_t *end = &map->buckets[map->size];
+
+    for (; bucket != end; bucket++)
+    {
+        if (!slist_empty(bucket))
+        {
+            return container_of(slist_begin(bucket), hashmap_node_t, link);
+        }
+    }
+
+    return NULL;
+}
+
+hashmap_node_t* hashmap_first(hashmap_t *map)
+{
+    return hashmap_scan(map, map->buckets);
+}
+
+hashmap_node_t* hashmap_next(hashmap_t *map, hashmap_node_t *node)
+{
+    slist_t *bucket = hashmap_bucket(map, node->hash);
+
+    if (slist_next(bucket, &node->link) != slist_end(bucket))
+    {
+        return container_of(slist_next(bucket, &node->link), hashmap_node_t, link);
+    }
+
+    return hashmap_scan(map, bucket + 1);
+}
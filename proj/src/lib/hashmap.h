@@ -0,0 +1,297 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       hashmap.h
+
+    \brief      Intrusive chained hash map with a statically allocated bucket array
+
+    \details    A hash map stores nodes which are embedded into user defined
+                structures, the map itself never allocates memory. Each bucket
+                is a circular singly linked list (see slist.h), colliding nodes
+                are chained in the bucket of their hash. Insert, find and erase
+                take O(1) on average as long as the number of nodes stays in
+                the order of the number of buckets.
+
+                The key lives inside the user structure. The map only knows it
+                through two user supplied callbacks, one hashing a key and one
+                comparing a node against a key. The hash of every node is cached
+                in the node, so chains are scanned by comparing hashes first and
+                the equality callback only runs on probable matches.
+
+                Bucket count: a power of two selects the bucket by masking the
+                low bits of the hash, which is fast but needs a hash with good
+                low bits (murmur3, xxh32). Any other bucket count selects the
+                bucket modulo the bucket count, a prime count tolerates weaker
+                hashes like SDBM. See bench_hash for measurements.
+
+                \code
+                typedef struct {
+                    hashmap_node_t node;
+                    uint16_t id;
+                    int value;
+                } entry_t;
+
+                uint32_t entry_hash(const void *key)
+                {
+                    return hash_murmur3(0, (void*)key, sizeof(uint16_t));
+                }
+
+                bool entry_equal(const hashmap_node_t *node, const void *key)
+                {
+                    return container_of(node, entry_t, node)->id == *(const uint16_t*)key;
+                }
+
+                HASHMAP_TYPEDEF(entries, 64);
+                HASHMAP_T(entries) map;
+
+                HASHMAP_INIT(map, entry_hash, entry_equal);
+                hashmap_insert(HASHMAP(map), &entry->node, &entry->id);
+                node = hashmap_find(HASHMAP(map), &id);
+                \endcode
+*/
+
+#ifndef HASHMAP_H_
+#define HASHMAP_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "slist.h"
+#include "utils.h"
+
+/*!
+    \brief      Hash map node, to be embedded into the user structure.
+
+    \details    Use `container_of` to get from a node to the enclosing structure.
+*/
+typedef struct {
+    slist_node_t link;      //!< Link within the bucket chain
+    uint32_t hash;          //!< Cached hash of the key
+} hashmap_node_t;
+
+/*!
+    \brief      Computes the hash of a key.
+
+    \param key  Pointer to the key, as passed to the hash map functions.
+
+    \return     The hash of the key.
+*/
+typedef uint32_t (*hashmap_hash_t)(const void *key);
+
+/*!
+    \brief      Compares the key of a node against a key.
+
+    \param node Node within the hash map.
+    \param key  Pointer to the key, as passed to the hash map functions.
+
+    \return     True if the key of the node equals the given key.
+*/
+typedef bool (*hashmap_equal_t)(const hashmap_node_t *node, const void *key);
+
+/*!
+    \brief      Hash map control structure.
+
+    \details    Usually embedded by `HASHMAP_TYPEDEF` together with its bucket
+                array, but can be set up on any array of `slist_t` with
+                `hashmap_init`.
+*/
+typedef struct {
+    hashmap_hash_t hash;    //!< Hashes a key
+    hashmap_equal_t equal;  //!< Compares a node against a key
+    slist_t *buckets;       //!< Array of bucket chains
+    size_t size;            //!< Number of buckets
+    size_t count;           //!< Number of nodes in the map
+} hashmap_t;
+
+/*!
+    \brief      Defines a new hash map type with a fixed number of buckets.
+
+    \param name     The base name of the new type, the type is `name##_hashmap_t`.
+    \param size     The number of buckets.
+*/
+#define HASHMAP_TYPEDEF(name,size) \
+    typedef struct { \
+        hashmap_t map; \
+        slist_t buckets[size]; \
+    }name##_hashmap_t
+
+/*!
+    \brief      Names a hash map type defined with `HASHMAP_TYPEDEF`.
+
+    \param name     The base name as specified in `HASHMAP_TYPEDEF`.
+*/
+#define HASHMAP_T(name) \
+    name##_hashmap_t
+
+/*!
+    \brief      Accesses the bucket array of a hash map instance.
+
+    \param hashmap  The variable of a type defined with `HASHMAP_TYPEDEF`.
+*/
+#define HASHMAP_BUCKETS(hashmap) \
+    ((hashmap).buckets)
+
+/*!
+    \brief      Calculates the number of buckets of a hash map instance.
+
+    \param hashmap  The variable of a type defined with `HASHMAP_TYPEDEF`.
+*/
+#define HASHMAP_SIZE(hashmap) \
+    (sizeof(HASHMAP_BUCKETS(hashmap))/sizeof(*HASHMAP_BUCKETS(hashmap)))
+
+/*!
+    \brief      Returns a pointer to the control structure of a hash map instance.
+
+    \details    All `hashmap_*` functions and macros take this pointer.
+
+    \param hashmap  The variable of a type defined with `HASHMAP_TYPEDEF`.
+*/
+#define HASHMAP(hashmap) \
+    (&(hashmap).map)
+
+/*!
+    \brief      Initializes a hash map instance to be empty.
+
+    \param hashmap  The variable of a type defined with `HASHMAP_TYPEDEF`.
+    \param hash     The hash callback, see `hashmap_hash_t`.
+    \param equal    The equality callback, see `hashmap_equal_t`.
+*/
+#define HASHMAP_INIT(hashmap,hash,equal) \
+    hashmap_init(HASHMAP(hashmap),HASHMAP_BUCKETS(hashmap),HASHMAP_SIZE(hashmap),hash,equal)
+
+/*!
+    \brief      Returns the number of nodes in the hash map.
+
+    \param map  Pointer to the hash map control structure.
+*/
+#define hashmap_size(map) \
+    (((hashmap_t*)(map))->count)
+
+/*!
+    \brief      Checks if the hash map is empty.
+
+    \param map  Pointer to the hash map control structure.
+*/
+#define hashmap_empty(map) \
+    (((hashmap_t*)(map))->count == 0)
+
+/*!
+    \brief      Iterates over all nodes of a hash map in bucket order.
+
+    \details    The map must not be modified during the iteration, except for
+                erasing the current node followed by a `break`.
+
+    \param map      Pointer to the hash map control structure.
+    \param iterator A pointer to a `hashmap_node_t` used as iterator.
+*/
+#define hashmap_foreach(map,iterator) \
+    for(iterator = hashmap_first(map); (iterator) != NULL; iterator = hashmap_next(map,iterator))
+
+/*!
+    \brief      Initializes a hash map on a bucket array.
+
+    \param map      Pointer to the hash map control structure.
+    \param buckets  Array of `size` bucket chains.
+    \param size     Number of buckets, at least one.
+    \param hash     The hash callback, see `hashmap_hash_t`.
+    \param equal    The equality callback, see `hashmap_equal_t`.
+*/
+void hashmap_init(hashmap_t *map, slist_t *buckets, size_t size, hashmap_hash_t hash, hashmap_equal_t equal);
+
+/*!
+    \brief      Removes all nodes from the hash map.
+
+    \details    The nodes are not touched, O(number of buckets).
+
+    \param map  Pointer to the hash map control structure.
+*/
+void hashmap_clear(hashmap_t *map);
+
+/*!
+    \brief      Inserts a node unless its key is already present.
+
+    \param map  Pointer to the hash map control structure.
+    \param node The node to insert, must not be part of a hash map.
+    \param key  Pointer to the key of the node.
+
+    \return     `node` if it has been inserted, otherwise the node already
+                holding an equal key, `node` is not inserted in that case.
+*/
+hashmap_node_t* hashmap_insert(hashmap_t *map, hashmap_node_t *node, const void *key);
+
+/*!
+    \brief      Looks up the node holding a key.
+
+    \param map  Pointer to the hash map control structure.
+    \param key  Pointer to the key to search for.
+
+    \return     The node holding an equal key, or NULL if there is none.
+*/
+hashmap_node_t* hashmap_find(hashmap_t *map, const void *key);
+
+/*!
+    \brief      Removes a node from the hash map.
+
+    \details    The bucket is selected by the cached hash, the key is not needed.
+
+    \param map  Pointer to the hash map control structure.
+    \param node A node which is part of the hash map.
+*/
+void hashmap_erase(hashmap_t *map, hashmap_node_t *node);
+
+/*!
+    \brief      Removes the node holding a key.
+
+    \param map  Pointer to the hash map control structure.
+    \param key  Pointer to the key to remove.
+
+    \return     The removed node, or NULL if the key was not present.
+*/
+hashmap_node_t* hashmap_remove(hashmap_t *map, const void *key);
+
+/*!
+    \brief      Returns the first node in bucket order.
+
+    \param map  Pointer to the hash map control structure.
+
+    \return     The first node, or NULL if the hash map is empty.
+*/
+hashmap_node_t* hashmap_first(hashmap_t *map);
+
+/*!
+    \brief      Returns the node following a node in bucket order.
+
+    \param map  Pointer to the hash map control structure.
+    \param node A node which is part of the hash map.
+
+    \return     The next node, or NULL if `node` is the last one.
+*/
+hashmap_node_t* hashmap_next(hashmap_t *map, hashmap_node_t *node);
+
+#endif /* HASHMAP_H_ */
@@ -0,0 +1,238 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       hll.c
+
+    \brief      HyperLogLog cardinality estimator
+
+    \details    see header file
+*/
+#include <string.h>
+#include <limits.h>
+#include "hll.h"
+#include "hash.h"
+#include "bits.h"
+
+#define HLL_SEED    0x3C6EF372UL
+
+/* ln(2) in Q16 */
+#define HLL_LN2     45426UL
+
+#define hll_count_of(hll) \
+    (1UL << (hll)->precision)
+
+void hll_init(hll_t *hll, uint8_t *registers, uint32_t count)
+{
+    hll->registers = registers;
+    hll->precision = 0;
+
+    while (count > 1)
+    {
+        count >>= 1;
+        hll->precision++;
+    }
+
+    hll_clear(hll);
+}
+
+void hll_clear(hll_t *hll)
+{
+    memset(hll->registers, 0x00, (size_t)hll_count_of(hll));
+}
+
+bool hll_add_hash(hll_t *hll, uint32_t hash)
+{
+    uint8_t *reg = &hll->registers[hash >> (32 - hll->precision)];
+    uint32_t rest = hash << hll->precision;
+    uint8_t rank;
+
+    if (rest == 0)
+    {
+        rank = (uint8_t)(33 - hll->precision);
+    }
+    else
+    {
+#if defined(__GNUC__) && UINT_MAX == 0xFFFFFFFFUL
+        rank = (uint8_t)(__builtin_clz(rest) + 1);
+#else
+        rank = 1;
+
+        while (!(rest & 0x80000000UL))
+        {
+            rest <<= 1;
+            rank++;
+        }
+#endif
+    }
+
+    if (rank > *reg)
+    {
+        *reg = rank;
+        return true;
+    }
+
+    return false;
+}
+
+bool hll_add(hll_t *hll, void *key, size_t size)
+{
+    return hll_add_hash(hll, hash_murmur3(HLL_SEED, key, size));
+}
+
+bool hll_merge(hll_t *dst, hll_t *src)
+{
+    uint32_t idx;
+
+    if (dst->precision != src->precision)
+    {
+        return false;
+    }
+
+    for (idx = 0; idx < hll_count_of(dst); idx++)
+    {
+        if (src->registers[idx] > dst->registers[idx])
+        {
+            dst->registers[idx] = src->registers[idx];
+        }
+    }
+
+    return true;
+}
+
+/* natural logarithm from a Q16 base 2 logarithm, split to stay within 32 bits */
+static uint32_t hll_ln(uint32_t log2)
+{
+    return (log2 >> 16) * HLL_LN2 + (((log2 & 0xFFFFUL) * HLL_LN2) >> 16);
+}
+
+/* alpha_m in Q16, 0.7213/(1+1.079/m) for 128 and more registers */
+static uint32_t hll_alpha(uint8_t precision)
+{
+    switch (precision)
+    {
+        case 4: return 44106UL;
+        case 5: return 45679UL;
+        case 6: return 46465UL;
+        default: break;
+    }
+
+    return 47271UL - 51005409UL / (1000UL * (1UL << precision) + 1079UL);
+}
+
+/*
+    The raw estimate alpha*m^2/Z with Z the sum of 2^-register, in integer
+    arithmetic. All registers are at least the smallest register r0, so Z is
+    accumulated as 2^-r0 times a sum in Q(31-p), which stays below 2^31 for
+    m = 2^p registers and only drops terms below 2^-(31-p) of the largest one.
+    alpha*m^2*2^(31-p+r0)/2^16 then equals alpha16*2^(p+r0+15), the division
+    produces the quotient bit by bit so the dividend never needs more than 32
+    bits.
+*/
+uint32_t hll_count(hll_t *hll)
+{
+    uint8_t precision = hll->precision;
+    uint8_t q = (uint8_t)(31 - precision);
+    uint32_t count = hll_count_of(hll);
+    uint32_t zeros = 0;
+    uint32_t sum = 0;
+    uint32_t estimate;
+    uint32_t rest;
+    uint32_t idx;
+    uint8_t smallest = UINT8_MAX;
+    uint8_t shift;
+
+    for (idx = 0; idx < count; idx++)
+    {
+        uint8_t rank = hll->registers[idx];
+
+        if (rank < smallest)
+        {
+            smallest = rank;
+        }
+
+        if (rank == 0)
+        {
+            zeros++;
+        }
+    }
+
+    for (idx = 0; idx < count; idx++)
+    {
+        uint8_t rank = (uint8_t)(hll->registers[idx] - smallest);
+
+        if (rank <= q)
+        {
+            sum += 1UL << (q - rank);
+        }
+    }
+
+    estimate = (hll_alpha(precision) << 15) / sum;
+    rest = (hll_alpha(precision) << 15) % sum;
+
+    for (shift = (uint8_t)(precision + smallest); shift; shift--)
+    {
+        if (estimate & 0x80000000UL)
+        {
+            return UINT32_MAX;
+        }
+
+        estimate <<= 1;
+        rest <<= 1;
+
+        if (rest >= sum)
+        {
+            rest -= sum;
+            estimate |= 1;
+        }
+    }
+
+    /* linear counting, m*ln(m/zeros) */
+    if (zeros && estimate <= count * 5 / 2)
+    {
+        uint32_t ln = hll_ln(((uint32_t)precision << 16) - bits_log2_q16(zeros));
+        uint8_t down = (uint8_t)(16 - precision);
+
+        return (ln + ((1UL << down) >> 1)) >> down;
+    }
+
+    /* hash collisions of the 32 bit hash, -2^32*ln(1-E/2^32) */
+    if (estimate > 0xFFFFFFFFUL / 30)
+    {
+        uint32_t ln = hll_ln((32UL << 16) - bits_log2_q16(UINT32_MAX - estimate + 1));
+
+        if (ln >= 0x10000UL)
+        {
+            return UINT32_MAX;
+        }
+
+        return ln << 16;
+    }
+
+    return estimate;
+}
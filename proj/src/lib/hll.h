@@ -0,0 +1,176 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       hll.h
+
+    \brief      HyperLogLog cardinality estimator
+
+    \details    Estimates the number of distinct keys added to a sketch without
+                storing the keys. A sketch of 2^p one byte registers has a
+                standard error of about 1.04/sqrt(2^p): 256 bytes (p = 8) give
+                6.5%, 4 KiB (p = 12) give 1.6%, independent of the count.
+
+                Each key is hashed with `hash_murmur3`. The top p bits of the
+                hash select a register, which keeps the longest run of leading
+                zeros plus one seen in the remaining bits. Sketches of the same
+                precision can be merged, the result equals a sketch that saw
+                the keys of both.
+
+                The estimate is computed in integer arithmetic, no floating
+                point support is needed. It applies the linear counting
+                correction for small and the 32 bit hash correction for large
+                cardinalities.
+*/
+
+#ifndef HLL_H_
+#define HLL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/*!
+    \brief      Smallest supported precision, 16 registers.
+*/
+#define HLL_PRECISION_MIN   4
+
+/*!
+    \brief      Largest supported precision, 65536 registers.
+*/
+#define HLL_PRECISION_MAX   16
+
+/*!
+    \brief      HyperLogLog sketch control structure.
+*/
+typedef struct {
+    uint8_t *registers;     //!< 2^precision registers
+    uint8_t precision;      //!< Number of hash bits selecting the register, p
+} hll_t;
+
+/*!
+    \brief      Defines a new HyperLogLog sketch type.
+
+    \param name         The base name of the new type, the type is `name##_hll_t`.
+    \param precision    The number of register index bits, between
+                        `HLL_PRECISION_MIN` and `HLL_PRECISION_MAX`.
+*/
+#define HLL_TYPEDEF(name,precision) \
+    typedef struct { \
+        hll_t hll; \
+        uint8_t registers[1UL<<(precision)]; \
+    }name##_hll_t
+
+/*!
+    \brief      Names a HyperLogLog sketch type defined with `HLL_TYPEDEF`.
+
+    \param name     The base name as specified in `HLL_TYPEDEF`.
+*/
+#define HLL_T(name) \
+    name##_hll_t
+
+/*!
+    \brief      Returns a pointer to the control structure of a sketch instance.
+
+    \param sketch   The variable of a type defined with `HLL_TYPEDEF`.
+*/
+#define HLL(sketch) \
+    (&(sketch).hll)
+
+/*!
+    \brief      Initializes a sketch instance to be empty.
+
+    \param sketch   The variable of a type defined with `HLL_TYPEDEF`.
+*/
+#define HLL_INIT(sketch) \
+    hll_init(HLL(sketch),(sketch).registers,sizeof((sketch).registers))
+
+/*!
+    \brief      Initializes a sketch on an array of registers.
+
+    \param hll      Pointer to the sketch control structure.
+    \param registers Array of `count` registers.
+    \param count    Number of registers, a power of two between
+                    2^`HLL_PRECISION_MIN` and 2^`HLL_PRECISION_MAX`.
+*/
+void hll_init(hll_t *hll, uint8_t *registers, uint32_t count);
+
+/*!
+    \brief      Removes all keys from a sketch.
+
+    \param hll      Pointer to the sketch control structure.
+*/
+void hll_clear(hll_t *hll);
+
+/*!
+    \brief      Adds a key to a sketch.
+
+    \param hll      Pointer to the sketch control structure.
+    \param key      Pointer to the key bytes.
+    \param size     Size of the key in bytes.
+
+    \return     True if a register changed, false if the sketch stays the same.
+*/
+bool hll_add(hll_t *hll, void *key, size_t size);
+
+/*!
+    \brief      Adds an already hashed key to a sketch.
+
+    \details    For callers that have a well mixed 32 bit hash of the key at
+                hand, e.g. from a hash map.
+
+    \param hll      Pointer to the sketch control structure.
+    \param hash     The 32 bit hash of the key.
+
+    \return     True if a register changed, false if the sketch stays the same.
+*/
+bool hll_add_hash(hll_t *hll, uint32_t hash);
+
+/*!
+    \brief      Merges a sketch into another one.
+
+    \details    Afterwards `dst` estimates the number of distinct keys added to
+                either sketch.
+
+    \param dst      Pointer to the sketch receiving the keys.
+    \param src      Pointer to the sketch to merge, not modified.
+
+    \return     False if the precisions differ and nothing was merged, true otherwise.
+*/
+bool hll_merge(hll_t *dst, hll_t *src);
+
+/*!
+    \brief      Estimates the number of distinct keys added to a sketch.
+
+    \param hll      Pointer to the sketch control structure.
+
+    \return     The estimated number of distinct keys, saturating at UINT32_MAX.
+*/
+uint32_t hll_count(hll_t *hll);
+
+#endif /* HLL_H_ */
@@ -0,0 +1,208 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       pheap.c
+
+    \brief      Intrusive pairing heap
+
+    \details    see header file
+*/
+#include "pheap.h"
+
+/* links the root with the greater key as first child of the other, both are detached roots */
+static pheap_node_t* pheap_link(pheap_t *heap, pheap_node_t *a, pheap_node_t *b)
+{
+    pheap_node_t *swap;
+
+    if (heap->compare(b, a) < 0)
+    {
+        swap = a;
+        a = b;
+        b = swap;
+    }
+
+    b->prev = a;
+    b->next = a->child;
+
+    if (a->child)
+    {
+        a->child->prev = b;
+    }
+
+    a->child = b;
+    a->next = NULL;
+    a->prev = NULL;
+
+    return a;
+}
+
+/* melds a list of siblings into a single tree, two passes without recursion */
+static pheap_node_t* pheap_merge_pairs(pheap_t *heap, pheap_node_t *first)
+{
+    pheap_node_t *pairs = NULL;
+    pheap_node_t *tree;
+    pheap_node_t *next;
+
+    if (first == NULL)
+    {
+        return NULL;
+    }
+
+    /* left to right, the melded pairs are stacked in reverse through next */
+    while (first)
+    {
+        tree = first;
+        next = first->next;
+
+        if (next)
+        {
+            first = next->next;
+            tree = pheap_link(heap, tree, next);
+        }
+        else
+        {
+            first = NULL;
+        }
+
+        tree->next = pairs;
+        pairs = tree;
+    }
+
+    /* right to left, accumulating into the last pair */
+    tree = pairs;
+    pairs = pairs->next;
+
+    while (pairs)
+    {
+        next = pairs->next;
+        tree = pheap_link(heap, tree, pairs);
+        pairs = next;
+    }
+
+    tree->next = NULL;
+    tree->prev = NULL;
+
+    return tree;
+}
+
+/* cuts the subtree of a non root node out of its sibling list */
+static void pheap_detach(pheap_node_t *node)
+{
+    if (node->prev->child == node)
+    {
+        node->prev->child = node->next;
+    }
+    else
+    {
+        node->prev->next = node->next;
+    }
+
+    if (node->next)
+    {
+        node->next->prev = node->prev;
+    }
+
+    node->next = NULL;
+    node->prev = NULL;
+}
+
+void pheap_init(pheap_t *heap, pheap_compare_t compare)
+{
+    heap->root = NULL;
+    heap->compare = compare;
+    heap->count = 0;
+}
+
+void pheap_insert(pheap_t *heap, pheap_node_t *node)
+{
+    node->child = NULL;
+    node->next = NULL;
+    node->prev = NULL;
+
+    heap->root = heap->root ? pheap_link(heap, heap->root, node) : node;
+    heap->count++;
+}
+
+pheap_node_t* pheap_pop(pheap_t *heap)
+{
+    pheap_node_t *root = heap->root;
+
+    if (root)
+    {
+        heap->root = pheap_merge_pairs(heap, root->child);
+        heap->count--;
+    }
+
+    return root;
+}
+
+void pheap_erase(pheap_t *heap, pheap_node_t *node)
+{
+    pheap_node_t *subtree;
+
+    if (node == heap->root)
+    {
+        pheap_pop(heap);
+        return;
+    }
+
+    pheap_detach(node);
+    subtree = pheap_merge_pairs(heap, node->child);
+
+    if (subtree)
+    {
+        heap->root = pheap_link(heap, heap->root, subtree);
+    }
+
+    heap->count--;
+}
+
+void pheap_decrease_key(pheap_t *heap, pheap_node_t *node)
+{
+    if (node == heap->root)
+    {
+        return;
+    }
+
+    /* the subtree stays heap ordered below the lowered key */
+    pheap_detach(node);
+    heap->root = pheap_link(heap, heap->root, node);
+}
+
+void pheap_meld(pheap_t *heap, pheap_t *other)
+{
+    if (other->root)
+    {
+        heap->root = heap->root ? pheap_link(heap, heap->root, other->root) : other->root;
+        heap->count += other->count;
+    }
+
+    other->root = NULL;
+    other->count = 0;
+}
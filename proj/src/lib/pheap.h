@@ -0,0 +1,197 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       pheap.h
+
+    \brief      Intrusive pairing heap
+
+    \details    A pairing heap is a heap ordered multiway tree: no node orders
+                before its parent, so the minimum is always the root. Two heaps
+                are melded in O(1) by making the root with the greater key the
+                first child of the other root. Deleting the minimum melds the
+                children of the root pairwise from left to right and then the
+                pairs from right to left, which keeps the tree shallow.
+                [Wikipedia - Pairing heap](https://en.wikipedia.org/wiki/Pairing_heap)
+
+                Find-min, insert, meld and decrease-key are O(1), delete-min and
+                erase are O(log n) amortized. This makes it a good fit for timer
+                queues: expiring timers pop the minimum, rescheduling a timer to
+                an earlier deadline is a decrease-key and cancelling one is an
+                erase of an arbitrary node.
+
+                Like the lists in slist.h and dlist.h the heap stores nodes which
+                are embedded into user defined structures and never allocates
+                memory. `container_of` gets from a node to the enclosing structure.
+
+                \code
+                typedef struct {
+                    pheap_node_t node;
+                    uint32_t deadline;
+                } app_timer_t;
+
+                int timer_compare(const pheap_node_t *a, const pheap_node_t *b)
+                {
+                    uint32_t da = container_of(a, app_timer_t, node)->deadline;
+                    uint32_t db = container_of(b, app_timer_t, node)->deadline;
+                    return da < db ? -1 : da > db;
+                }
+
+                pheap_t timers;
+
+                pheap_init(&timers, timer_compare);
+                pheap_insert(&timers, &timer->node);
+
+                timer->deadline -= 10;
+                pheap_decrease_key(&timers, &timer->node);
+
+                expired = container_of(pheap_pop(&timers), app_timer_t, node);
+                \endcode
+*/
+
+#ifndef PHEAP_H_
+#define PHEAP_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "utils.h"
+
+/*!
+    \brief      Pairing heap node, to be embedded into the user structure.
+
+    \details    Use `container_of` to get from a node to the enclosing structure.
+*/
+typedef struct pheap_node_t pheap_node_t;
+
+struct pheap_node_t {
+    pheap_node_t *child;    //!< First child
+    pheap_node_t *next;     //!< Next sibling
+    pheap_node_t *prev;     //!< Previous sibling, the parent for a first child, NULL for the root
+};
+
+/*!
+    \brief      Compares two nodes for ordering.
+
+    \param a    The first node.
+    \param b    The second node.
+
+    \return     Less than zero if a orders before b, zero if they are equal,
+                greater than zero if a orders after b.
+*/
+typedef int (*pheap_compare_t)(const pheap_node_t *a, const pheap_node_t *b);
+
+/*!
+    \brief      Pairing heap control structure.
+*/
+typedef struct {
+    pheap_node_t *root;         //!< Node with the smallest key, NULL if the heap is empty
+    pheap_compare_t compare;    //!< Orders the nodes
+    size_t count;               //!< Number of nodes in the heap
+} pheap_t;
+
+/*!
+    \brief      Returns the node with the smallest key in O(1).
+
+    \param heap Pointer to the heap control structure.
+
+    \return     The minimum node, or NULL if the heap is empty.
+*/
+#define pheap_min(heap) \
+    (((pheap_t*)(heap))->root)
+
+/*!
+    \brief      Returns the number of nodes in the heap.
+
+    \param heap Pointer to the heap control structure.
+*/
+#define pheap_size(heap) \
+    (((pheap_t*)(heap))->count)
+
+/*!
+    \brief      Checks if the heap is empty.
+
+    \param heap Pointer to the heap control structure.
+*/
+#define pheap_empty(heap) \
+    (((pheap_t*)(heap))->root == NULL)
+
+/*!
+    \brief      Initializes an empty heap.
+
+    \param heap     Pointer to the heap control structure.
+    \param compare  The ordering of the nodes, see `pheap_compare_t`.
+*/
+void pheap_init(pheap_t *heap, pheap_compare_t compare);
+
+/*!
+    \brief      Inserts a node in O(1).
+
+    \param heap Pointer to the heap control structure.
+    \param node The node to insert, must not be part of a heap.
+*/
+void pheap_insert(pheap_t *heap, pheap_node_t *node);
+
+/*!
+    \brief      Removes the node with the smallest key. O(log n) amortized.
+
+    \param heap Pointer to the heap control structure.
+
+    \return     The removed node, or NULL if the heap was empty.
+*/
+pheap_node_t* pheap_pop(pheap_t *heap);
+
+/*!
+    \brief      Removes any node from the heap. O(log n) amortized.
+
+    \param heap Pointer to the heap control structure.
+    \param node A node which is part of the heap.
+*/
+void pheap_erase(pheap_t *heap, pheap_node_t *node);
+
+/*!
+    \brief      Restores the heap order after the key of a node decreased. O(1).
+
+    \details    The key may only have been lowered, for a raised key erase and
+                insert the node again.
+
+    \param heap Pointer to the heap control structure.
+    \param node A node which is part of the heap.
+*/
+void pheap_decrease_key(pheap_t *heap, pheap_node_t *node);
+
+/*!
+    \brief      Moves all nodes of another heap into a heap in O(1).
+
+    \details    Both heaps must use the same ordering, `other` is left empty.
+
+    \param heap  Pointer to the heap control structure receiving the nodes.
+    \param other Pointer to the heap control structure giving the nodes.
+*/
+void pheap_meld(pheap_t *heap, pheap_t *other);
+
+#endif /* PHEAP_H_ */
@@ -0,0 +1,465 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       rbtree.c
+
+    \brief      Intrusive red-black tree
+
+    \details    see header file
+*/
+#include "rbtree.h"
+
+#define rbtree_is_red(node) \
+    ((node) != NULL && (node)->color == RBTREE_RED)
+
+/* hooks new into the place of old below parent */
+static void rbtree_replace(rbtree_t *tree, rbtree_node_t *parent, rbtree_node_t *old, rbtree_node_t *new)
+{
+    if (parent == NULL)
+    {
+        tree->root = new;
+    }
+    else if (parent->left == old)
+    {
+        parent->left = new;
+    }
+    else
+    {
+        parent->right = new;
+    }
+}
+
+static void rbtree_rotate_left(rbtree_t *tree, rbtree_node_t *node)
+{
+    rbtree_node_t *pivot = node->right;
+
+    node->right = pivot->left;
+
+    if (pivot->left)
+    {
+        pivot->left->parent = node;
+    }
+
+    pivot->parent = node->parent;
+    rbtree_replace(tree, node->parent, node, pivot);
+    pivot->left = node;
+    node->parent = pivot;
+}
+
+static void rbtree_rotate_right(rbtree_t *tree, rbtree_node_t *node)
+{
+    rbtree_node_t *pivot = node->left;
+
+    node->left = pivot->right;
+
+    if (pivot->right)
+    {
+        pivot->right->parent = node;
+    }
+
+    pivot->parent = node->parent;
+    rbtree_replace(tree, node->parent, node, pivot);
+    pivot->right = node;
+    node->parent = pivot;
+}
+
+static rbtree_node_t* rbtree_leftmost(rbtree_node_t *node)
+{
+    while (node->left)
+    {
+        node = node->left;
+    }
+
+    return node;
+}
+
+static rbtree_node_t* rbtree_rightmost(rbtree_node_t *node)
+{
+    while (node->right)
+    {
+        node = node->right;
+    }
+
+    return node;
+}
+
+/* links the red node below parent and restores the red-black properties */
+static void rbtree_link(rbtree_t *tree, rbtree_node_t *parent, rbtree_node_t **link, rbtree_node_t *node)
+{
+    rbtree_node_t *grandparent;
+    rbtree_node_t *uncle;
+
+    node->left = NULL;
+    node->right = NULL;
+    node->parent = parent;
+    node->color = RBTREE_RED;
+    *link = node;
+    tree->count++;
+
+    while ((parent = node->parent) != NULL && parent->color == RBTREE_RED)
+    {
+        /* a red parent is never the root, the grandparent exists */
+        grandparent = parent->parent;
+
+        if (parent == grandparent->left)
+        {
+            uncle = grandparent->right;
+
+            if (rbtree_is_red(uncle))
+            {
+                parent->color = RBTREE_BLACK;
+                uncle->color = RBTREE_BLACK;
+                grandparent->color = RBTREE_RED;
+                node = grandparent;
+                continue;
+            }
+
+            if (node == parent->right)
+            {
+                rbtree_rotate_left(tree, parent);
+                parent = node;
+            }
+
+            parent->color = RBTREE_BLACK;
+            grandparent->color = RBTREE_RED;
+            rbtree_rotate_right(tree, grandparent);
+        }
+        else
+        {
+            uncle = grandparent->left;
+
+            if (rbtree_is_red(uncle))
+            {
+                parent->color = RBTREE_BLACK;
+                uncle->color = RBTREE_BLACK;
+                grandparent->color = RBTREE_RED;
+                node = grandparent;
+                continue;
+            }
+
+            if (node == parent->left)
+            {
+                rbtree_rotate_right(tree, parent);
+                parent = node;
+            }
+
+            parent->color = RBTREE_BLACK;
+            grandparent->color = RBTREE_RED;
+            rbtree_rotate_left(tree, grandparent);
+        }
+
+        break;
+    }
+
+    tree->root->color = RBTREE_BLACK;
+}
+
+void rbtree_init(rbtree_t *tree, rbtree_compare_t compare)
+{
+    tree->root = NULL;
+    tree->compare = compare;
+    tree->count = 0;
+}
+
+rbtree_node_t* rbtree_insert(rbtree_t *tree, rbtree_node_t *node, const void *key)
+{
+    rbtree_node_t *parent = NULL;
+    rbtree_node_t **link = &tree->root;
+
+    while (*link)
+    {
+        int result = tree->compare(*link, key);
+
+        if (result == 0)
+        {
+            return *link;
+        }
+
+        parent = *link;
+        link = result > 0 ? &parent->left : &parent->right;
+    }
+
+    rbtree_link(tree, parent, link, node);
+
+    return node;
+}
+
+void rbtree_insert_multi(rbtree_t *tree, rbtree_node_t *node, const void *key)
+{
+    rbtree_node_t *parent = NULL;
+    rbtree_node_t **link = &tree->root;
+
+    /* equal keys descend to the right, behind the nodes already present */
+    while (*link)
+    {
+        parent = *link;
+        link = tree->compare(parent, key) > 0 ? &parent->left : &parent->right;
+    }
+
+    rbtree_link(tree, parent, link, node);
+}
+
+void rbtree_erase(rbtree_t *tree, rbtree_node_t *node)
+{
+    rbtree_node_t *child;
+    rbtree_node_t *parent;
+    rbtree_node_t *sibling;
+    uint8_t color;
+
+    if (node->left == NULL || node->right == NULL)
+    {
+        child = node->left ? node->left : node->right;
+        parent = node->parent;
+        color = node->color;
+
+        if (child)
+        {
+            child->parent = parent;
+        }
+
+        rbtree_replace(tree, parent, node, child);
+    }
+    else
+    {
+        /* the successor has no left child, it takes the place of node */
+        rbtree_node_t *successor = rbtree_leftmost(node->right);
+
+        child = successor->right;
+        color = successor->color;
+
+        if (successor->parent == node)
+        {
+            parent = successor;
+        }
+        else
+        {
+            parent = successor->parent;
+            parent->left = child;
+
+            if (child)
+            {
+                child->parent = parent;
+            }
+
+            successor->right = node->right;
+            node->right->parent = successor;
+        }
+
+        successor->left = node->left;
+        node->left->parent = successor;
+        successor->parent = node->parent;
+        successor->color = node->color;
+        rbtree_replace(tree, node->parent, node, successor);
+    }
+
+    tree->count--;
+
+    if (color == RBTREE_RED)
+    {
+        return;
+    }
+
+    /* a black node is gone, the path through child lacks one black node */
+    while (child != tree->root && !rbtree_is_red(child))
+    {
+        if (child == parent->left)
+        {
+            sibling = parent->right;
+
+            if (sibling->color == RBTREE_RED)
+            {
+                sibling->color = RBTREE_BLACK;
+                parent->color = RBTREE_RED;
+                rbtree_rotate_left(tree, parent);
+                sibling = parent->right;
+            }
+
+            if (!rbtree_is_red(sibling->left) && !rbtree_is_red(sibling->right))
+            {
+                sibling->color = RBTREE_RED;
+                child = parent;
+                parent = child->parent;
+                continue;
+            }
+
+            if (!rbtree_is_red(sibling->right))
+            {
+                sibling->left->color = RBTREE_BLACK;
+                sibling->color = RBTREE_RED;
+                rbtree_rotate_right(tree, sibling);
+                sibling = parent->right;
+            }
+
+            sibling->color = parent->color;
+            parent->color = RBTREE_BLACK;
+            sibling->right->color = RBTREE_BLACK;
+            rbtree_rotate_left(tree, parent);
+        }
+        else
+        {
+            sibling = parent->left;
+
+            if (sibling->color == RBTREE_RED)
+            {
+                sibling->color = RBTREE_BLACK;
+                parent->color = RBTREE_RED;
+                rbtree_rotate_right(tree, parent);
+                sibling = parent->left;
+            }
+
+            if (!rbtree_is_red(sibling->left) && !rbtree_is_red(sibling->right))
+            {
+                sibling->color = RBTREE_RED;
+                child = parent;
+                parent = child->parent;
+                continue;
+            }
+
+            if (!rbtree_is_red(sibling->left))
+            {
+                sibling->right->color = RBTREE_BLACK;
+                sibling->color = RBTREE_RED;
+                rbtree_rotate_left(tree, sibling);
+                sibling = parent->left;
+            }
+
+            sibling->color = parent->color;
+            parent->color = RBTREE_BLACK;
+            sibling->left->color = RBTREE_BLACK;
+            rbtree_rotate_right(tree, parent);
+        }
+
+        child = tree->root;
+        break;
+    }
+
+    if (child)
+    {
+        child->color = RBTREE_BLACK;
+    }
+}
+
+rbtree_node_t* rbtree_lower_bound(rbtree_t *tree, const void *key)
+{
+    rbtree_node_t *node = tree->root;
+    rbtree_node_t *bound = NULL;
+
+    while (node)
+    {
+        if (tree->compare(node, key) >= 0)
+        {
+            bound = node;
+            node = node->left;
+        }
+        else
+        {
+            node = node->right;
+        }
+    }
+
+    return bound;
+}
+
+rbtree_node_t* rbtree_upper_bound(rbtree_t *tree, const void *key)
+{
+    rbtree_node_t *node = tree->root;
+    rbtree_node_t *bound = NULL;
+
+    while (node)
+    {
+        if (tree->compare(node, key) > 0)
+        {
+            bound = node;
+            node = node->left;
+        }
+        else
+        {
+            node = node->right;
+        }
+    }
+
+    return bound;
+}
+
+rbtree_node_t* rbtree_find(rbtree_t *tree, const void *key)
+{
+    rbtree_node_t *node = rbtree_lower_bound(tree, key);
+
+    if (node && tree->compare(node, key) == 0)
+    {
+        return node;
+    }
+
+    return NULL;
+}
+
+rbtree_node_t* rbtree_first(rbtree_t *tree)
+{
+    return tree->root ? rbtree_leftmost(tree->root) : NULL;
+}
+
+rbtree_node_t* rbtree_last(rbtree_t *tree)
+{
+    return tree->root ? rbtree_rightmost(tree->root) : NULL;
+}
+
+rbtree_node_t* rbtree_next(rbtree_t *tree, rbtree_node_t *node)
+{
+    (void)tree;
+
+    if (node->right)
+    {
+        return rbtree_leftmost(node->right);
+    }
+
+    /* climb until coming up from a left subtree */
+    while (node->parent && node == node->parent->right)
+    {
+        node = node->parent;
+    }
+
+    return node->parent;
+}
+
+rbtree_node_t* rbtree_prev(rbtree_t *tree, rbtree_node_t *node)
+{
+    (void)tree;
+
+    if (node->left)
+    {
+        return rbtree_rightmost(node->left);
+    }
+
+    while (node->parent && node == node->parent->left)
+    {
+        node = node->parent;
+    }
+
+    return node->parent;
+}
@@ -0,0 +1,271 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       rbtree.h
+
+    \brief      Intrusive red-black tree
+
+    \details    A red-black tree is a binary search tree which keeps itself
+                balanced: every node is colored red or black, no red node has
+                a red child and every path from a node down to its leaves passes
+                the same number of black nodes. The longest path is thus at most
+                twice the shortest and insert, erase and find take O(log n).
+                [Wikipedia - Red-black tree](https://en.wikipedia.org/wiki/Red%E2%80%93black_tree)
+
+                Like the lists in slist.h and dlist.h the tree stores nodes which
+                are embedded into user defined structures, the tree itself never
+                allocates memory. `container_of` gets from a node to the enclosing
+                structure. Nodes keep a parent link, so in-order iteration, erase
+                and rebalancing need neither recursion nor a stack.
+
+                The key lives inside the user structure, the tree only knows it
+                through a user supplied callback comparing a node against a key.
+
+                \code
+                typedef struct {
+                    rbtree_node_t node;
+                    uint32_t deadline;
+                } app_timer_t;
+
+                int timer_compare(const rbtree_node_t *node, const void *key)
+                {
+                    uint32_t deadline = container_of(node, app_timer_t, node)->deadline;
+                    uint32_t other = *(const uint32_t*)key;
+                    return deadline < other ? -1 : deadline > other;
+                }
+
+                rbtree_t timers;
+                rbtree_node_t *iterator;
+
+                rbtree_init(&timers, timer_compare);
+                rbtree_insert_multi(&timers, &timer->node, &timer->deadline);
+
+                rbtree_foreach(&timers, iterator)
+                {
+                    ...
+                }
+                \endcode
+*/
+
+#ifndef RBTREE_H_
+#define RBTREE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "utils.h"
+
+/*!
+    \brief      Red-black tree node, to be embedded into the user structure.
+
+    \details    Use `container_of` to get from a node to the enclosing structure.
+*/
+typedef struct rbtree_node_t rbtree_node_t;
+
+struct rbtree_node_t {
+    rbtree_node_t *left;    //!< Subtree of smaller keys
+    rbtree_node_t *right;   //!< Subtree of greater keys
+    rbtree_node_t *parent;  //!< Parent node, NULL for the root
+    uint8_t color;          //!< RBTREE_RED or RBTREE_BLACK
+};
+
+#define RBTREE_RED      0   //!< Color of a red node
+#define RBTREE_BLACK    1   //!< Color of a black node
+
+/*!
+    \brief      Compares the key of a node against a key.
+
+    \param node Node within the tree.
+    \param key  Pointer to the key, as passed to the tree functions.
+
+    \return     Less than zero if the key of the node orders before `key`, zero
+                if they are equal, greater than zero if it orders after `key`.
+*/
+typedef int (*rbtree_compare_t)(const rbtree_node_t *node, const void *key);
+
+/*!
+    \brief      Red-black tree control structure.
+*/
+typedef struct {
+    rbtree_node_t *root;        //!< Root node, NULL if the tree is empty
+    rbtree_compare_t compare;   //!< Compares a node against a key
+    size_t count;               //!< Number of nodes in the tree
+} rbtree_t;
+
+/*!
+    \brief      Returns the number of nodes in the tree.
+
+    \param tree Pointer to the tree control structure.
+*/
+#define rbtree_size(tree) \
+    (((rbtree_t*)(tree))->count)
+
+/*!
+    \brief      Checks if the tree is empty.
+
+    \param tree Pointer to the tree control structure.
+*/
+#define rbtree_empty(tree) \
+    (((rbtree_t*)(tree))->root == NULL)
+
+/*!
+    \brief      Iterates over all nodes of the tree in ascending key order.
+
+    \details    The tree must not be modified during the iteration, except for
+                erasing the current node followed by a `break`.
+
+    \param tree     Pointer to the tree control structure.
+    \param iterator A pointer to a `rbtree_node_t` used as iterator.
+*/
+#define rbtree_foreach(tree,iterator) \
+    for(iterator = rbtree_first(tree); (iterator) != NULL; iterator = rbtree_next(tree,iterator))
+
+/*!
+    \brief      Iterates over all nodes of the tree in descending key order.
+
+    \param tree     Pointer to the tree control structure.
+    \param iterator A pointer to a `rbtree_node_t` used as iterator.
+*/
+#define rbtree_foreach_reverse(tree,iterator) \
+    for(iterator = rbtree_last(tree); (iterator) != NULL; iterator = rbtree_prev(tree,iterator))
+
+/*!
+    \brief      Initializes an empty tree.
+
+    \param tree     Pointer to the tree control structure.
+    \param compare  The comparison callback, see `rbtree_compare_t`.
+*/
+void rbtree_init(rbtree_t *tree, rbtree_compare_t compare);
+
+/*!
+    \brief      Inserts a node unless its key is already present. O(log n).
+
+    \param tree Pointer to the tree control structure.
+    \param node The node to insert, must not be part of a tree.
+    \param key  Pointer to the key of the node.
+
+    \return     `node` if it has been inserted, otherwise the node already
+                holding an equal key, `node` is not inserted in that case.
+*/
+rbtree_node_t* rbtree_insert(rbtree_t *tree, rbtree_node_t *node, const void *key);
+
+/*!
+    \brief      Inserts a node allowing duplicate keys. O(log n).
+
+    \details    The node is placed after all nodes holding an equal key, so
+                iteration visits equal keys in insertion order.
+
+    \param tree Pointer to the tree control structure.
+    \param node The node to insert, must not be part of a tree.
+    \param key  Pointer to the key of the node.
+*/
+void rbtree_insert_multi(rbtree_t *tree, rbtree_node_t *node, const void *key);
+
+/*!
+    \brief      Removes a node from the tree. O(log n).
+
+    \param tree Pointer to the tree control structure.
+    \param node A node which is part of the tree.
+*/
+void rbtree_erase(rbtree_t *tree, rbtree_node_t *node);
+
+/*!
+    \brief      Looks up the first node holding a key. O(log n).
+
+    \param tree Pointer to the tree control structure.
+    \param key  Pointer to the key to search for.
+
+    \return     The first node in key order holding an equal key, or NULL if
+                there is none.
+*/
+rbtree_node_t* rbtree_find(rbtree_t *tree, const void *key);
+
+/*!
+    \brief      Looks up the first node whose key does not order before a key. O(log n).
+
+    \param tree Pointer to the tree control structure.
+    \param key  Pointer to the key to search for.
+
+    \return     The first node with a key greater than or equal to `key`, or
+                NULL if all keys order before `key`.
+*/
+rbtree_node_t* rbtree_lower_bound(rbtree_t *tree, const void *key);
+
+/*!
+    \brief      Looks up the first node whose key orders after a key. O(log n).
+
+    \param tree Pointer to the tree control structure.
+    \param key  Pointer to the key to search for.
+
+    \return     The first node with a key greater than `key`, or NULL if there
+                is none.
+*/
+rbtree_node_t* rbtree_upper_bound(rbtree_t *tree, const void *key);
+
+/*!
+    \brief      Returns the node with the smallest key. O(log n).
+
+    \param tree Pointer to the tree control structure.
+
+    \return     The first node, or NULL if the tree is empty.
+*/
+rbtree_node_t* rbtree_first(rbtree_t *tree);
+
+/*!
+    \brief      Returns the node with the greatest key. O(log n).
+
+    \param tree Pointer to the tree control structure.
+
+    \return     The last node, or NULL if the tree is empty.
+*/
+rbtree_node_t* rbtree_last(rbtree_t *tree);
+
+/*!
+    \brief      Returns the node following a node in key order.
+
+    \details    O(1) amortized over a full iteration, O(log n) worst case.
+
+    \param tree Pointer to the tree control structure.
+    \param node A node which is part of the tree.
+
+    \return     The next node, or NULL if `node` is the last one.
+*/
+rbtree_node_t* rbtree_next(rbtree_t *tree, rbtree_node_t *node);
+
+/*!
+    \brief      Returns the node preceding a node in key order.
+
+    \param tree Pointer to the tree control structure.
+    \param node A node which is part of the tree.
+
+    \return     The previous node, or NULL if `node` is the first one.
+*/
+rbtree_node_t* rbtree_prev(rbtree_t *tree, rbtree_node_t *node);
+
+#endif /* RBTREE_H_ */
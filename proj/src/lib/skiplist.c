@@ -0,0 +1,217 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       skiplist.c
+
+    \brief      Intrusive skip list
+
+    \details    see header file
+*/
+#include "skiplist.h"
+
+#define skiplist_end(list,level) \
+    (&(list)->head.link[level])
+
+void skiplist_init(skiplist_t *list, skiplist_compare_t compare)
+{
+    uint8_t level;
+
+    for (level = 0; level < SKIPLIST_LEVELS; level++)
+    {
+        slist_init(skiplist_end(list,level));
+    }
+
+    list->head.levels = SKIPLIST_LEVELS;
+    list->compare = compare;
+    list->count = 0;
+    list->random = 0xACE1;
+}
+
+/* xorshift16, every further level with probability 1/2 */
+static uint8_t skiplist_random_levels(skiplist_t *list)
+{
+    uint16_t random = list->random;
+    uint8_t levels = 1;
+
+    random ^= (uint16_t)(random << 7);
+    random ^= (uint16_t)(random >> 9);
+    random ^= (uint16_t)(random << 8);
+    list->random = random;
+
+    while (levels < SKIPLIST_LEVELS && (random & 1))
+    {
+        levels++;
+        random >>= 1;
+    }
+
+    return levels;
+}
+
+/*
+    Walks down from the top level and returns the last node ordering before
+    key, or at key if after_equal is set. Each link is loaded once, so this
+    is safe against a concurrent writer. Stores the predecessor link of every
+    level in update unless it is NULL.
+*/
+static skiplist_node_t* skiplist_search(skiplist_t *list, const void *key, bool after_equal, slist_node_t **update)
+{
+    skiplist_node_t *node = &list->head;
+    slist_node_t *next;
+    uint8_t level = SKIPLIST_LEVELS;
+
+    while (level--)
+    {
+        while ((next = skiplist_link_load(&node->link[level])) != skiplist_end(list,level))
+        {
+            int result = list->compare(skiplist_entry(next,level), key);
+
+            if (result > 0 || (result == 0 && !after_equal))
+            {
+                break;
+            }
+
+            node = skiplist_entry(next,level);
+        }
+
+        if (update)
+        {
+            update[level] = &node->link[level];
+        }
+    }
+
+    return node;
+}
+
+/* fills in the links of node, then publishes it after the predecessors, level 0 first */
+static void skiplist_link(skiplist_t *list, skiplist_node_t *node, slist_node_t **update)
+{
+    uint8_t level;
+
+    node->levels = skiplist_random_levels(list);
+
+    for (level = 0; level < node->levels; level++)
+    {
+        node->link[level].next = update[level]->next;
+    }
+
+    for (level = 0; level < node->levels; level++)
+    {
+        skiplist_link_store(update[level], &node->link[level]);
+    }
+
+    list->count++;
+}
+
+skiplist_node_t* skiplist_insert(skiplist_t *list, skiplist_node_t *node, const void *key)
+{
+    slist_node_t *update[SKIPLIST_LEVELS];
+    slist_node_t *next = skiplist_link_load(&skiplist_search(list, key, false, update)->link[0]);
+
+    if (next != skiplist_end(list,0) && list->compare(skiplist_entry(next,0), key) == 0)
+    {
+        return skiplist_entry(next,0);
+    }
+
+    skiplist_link(list, node, update);
+
+    return node;
+}
+
+void skiplist_insert_multi(skiplist_t *list, skiplist_node_t *node, const void *key)
+{
+    slist_node_t *update[SKIPLIST_LEVELS];
+
+    skiplist_search(list, key, true, update);
+    skiplist_link(list, node, update);
+}
+
+void skiplist_erase(skiplist_t *list, skiplist_node_t *node, const void *key)
+{
+    skiplist_node_t *pos = &list->head;
+    slist_node_t *next;
+    uint8_t level = SKIPLIST_LEVELS;
+
+    /*
+        Above the node the walk stops before equal keys, which may follow the
+        node. On its levels the walk runs up to the node itself, top down, so
+        readers keep reaching it on the lower levels until it is gone.
+    */
+    while (level--)
+    {
+        while ((next = pos->link[level].next) != skiplist_end(list,level) && next != &node->link[level])
+        {
+            if (level >= node->levels && list->compare(skiplist_entry(next,level), key) >= 0)
+            {
+                break;
+            }
+
+            pos = skiplist_entry(next,level);
+        }
+
+        if (level < node->levels)
+        {
+            skiplist_link_store(&pos->link[level], node->link[level].next);
+        }
+    }
+
+    list->count--;
+}
+
+skiplist_node_t* skiplist_lower_bound(skiplist_t *list, const void *key)
+{
+    slist_node_t *next = skiplist_link_load(&skiplist_search(list, key, false, NULL)->link[0]);
+
+    return next == skiplist_end(list,0) ? NULL : skiplist_entry(next,0);
+}
+
+skiplist_node_t* skiplist_find(skiplist_t *list, const void *key)
+{
+    skiplist_node_t *node = skiplist_lower_bound(list, key);
+
+    if (node && list->compare(node, key) == 0)
+    {
+        return node;
+    }
+
+    return NULL;
+}
+
+skiplist_node_t* skiplist_first(skiplist_t *list)
+{
+    slist_node_t *next = skiplist_link_load(skiplist_list(list));
+
+    return next == skiplist_list(list) ? NULL : skiplist_entry(next,0);
+}
+
+skiplist_node_t* skiplist_next(skiplist_t *list, skiplist_node_t *node)
+{
+    slist_node_t *next = skiplist_link_load(&node->link[0]);
+
+    return next == skiplist_list(list) ? NULL : skiplist_entry(next,0);
+}
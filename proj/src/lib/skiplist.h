@@ -0,0 +1,302 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       skiplist.h
+
+    \brief      Intrusive skip list
+
+    \details    A skip list is a sorted linked list with additional express
+                lanes: every node is on level 0 and, with probability 1/2 each,
+                also on the levels above. A search starts on the highest level
+                and drops one level whenever the next node would overshoot the
+                key, which takes O(log n) expected steps like a balanced tree.
+                [Wikipedia - Skip list](https://en.wikipedia.org/wiki/Skip_list)
+
+                Every level is a circular singly linked list of `slist_node_t`
+                (see slist.h) whose sentinel is the tower of the control
+                structure, so level 0 is an ordinary sorted slist. `skiplist_list`
+                returns it and all reading slist macros, `slist_foreach`,
+                `slist_front`, `slist_next` and so on, work on a skip list while
+                no writer runs concurrently. Code iterating a sorted slist can
+                migrate by changing only the inserts.
+
+                The node tower of `SKIPLIST_LEVELS` links is embedded into the
+                user structure, the skip list never allocates memory. The number
+                of levels is bounded at compile time; a skip list stays O(log n)
+                up to about 2^SKIPLIST_LEVELS nodes. As it fixes the node
+                layout, `SKIPLIST_LEVELS` is a library wide setting made in
+                proj/CMakeLists.txt (16 on hosted builds, else the default of 8
+                below) and must not be defined for single translation units.
+                Node heights are drawn from a xorshift generator kept in the
+                control structure, so they are reproducible and need no library
+                support.
+
+                Readers using the skip list functions need no lock as long as
+                there is only one writer at a time. An insert fills in the links
+                of the new node first and then publishes it from level 0
+                upwards, an erase unlinks the node from the top level down and
+                leaves its own links intact, so a reader standing on an erased
+                node still finds its way back into the list. The skip list does
+                not track readers, so an erased node must never be freed, reused
+                or inserted again while readers are running; recycle it only at
+                a point where the writer knows that no reader is within the skip
+                list. With `SKIPLIST_ENABLE_BARRIER` (GCC and Clang on hosted
+                builds) links are published with release stores and followed
+                with acquire loads. Without it the links are plain pointers, so
+                on targets storing pointers bytewise readers running in
+                interrupts need the writer to lock.
+
+                \code
+                typedef struct {
+                    skiplist_node_t node;
+                    uint16_t id;
+                } session_t;
+
+                int session_compare(const skiplist_node_t *node, const void *key)
+                {
+                    uint16_t id = container_of(node, session_t, node)->id;
+                    return id < *(const uint16_t*)key ? -1 : id > *(const uint16_t*)key;
+                }
+
+                skiplist_t sessions;
+
+                skiplist_init(&sessions, session_compare);
+                skiplist_insert(&sessions, &session->node, &session->id);
+                node = skiplist_find(&sessions, &id);
+                \endcode
+*/
+
+#ifndef SKIPLIST_H_
+#define SKIPLIST_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "slist.h"
+#include "utils.h"
+
+#ifndef SKIPLIST_LEVELS
+#define SKIPLIST_LEVELS 8   //!< Height of the node towers, set library wide in proj/CMakeLists.txt
+#endif
+
+#if SKIPLIST_LEVELS < 1 || SKIPLIST_LEVELS > 16
+#error "SKIPLIST_LEVELS must be within 1 and 16"
+#endif
+
+#if defined(SKIPLIST_ENABLE_BARRIER) && !defined(__GNUC__)
+#undef SKIPLIST_ENABLE_BARRIER
+#endif
+
+/*!
+    \brief      Reads the successor of a link, as a concurrent reader may.
+*/
+#if defined(SKIPLIST_ENABLE_BARRIER)
+#define skiplist_link_load(link) \
+    __atomic_load_n(&(link)->next, __ATOMIC_ACQUIRE)
+#else
+#define skiplist_link_load(link) \
+    ((link)->next)
+#endif
+
+/*!
+    \brief      Sets the successor of a link that concurrent readers may follow.
+*/
+#if defined(SKIPLIST_ENABLE_BARRIER)
+#define skiplist_link_store(link,node) \
+    __atomic_store_n(&(link)->next, (node), __ATOMIC_RELEASE)
+#else
+#define skiplist_link_store(link,node) \
+    ((link)->next = (node))
+#endif
+
+/*!
+    \brief      Skip list node, to be embedded into the user structure.
+
+    \details    Use `container_of` to get from a node to the enclosing structure.
+                `link[0]` is the node on the level 0 slist.
+*/
+typedef struct {
+    slist_node_t link[SKIPLIST_LEVELS]; //!< Links per level, only the lowest `levels` are used
+    uint8_t levels;                     //!< Number of levels the node is on
+} skiplist_node_t;
+
+/*!
+    \brief      Compares the key of a node against a key.
+
+    \param node Node within the skip list.
+    \param key  Pointer to the key, as passed to the skip list functions.
+
+    \return     Less than zero if the key of the node orders before `key`, zero
+                if they are equal, greater than zero if it orders after `key`.
+*/
+typedef int (*skiplist_compare_t)(const skiplist_node_t *node, const void *key);
+
+/*!
+    \brief      Skip list control structure.
+*/
+typedef struct {
+    skiplist_node_t head;           //!< Sentinel tower, the end of every level
+    skiplist_compare_t compare;     //!< Compares a node against a key
+    size_t count;                   //!< Number of nodes in the skip list
+    uint16_t random;                //!< State of the node height generator
+} skiplist_t;
+
+/*!
+    \brief      Returns the node owning a link of a given level.
+
+    \param link  A pointer to `link[level]` of a node.
+    \param level The level of the link.
+*/
+#define skiplist_entry(link,level) \
+    ((skiplist_node_t*)(((slist_node_t*)(link)) - (level)))
+
+/*!
+    \brief      Returns the level 0 list of the skip list.
+
+    \details    A sorted circular singly linked list, all reading slist macros
+                can be used on it. Its nodes are `link[0]` of the skip list
+                nodes, `skiplist_entry(node,0)` converts them back.
+
+    \param list Pointer to the skip list control structure.
+*/
+#define skiplist_list(list) \
+    (&((skiplist_t*)(list))->head.link[0])
+
+/*!
+    \brief      Returns the number of nodes in the skip list.
+
+    \param list Pointer to the skip list control structure.
+*/
+#define skiplist_size(list) \
+    (((skiplist_t*)(list))->count)
+
+/*!
+    \brief      Checks if the skip list is empty.
+
+    \param list Pointer to the skip list control structure.
+*/
+#define skiplist_empty(list) \
+    (skiplist_link_load(skiplist_list(list)) == skiplist_list(list))
+
+/*!
+    \brief      Returns the node with the smallest key in O(1).
+
+    \param list Pointer to the skip list control structure.
+
+    \return     The first node, or NULL if the skip list is empty.
+*/
+skiplist_node_t* skiplist_first(skiplist_t *list);
+
+/*!
+    \brief      Returns the node following a node in key order in O(1).
+
+    \param list Pointer to the skip list control structure.
+    \param node A node which is part of the skip list.
+
+    \return     The next node, or NULL if `node` is the last one.
+*/
+skiplist_node_t* skiplist_next(skiplist_t *list, skiplist_node_t *node);
+
+/*!
+    \brief      Iterates over all nodes of the skip list in ascending key order.
+
+    \details    Erasing the current node is allowed, its links stay intact.
+
+    \param list     Pointer to the skip list control structure.
+    \param iterator A pointer to a `skiplist_node_t` used as iterator.
+*/
+#define skiplist_foreach(list,iterator) \
+    for(iterator = skiplist_first(list); (iterator) != NULL; iterator = skiplist_next(list,iterator))
+
+/*!
+    \brief      Initializes an empty skip list.
+
+    \param list     Pointer to the skip list control structure.
+    \param compare  The comparison callback, see `skiplist_compare_t`.
+*/
+void skiplist_init(skiplist_t *list, skiplist_compare_t compare);
+
+/*!
+    \brief      Inserts a node unless its key is already present. O(log n).
+
+    \param list Pointer to the skip list control structure.
+    \param node The node to insert, must not be part of a skip list.
+    \param key  Pointer to the key of the node.
+
+    \return     `node` if it has been inserted, otherwise the node already
+                holding an equal key, `node` is not inserted in that case.
+*/
+skiplist_node_t* skiplist_insert(skiplist_t *list, skiplist_node_t *node, const void *key);
+
+/*!
+    \brief      Inserts a node allowing duplicate keys. O(log n).
+
+    \details    The node is placed after all nodes holding an equal key.
+
+    \param list Pointer to the skip list control structure.
+    \param node The node to insert, must not be part of a skip list.
+    \param key  Pointer to the key of the node.
+*/
+void skiplist_insert_multi(skiplist_t *list, skiplist_node_t *node, const void *key);
+
+/*!
+    \brief      Removes a node from the skip list. O(log n).
+
+    \param list Pointer to the skip list control structure.
+    \param node A node which is part of the skip list.
+    \param key  Pointer to the key of the node.
+*/
+void skiplist_erase(skiplist_t *list, skiplist_node_t *node, const void *key);
+
+/*!
+    \brief      Looks up the first node whose key does not order before a key. O(log n).
+
+    \details    Safe to call concurrently with a writer.
+
+    \param list Pointer to the skip list control structure.
+    \param key  Pointer to the key to search for.
+
+    \return     The first node with a key greater than or equal to `key`, or
+                NULL if all keys order before `key`.
+*/
+skiplist_node_t* skiplist_lower_bound(skiplist_t *list, const void *key);
+
+/*!
+    \brief      Looks up the first node holding a key. O(log n).
+
+    \details    Safe to call concurrently with a writer.
+
+    \param list Pointer to the skip list control structure.
+    \param key  Pointer to the key to search for.
+
+    \return     The first node holding an equal key, or NULL if there is none.
+*/
+skiplist_node_t* skiplist_find(skiplist_t *list, const void *key);
+
+#endif /* SKIPLIST_H_ */
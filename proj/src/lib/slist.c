@@ -48,6 +48,24 @@ slist_node_t* slist_prev(slist_t *list, slist_node_t* node)
     return iterator;
 }
 
+slist_node_t* slist_prev_prev(slist_t *list, slist_node_t* node)
+{
+    slist_node_t *prev_prev = node;
+    slist_node_t *prev = slist_next(list,prev_prev);
+    slist_node_t *iterator = slist_next(list,prev);
+
+    (void)list; /* the list is circular, slist_next does not need it */
+
+    while( iterator != node )
+    {
+        prev_prev = prev;
+        prev = iterator;
+        iterator = slist_next(list,iterator);
+    }
+
+    return prev_prev;
+}
+
 
 
 slist_node_t* slist_find(slist_t* list, slist_node_t* node)
@@ -78,7 +96,172 @@ size_t slist_size(slist_t *list)
    return size;
 }
 
+/* merges two sorted NULL terminated chains, on equal keys first comes first */
+static slist_node_t* slist_merge_chains(slist_node_t *first, slist_node_t *second, slist_compare_t compare)
+{
+    slist_node_t head;
+    slist_node_t *tail = &head;
+
+    while (first && second)
+    {
+        if (compare(second, first) < 0)
+        {
+            tail->next = second;
+            second = second->next;
+        }
+        else
+        {
+            tail->next = first;
+            first = first->next;
+        }
+
+        tail = tail->next;
+    }
+
+    tail->next = first ? first : second;
+
+    return head.next;
+}
+
+/*
+    Bottom up merge sort without recursion. bins[idx] holds a sorted run of
+    2^idx nodes or is empty. Each node is merged in as a run of one, carries
+    propagate like in a binary counter. Older runs are always passed first to
+    the merge, which makes the sort stable.
+*/
+void slist_sort(slist_t *list, slist_compare_t compare)
+{
+    slist_node_t *bins[sizeof(size_t) * 8];
+    slist_node_t *chain;
+    slist_node_t *run;
+    size_t used = 0;
+    size_t idx;
+
+    if (slist_empty(list))
+    {
+        return;
+    }
+
+    /* open the circle into a NULL terminated chain */
+    slist_prev(list, list)->next = NULL;
+    chain = list->next;
+
+    while (chain)
+    {
+        run = chain;
+        chain = chain->next;
+        run->next = NULL;
+
+        for (idx = 0; idx < used && bins[idx]; idx++)
+        {
+            run = slist_merge_chains(bins[idx], run, compare);
+            bins[idx] = NULL;
+        }
+
+        if (idx == used)
+        {
+            used++;
+        }
+
+        bins[idx] = run;
+    }
+
+    run = NULL;
+
+    for (idx = 0; idx < used; idx++)
+    {
+        if (bins[idx])
+        {
+            run = slist_merge_chains(bins[idx], run, compare);
+        }
+    }
+
+    /* close the circle again */
+    list->next = run;
+
+    while (run->next)
+    {
+        run = run->next;
+    }
+
+    run->next = list;
+}
+
+void slist_insert_sorted(slist_t *list, slist_node_t *node, slist_compare_t compare)
+{
+    slist_node_t *prev = list;
+
+    while (prev->next != list && compare(prev->next, node) <= 0)
+    {
+        prev = prev->next;
+    }
+
+    slist_insert_after(list, prev, node);
+}
+
+void slist_merge(slist_t *list, slist_t *other, slist_compare_t compare)
+{
+    slist_node_t *prev = list;
 
+    while (!slist_empty(other))
+    {
+        slist_node_t *node = slist_front(other);
 
+        while (prev->next != list && compare(prev->next, node) <= 0)
+        {
+            prev = prev->next;
+        }
 
+        if (prev->next == list)
+        {
+            /* everything left in other orders after the list, append it as a whole */
+            prev->next = other->next;
+            slist_prev(other, other)->next = list;
+            slist_init(other);
+            break;
+        }
 
+        slist_pop_front(other);
+        slist_insert_after(list, prev, node);
+        prev = node;
+    }
+}
+
+void slist_splice_after(slist_t *list, slist_node_t *pos, slist_node_t *prev, slist_node_t *last)
+{
+    slist_node_t *first = prev->next;
+
+    (void)list;
+
+    prev->next = last->next;
+    last->next = pos->next;
+    pos->next = first;
+}
+
+void slist_splice(slist_t *list, slist_node_t *pos, slist_t *other)
+{
+    if (!slist_empty(other))
+    {
+        slist_splice_after(list, pos, other, slist_prev(other, other));
+    }
+}
+
+void slist_cut_after(slist_t *list, slist_node_t *pos, slist_t *other)
+{
+    slist_node_t *last = pos;
+
+    if (pos->next == list)
+    {
+        slist_init(other);
+        return;
+    }
+
+    while (last->next != list)
+    {
+        last = last->next;
+    }
+
+    other->next = pos->next;
+    last->next = other;
+    pos->next = list;
+}
@@ -97,6 +97,25 @@ typedef slist_node_t slist_t;
 #define slist_foreach(list,iterator) \
     for(iterator = slist_begin(list); (iterator) != slist_end(list); iterator=slist_next(list,iterator))
 
+/*!
+   \brief     Iterates through a singly linked list keeping track of the predecessor.
+   \details   Like `slist_foreach`, but additionally maintains `prev`, the node
+              before `iterator` (the list control node for the first node).
+              The loop body may remove the current node with
+              `slist_erase_after(list,prev)`; the loop then continues with the
+              node that followed it and `prev` stays in place. This makes
+              filtering a list in a single pass O(n) in total, whereas
+              `slist_erase` walks the circle for every removed node.
+
+   \param list      A pointer to the list's control node
+   \param prev      A pointer to a `slist_node_t` that tracks the predecessor.
+   \param iterator  A pointer to a `slist_node_t` that will be used as the iterator.
+*/
+#define slist_foreach_prev(list,prev,iterator) \
+    for(prev = slist_end(list), iterator = slist_begin(list); \
+        (iterator) != slist_end(list); \
+        prev = (slist_next(list,prev) == (iterator)) ? (iterator) : (prev), iterator = slist_next(list,prev))
+
 /*!
   \brief    Retrieves the next node in a singly linked list.
 
@@ -254,17 +273,16 @@ slist_node_t* slist_prev(slist_t *list, slist_node_t* node);
  \brief Returns a pointer to the node before the predecessor of the given node.
 
  \details Returns a pointer to the node that precedes the predecessor of the given node.
-     This function efficiently finds the node two positions before the given node by calling `slist_prev` twice.
-
-     Optimize! Current O = 2*n
+     Walks the circle once, keeping the two nodes behind the iterator. O(n).
+     Lists that need O(1) access to their last node should use the tail
+     anchored variant in tslist.h.
 
  \param list A pointer to the list control node.
  \param node A pointer to the node for which to find the node two positions before.
 
  \return A pointer to the node two positions before the given node.
 */
-#define slist_prev_prev(list,node) \
-    slist_prev(((slist_t*)(list)),slist_prev(((slist_t*)(list)),((slist_node_t*)(node))))
+slist_node_t* slist_prev_prev(slist_t *list, slist_node_t* node);
 
 /*!
  \brief Removes the last node from the list.
@@ -282,8 +300,8 @@ slist_node_t* slist_prev(slist_t *list, slist_node_t* node);
 /*!
  \brief Removes a node from the list.
 
- \details Removes the given node from the list.
-
+ \details Removes the given node from the list. Has to find the predecessor
+       and thus is O(n), prefer `slist_erase_after` when it is known.
 
  \param list A pointer to the list control node.
  \param node A pointer to the node to be removed from the list.
@@ -295,6 +313,75 @@ slist_node_t* slist_prev(slist_t *list, slist_node_t* node);
 
 
 
+/*!
+ \brief Marks a node as not being on any list.
+
+ \details Nodes follow an optional state convention: a node that is not on a
+       list has a NULL link. Zero initialised static nodes are thus unlinked
+       without calling this macro. As long as nodes are only removed with
+       the `_safe` macros, `slist_node_is_linked` tells in O(1) whether a node
+       is on a list instead of an `slist_find` scan.
+       The plain erase and pop macros leave the stale link in the node.
+
+ \param node A pointer to the node.
+*/
+#define slist_node_init(node) \
+    do{ \
+        ((slist_node_t*)(node))->next = NULL; \
+    }while(0)
+
+/*!
+ \brief Checks if a node is on a list.
+
+ \details O(1), see `slist_node_init` for the convention this relies on.
+
+ \param node A pointer to the node.
+
+ \return True if the node is on a list, false otherwise.
+*/
+#define slist_node_is_linked(node) \
+    (((slist_node_t*)(node))->next != NULL)
+
+/*!
+ \brief Removes a node from the list and marks it as unlinked.
+
+ \details Like `slist_erase` O(n), but resets the link of the node
+       afterwards, see `slist_node_init`. The node is evaluated once.
+
+ \param list A pointer to the list control node.
+ \param node A pointer to the node to be removed from the list.
+*/
+#define slist_erase_safe(list,node) \
+    do{ \
+        slist_node_t *slist_erased_ = ((slist_node_t*)(node)); \
+        slist_erase(list,slist_erased_); \
+        slist_node_init(slist_erased_); \
+    }while(0)
+
+/*!
+ \brief Removes the node following a given position and marks it as unlinked.
+
+ \details Like `slist_erase_after` O(1), but resets the link of the removed
+       node, see `slist_node_init`.
+
+ \param list A pointer to the list control node.
+ \param pos A pointer to the node whose successor should be removed.
+*/
+#define slist_erase_after_safe(list,pos) \
+    do{ \
+        slist_node_t *slist_erased_ = ((slist_node_t*)(pos))->next; \
+        ((slist_node_t*)(pos))->next = slist_erased_->next; \
+        slist_node_init(slist_erased_); \
+    }while(0)
+
+/*!
+ \brief Removes the first node from the list and marks it as unlinked.
+
+ \param list A pointer to the list control node, the list must not be empty.
+*/
+#define slist_pop_front_safe(list) \
+    slist_erase_after_safe(list,list)
+
 /*!
  \brief Inserts a new node after a given position in the list.
 
@@ -310,6 +397,21 @@ slist_node_t* slist_prev(slist_t *list, slist_node_t* node);
         ((slist_node_t*)(pos))->next = ((slist_node_t*)(node)); \
     }while(0)
 
+/*!
+ \brief Removes the node following a given position from the list.
+
+ \details Unlinks the successor of `pos` in O(1). `pos` may be the list control
+       node to remove the first node, its successor must be a data node.
+       See `slist_foreach_prev` for removing nodes while iterating.
+
+ \param list A pointer to the list control node.
+ \param pos A pointer to the node whose successor should be removed.
+*/
+#define slist_erase_after(list,pos) \
+    do{ \
+        ((slist_node_t*)(pos))->next = ((slist_node_t*)(pos))->next->next; \
+    }while(0)
+
 /*!
  \brief Inserts a new node before a given position in the list.
 
@@ -349,6 +451,102 @@ size_t slist_size(slist_t *list);
 */
 slist_node_t* slist_find(slist_t* list, slist_node_t* node);
 
+/*!
+ \brief Compares two nodes for ordering.
+
+ \details User supplied ordering for `slist_sort`, `slist_insert_sorted` and
+       `slist_merge`, typically comparing members of the containing structures
+       obtained with `container_of`.
+
+ \param a The first node.
+ \param b The second node.
+
+ \return Less than zero if a orders before b, zero if they are equal, greater
+       than zero if a orders after b.
+*/
+typedef int (*slist_compare_t)(const slist_node_t *a, const slist_node_t *b);
+
+/*!
+ \brief Sorts the list in place.
+
+ \details Stable bottom up merge sort, O(n log n) comparisons and no memory
+       allocation. Nodes that compare equal keep their relative order.
+
+ \param list A pointer to the list control node.
+ \param compare The ordering of the nodes.
+*/
+void slist_sort(slist_t *list, slist_compare_t compare);
+
+/*!
+ \brief Inserts a node into a sorted list keeping it sorted.
+
+ \details The node is inserted after all nodes that compare equal to it, so
+       nodes with equal keys stay in insertion order. O(n).
+
+ \param list A pointer to the list control node of a sorted list.
+ \param node A pointer to the new node to be inserted.
+ \param compare The ordering the list is sorted by.
+*/
+void slist_insert_sorted(slist_t *list, slist_node_t *node, slist_compare_t compare);
+
+/*!
+ \brief Merges a sorted list into another sorted list.
+
+ \details Moves all nodes of `other` into `list` keeping it sorted, `other`
+       is empty afterwards. On equal keys the nodes of `list` come first.
+       O(n + m) comparisons, the nodes are relinked, not copied.
+
+ \param list A pointer to the list control node of the sorted target list.
+ \param other A pointer to the list control node of the sorted list to merge.
+ \param compare The ordering both lists are sorted by.
+*/
+void slist_merge(slist_t *list, slist_t *other, slist_compare_t compare);
+
+/*!
+ \brief Moves a range of nodes after a given position.
+
+ \details Unlinks the nodes following `prev` up to `last` inclusive from the
+       list they are in and inserts them after `pos`, O(1). A singly linked
+       node cannot be unlinked without its predecessor, hence the range is
+       given by the node before its first node. The source list may be `list`
+       itself, `pos` must not be within the range.
+
+ \param list A pointer to the list control node of the target list.
+ \param pos A pointer to the node after which the nodes are inserted.
+ \param prev A pointer to the node before the first node of the range, the
+       list control node of the source list for a range at its front.
+ \param last A pointer to the last node of the range, reachable from `prev`.
+*/
+void slist_splice_after(slist_t *list, slist_node_t *pos, slist_node_t *prev, slist_node_t *last);
+
+/*!
+ \brief Moves all nodes of another list into the list after a given position.
+
+ \details `other` is empty afterwards. The last node of `other` has to be
+       found, which is O(m) for m nodes in `other`; the tail anchored list
+       (tslist.h) provides the same in O(1).
+
+ \param list A pointer to the list control node of the target list.
+ \param pos A pointer to the node after which the nodes are inserted, the
+       list control node inserts at the front.
+ \param other A pointer to the list control node of the list to move.
+*/
+void slist_splice(slist_t *list, slist_node_t *pos, slist_t *other);
+
+/*!
+ \brief Splits a list after a node.
+
+ \details Moves all nodes after `pos` into `other`, `list` ends with `pos`.
+       The last node has to be relinked to `other`, which costs a walk from
+       `pos` to the end of the list; O(1) in the tail anchored list. Previous
+       contents of `other` are discarded, it does not need to be initialized.
+
+ \param list A pointer to the list control node of the list to split.
+ \param pos A pointer to the last node to keep, the list control node moves all nodes.
+ \param other A pointer to the list control node receiving the nodes.
+*/
+void slist_cut_after(slist_t *list, slist_node_t *pos, slist_t *other);
+
 #endif /* SLIST_H_ */
 
 
@@ -0,0 +1,435 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       swissmap.c
+
+    \brief      Open addressing hash map with SIMD probed control bytes (hosted builds)
+
+    \details    see header file
+*/
+#include "swissmap.h"
+
+#if defined(SWISSMAP_ENABLE)
+
+#include <stdlib.h>
+#include <string.h>
+#include "hash.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SWISSMAP_SSE2
+#endif
+
+#define SWISSMAP_EMPTY      0x80
+#define SWISSMAP_SATURATED  0xFF
+#define SWISSMAP_NONE       ((size_t)-1)
+#define SWISSMAP_ALIGN      16
+
+/* the low bits of the hash select the group, the top 7 bits are the tag */
+#define swissmap_tag(hash) \
+    ((uint8_t)((hash) >> 25))
+
+/* groups hold at most 14 of 16 entries on average, load factor 7/8 */
+#define swissmap_capacity(groups) \
+    ((groups) * (SWISSMAP_GROUP_SIZE - SWISSMAP_GROUP_SIZE / 8))
+
+#define swissmap_entry(map,slot) \
+    ((map)->slots + (slot) * (map)->entry_size)
+
+/* bit n set if control byte n of the group equals tag */
+static unsigned swissmap_match(const uint8_t *ctrl, uint8_t tag)
+{
+#if defined(SWISSMAP_SSE2)
+    __m128i group = _mm_loadu_si128((const __m128i*)ctrl);
+    return (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)tag)));
+#else
+    unsigned mask = 0;
+    unsigned idx;
+
+    for (idx = 0; idx < SWISSMAP_GROUP_SIZE; idx++)
+    {
+        if (ctrl[idx] == tag)
+        {
+            mask |= 1U << idx;
+        }
+    }
+
+    return mask;
+#endif
+}
+
+/* bit n set if slot n of the group is empty, tags never have the top bit set */
+static unsigned swissmap_match_empty(const uint8_t *ctrl)
+{
+#if defined(SWISSMAP_SSE2)
+    return (unsigned)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)ctrl));
+#else
+    unsigned mask = 0;
+    unsigned idx;
+
+    for (idx = 0; idx < SWISSMAP_GROUP_SIZE; idx++)
+    {
+        if (ctrl[idx] & SWISSMAP_EMPTY)
+        {
+            mask |= 1U << idx;
+        }
+    }
+
+    return mask;
+#endif
+}
+
+/* index of the lowest set bit, mask must not be 0 */
+static unsigned swissmap_lowest(unsigned mask)
+{
+#if defined(__GNUC__)
+    return (unsigned)__builtin_ctz(mask);
+#else
+    unsigned idx = 0;
+
+    while (!(mask & 1))
+    {
+        mask >>= 1;
+        idx++;
+    }
+
+    return idx;
+#endif
+}
+
+static uint32_t swissmap_hash_key(swissmap_t *map, const void *key)
+{
+    if (map->hash)
+    {
+        return map->hash(key);
+    }
+
+    return hash_xxh32(0, (void*)key, map->key_size);
+}
+
+static bool swissmap_key_equal(swissmap_t *map, const uint8_t *entry, const void *key)
+{
+    if (map->equal)
+    {
+        return map->equal(entry + map->key_offset, key);
+    }
+
+    /* constant sizes let the compiler inline the comparison of common keys */
+    switch (map->key_size)
+    {
+        case 4:  return memcmp(entry + map->key_offset, key, 4) == 0;
+        case 8:  return memcmp(entry + map->key_offset, key, 8) == 0;
+        default: return memcmp(entry + map->key_offset, key, map->key_size) == 0;
+    }
+}
+
+/*
+    Triangular probing, the groups visited are home, home+1, home+3, home+6, ...
+    which covers every group once as the number of groups is a power of two.
+*/
+static size_t swissmap_lookup(swissmap_t *map, const void *key, uint32_t hash)
+{
+    size_t mask = map->groups - 1;
+    size_t group = hash & mask;
+    uint8_t tag = swissmap_tag(hash);
+    size_t step;
+
+    for (step = 1; step <= map->groups; step++)
+    {
+        unsigned match = swissmap_match(map->ctrl + group * SWISSMAP_GROUP_SIZE, tag);
+
+        while (match)
+        {
+            size_t slot = group * SWISSMAP_GROUP_SIZE + swissmap_lowest(match);
+
+            if (swissmap_key_equal(map, swissmap_entry(map, slot), key))
+            {
+                return slot;
+            }
+
+            match &= match - 1;
+        }
+
+        /* no entry ever probed past this group */
+        if (!map->overflow[group])
+        {
+            break;
+        }
+
+        group = (group + step) & mask;
+    }
+
+    return SWISSMAP_NONE;
+}
+
+/* claims a slot for a new entry, the load limit guarantees an empty slot */
+static size_t swissmap_place(swissmap_t *map, uint32_t hash)
+{
+    size_t mask = map->groups - 1;
+    size_t group = hash & mask;
+    size_t step = 1;
+    size_t slot;
+    unsigned empty;
+
+    while (!(empty = swissmap_match_empty(map->ctrl + group * SWISSMAP_GROUP_SIZE)))
+    {
+        if (map->overflow[group] != SWISSMAP_SATURATED)
+        {
+            map->overflow[group]++;
+        }
+
+        group = (group + step++) & mask;
+    }
+
+    slot = group * SWISSMAP_GROUP_SIZE + swissmap_lowest(empty);
+    map->ctrl[slot] = swissmap_tag(hash);
+
+    return slot;
+}
+
+/* moves all entries into new storage of the given number of groups */
+static bool swissmap_resize(swissmap_t *map, size_t groups)
+{
+    swissmap_t old = *map;
+    size_t slots_offset = (groups * (SWISSMAP_GROUP_SIZE + 1) + SWISSMAP_ALIGN - 1) & ~(size_t)(SWISSMAP_ALIGN - 1);
+    size_t slot;
+    uint8_t *memory;
+
+    if (groups > ((size_t)-1 - slots_offset) / SWISSMAP_GROUP_SIZE / map->entry_size)
+    {
+        return false;
+    }
+
+    memory = malloc(slots_offset + groups * SWISSMAP_GROUP_SIZE * map->entry_size);
+
+    if (!memory)
+    {
+        return false;
+    }
+
+    map->ctrl = memory;
+    map->overflow = memory + groups * SWISSMAP_GROUP_SIZE;
+    map->slots = memory + slots_offset;
+    map->groups = groups;
+    memset(map->ctrl, SWISSMAP_EMPTY, groups * SWISSMAP_GROUP_SIZE);
+    memset(map->overflow, 0, groups);
+
+    for (slot = 0; slot < old.groups * SWISSMAP_GROUP_SIZE; slot++)
+    {
+        if (!(old.ctrl[slot] & SWISSMAP_EMPTY))
+        {
+            const uint8_t *entry = swissmap_entry(&old, slot);
+            size_t target = swissmap_place(map, swissmap_hash_key(map, entry + map->key_offset));
+
+            memcpy(swissmap_entry(map, target), entry, map->entry_size);
+        }
+    }
+
+    free(old.ctrl);
+
+    return true;
+}
+
+void swissmap_init(swissmap_t *map, size_t entry_size, size_t key_offset, size_t key_size,
+                   swissmap_hash_t hash, swissmap_equal_t equal)
+{
+    map->ctrl = NULL;
+    map->overflow = NULL;
+    map->slots = NULL;
+    map->groups = 0;
+    map->count = 0;
+    map->entry_size = entry_size;
+    map->key_offset = key_offset;
+    map->key_size = key_size;
+    map->hash = hash;
+    map->equal = equal;
+}
+
+void swissmap_free(swissmap_t *map)
+{
+    free(map->ctrl);
+    swissmap_init(map, map->entry_size, map->key_offset, map->key_size, map->hash, map->equal);
+}
+
+void swissmap_clear(swissmap_t *map)
+{
+    if (map->groups)
+    {
+        memset(map->ctrl, SWISSMAP_EMPTY, map->groups * SWISSMAP_GROUP_SIZE);
+        memset(map->overflow, 0, map->groups);
+    }
+
+    map->count = 0;
+}
+
+bool swissmap_reserve(swissmap_t *map, size_t count)
+{
+    size_t groups = map->groups ? map->groups : 1;
+
+    while (swissmap_capacity(groups) < count)
+    {
+        groups *= 2;
+    }
+
+    if (groups == map->groups)
+    {
+        return true;
+    }
+
+    return swissmap_resize(map, groups);
+}
+
+void* swissmap_insert(swissmap_t *map, const void *key, bool *inserted)
+{
+    uint32_t hash = swissmap_hash_key(map, key);
+    size_t slot = map->count ? swissmap_lookup(map, key, hash) : SWISSMAP_NONE;
+    uint8_t *entry;
+
+    if (inserted)
+    {
+        *inserted = false;
+    }
+
+    if (slot != SWISSMAP_NONE)
+    {
+        return swissmap_entry(map, slot);
+    }
+
+    if (!swissmap_reserve(map, map->count + 1))
+    {
+        return NULL;
+    }
+
+    slot = swissmap_place(map, hash);
+    entry = swissmap_entry(map, slot);
+    memcpy(entry + map->key_offset, key, map->key_size);
+    map->count++;
+
+    if (inserted)
+    {
+        *inserted = true;
+    }
+
+    return entry;
+}
+
+void* swissmap_find(swissmap_t *map, const void *key)
+{
+    size_t slot;
+
+    if (!map->count)
+    {
+        return NULL;
+    }
+
+    slot = swissmap_lookup(map, key, swissmap_hash_key(map, key));
+
+    return slot != SWISSMAP_NONE ? swissmap_entry(map, slot) : NULL;
+}
+
+/* frees a slot, hash is the hash of the key of its entry */
+static void swissmap_release(swissmap_t *map, size_t slot, uint32_t hash)
+{
+    size_t target = slot / SWISSMAP_GROUP_SIZE;
+    size_t mask = map->groups - 1;
+    size_t group = hash & mask;
+    size_t step = 1;
+
+    /* undo the overflow counts the insertion left on its probe path */
+    while (group != target)
+    {
+        if (map->overflow[group] != SWISSMAP_SATURATED)
+        {
+            map->overflow[group]--;
+        }
+
+        group = (group + step++) & mask;
+    }
+
+    map->ctrl[slot] = SWISSMAP_EMPTY;
+    map->count--;
+}
+
+void swissmap_erase(swissmap_t *map, void *entry)
+{
+    size_t slot = (size_t)((uint8_t*)entry - map->slots) / map->entry_size;
+
+    swissmap_release(map, slot, swissmap_hash_key(map, (uint8_t*)entry + map->key_offset));
+}
+
+bool swissmap_remove(swissmap_t *map, const void *key)
+{
+    uint32_t hash;
+    size_t slot;
+
+    if (!map->count)
+    {
+        return false;
+    }
+
+    hash = swissmap_hash_key(map, key);
+    slot = swissmap_lookup(map, key, hash);
+
+    if (slot == SWISSMAP_NONE)
+    {
+        return false;
+    }
+
+    swissmap_release(map, slot, hash);
+
+    return true;
+}
+
+/* first entry at or after slot, NULL if there is none */
+static void* swissmap_scan(swissmap_t *map, size_t slot)
+{
+    size_t end = map->groups * SWISSMAP_GROUP_SIZE;
+
+    for (; slot < end; slot++)
+    {
+        if (!(map->ctrl[slot] & SWISSMAP_EMPTY))
+        {
+            return swissmap_entry(map, slot);
+        }
+    }
+
+    return NULL;
+}
+
+void* swissmap_first(swissmap_t *map)
+{
+    return swissmap_scan(map, 0);
+}
+
+void* swissmap_next(swissmap_t *map, void *entry)
+{
+    return swissmap_scan(map, (size_t)((uint8_t*)entry - map->slots) / map->entry_size + 1);
+}
+
+#endif /* SWISSMAP_ENABLE */
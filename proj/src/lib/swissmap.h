@@ -0,0 +1,256 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       swissmap.h
+
+    \brief      Open addressing hash map with SIMD probed control bytes (hosted builds)
+
+    \details    Entries are stored inline in one flat array, which keeps lookups
+                within a few cache lines even for millions of entries, where the
+                chained map of hashmap.h jumps from node to node.
+
+                The slots are organized in groups of 16. Every slot has a control
+                byte, either empty or the top 7 bits of the hash of its key. A
+                lookup compares the control bytes of a whole group against the
+                7 bit tag at once (SSE2 where available, a portable loop
+                elsewhere) and only compares keys of matching slots, so almost
+                all slots are rejected without touching the entries.
+
+                Deletion does not leave tombstones. Instead every group counts
+                how many entries probed past it because it was full at insertion
+                time. A lookup stops at the first group with a zero count, erase
+                decrements the counts along the probe path of the erased entry
+                and marks its slot empty. Saturated counts stay saturated, which
+                only costs longer probes.
+
+                The storage is allocated with malloc and doubles when the load
+                exceeds 7/8. Growth moves the entries: pointers to entries are
+                only valid until the next insertion.
+
+                Only available on hosted builds, `SWISSMAP_ENABLE` is defined by
+                the build system there.
+
+                \code
+                typedef struct {
+                    uint64_t session;
+                    uint32_t address;
+                } entry_t;
+
+                swissmap_t map;
+                bool inserted;
+
+                swissmap_init(&map, sizeof(entry_t), offsetof(entry_t, session), sizeof(uint64_t), NULL, NULL);
+                entry = swissmap_insert(&map, &session, &inserted);
+                entry->address = address;
+                entry = swissmap_find(&map, &session);
+                swissmap_free(&map);
+                \endcode
+*/
+
+#ifndef SWISSMAP_H_
+#define SWISSMAP_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#if defined(SWISSMAP_ENABLE) || defined(DOXYGEN)
+
+/*!
+    \brief      Number of slots probed at once.
+*/
+#define SWISSMAP_GROUP_SIZE 16
+
+/*!
+    \brief      Computes the hash of a key.
+
+    \param key  Pointer to the key.
+
+    \return     The hash of the key, all 32 bits are used.
+*/
+typedef uint32_t (*swissmap_hash_t)(const void *key);
+
+/*!
+    \brief      Compares two keys.
+
+    \param a    Pointer to the key stored within an entry.
+    \param b    Pointer to the key passed to the hash map functions.
+
+    \return     True if the keys are equal.
+*/
+typedef bool (*swissmap_equal_t)(const void *a, const void *b);
+
+/*!
+    \brief      Hash map control structure.
+*/
+typedef struct {
+    uint8_t *ctrl;              //!< Control byte per slot, group after group
+    uint8_t *overflow;          //!< Per group count of entries probing past it
+    uint8_t *slots;             //!< Entry storage
+    size_t groups;              //!< Number of groups, a power of two or 0
+    size_t count;               //!< Number of entries
+    size_t entry_size;          //!< Size of an entry in bytes
+    size_t key_offset;          //!< Offset of the key within an entry
+    size_t key_size;            //!< Size of the key in bytes
+    swissmap_hash_t hash;       //!< Hashes a key
+    swissmap_equal_t equal;     //!< Compares two keys
+} swissmap_t;
+
+/*!
+    \brief      Returns the number of entries in the hash map.
+
+    \param map  Pointer to the hash map control structure.
+*/
+#define swissmap_size(map) \
+    (((swissmap_t*)(map))->count)
+
+/*!
+    \brief      Checks if the hash map is empty.
+
+    \param map  Pointer to the hash map control structure.
+*/
+#define swissmap_empty(map) \
+    (((swissmap_t*)(map))->count == 0)
+
+/*!
+    \brief      Iterates over all entries of a hash map in storage order.
+
+    \details    The map must not be modified during the iteration, except for
+                erasing the current entry.
+
+    \param map      Pointer to the hash map control structure.
+    \param iterator A pointer to the entry type used as iterator.
+*/
+#define swissmap_foreach(map,iterator) \
+    for(iterator = swissmap_first(map); (iterator) != NULL; iterator = swissmap_next(map,iterator))
+
+/*!
+    \brief      Initializes an empty hash map, no memory is allocated yet.
+
+    \param map          Pointer to the hash map control structure.
+    \param entry_size   Size of an entry in bytes.
+    \param key_offset   Offset of the key within an entry.
+    \param key_size     Size of the key in bytes, the key is copied into new
+                        entries by `swissmap_insert`.
+    \param hash         The hash callback, NULL hashes the key bytes with
+                        `hash_xxh32`.
+    \param equal        The equality callback, NULL compares the key bytes.
+*/
+void swissmap_init(swissmap_t *map, size_t entry_size, size_t key_offset, size_t key_size,
+                   swissmap_hash_t hash, swissmap_equal_t equal);
+
+/*!
+    \brief      Releases the storage of a hash map, the map is empty afterwards.
+
+    \param map  Pointer to the hash map control structure.
+*/
+void swissmap_free(swissmap_t *map);
+
+/*!
+    \brief      Removes all entries, the storage is kept.
+
+    \param map  Pointer to the hash map control structure.
+*/
+void swissmap_clear(swissmap_t *map);
+
+/*!
+    \brief      Makes room for a number of entries without further growth.
+
+    \param map      Pointer to the hash map control structure.
+    \param count    Number of entries the map shall hold.
+
+    \return     False if the storage could not be allocated.
+*/
+bool swissmap_reserve(swissmap_t *map, size_t count);
+
+/*!
+    \brief      Looks up a key and inserts a new entry if it is not present.
+
+    \details    A new entry holds a copy of the key, all other bytes are
+                undefined and are to be filled in by the caller.
+
+    \param map      Pointer to the hash map control structure.
+    \param key      Pointer to the key.
+    \param inserted Set to true if a new entry has been inserted, may be NULL.
+
+    \return     The entry holding the key, or NULL if the storage could not
+                be grown.
+*/
+void* swissmap_insert(swissmap_t *map, const void *key, bool *inserted);
+
+/*!
+    \brief      Looks up the entry holding a key.
+
+    \param map  Pointer to the hash map control structure.
+    \param key  Pointer to the key.
+
+    \return     The entry holding the key, or NULL if there is none.
+*/
+void* swissmap_find(swissmap_t *map, const void *key);
+
+/*!
+    \brief      Removes an entry from the hash map.
+
+    \param map      Pointer to the hash map control structure.
+    \param entry    An entry returned by the hash map.
+*/
+void swissmap_erase(swissmap_t *map, void *entry);
+
+/*!
+    \brief      Removes the entry holding a key.
+
+    \param map  Pointer to the hash map control structure.
+    \param key  Pointer to the key.
+
+    \return     True if an entry has been removed.
+*/
+bool swissmap_remove(swissmap_t *map, const void *key);
+
+/*!
+    \brief      Returns the first entry in storage order.
+
+    \param map  Pointer to the hash map control structure.
+
+    \return     The first entry, or NULL if the hash map is empty.
+*/
+void* swissmap_first(swissmap_t *map);
+
+/*!
+    \brief      Returns the entry following an entry in storage order.
+
+    \param map      Pointer to the hash map control structure.
+    \param entry    An entry returned by the hash map.
+
+    \return     The next entry, or NULL if `entry` is the last one.
+*/
+void* swissmap_next(swissmap_t *map, void *entry);
+
+#endif /* SWISSMAP_ENABLE */
+
+#endif /* SWISSMAP_H_ */
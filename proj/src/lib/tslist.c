@@ -0,0 +1,79 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       tslist.c
+
+    \brief      Tail anchored circular singly linked list
+
+    \details    see header file
+*/
+#include "tslist.h"
+
+void tslist_erase(tslist_t *list, slist_node_t *node)
+{
+    slist_node_t *prev = tslist_prev(list, node);
+
+    prev->next = node->next;
+
+    if (node == list->tail)
+    {
+        list->tail = prev;
+    }
+}
+
+void tslist_splice(tslist_t *list, slist_node_t *pos, tslist_t *other)
+{
+    if (tslist_empty(other))
+    {
+        return;
+    }
+
+    if (pos == list->tail)
+    {
+        list->tail = other->tail;
+    }
+
+    slist_splice_after(tslist_list(list), pos, tslist_list(other), other->tail);
+    other->tail = tslist_list(other);
+}
+
+void tslist_cut_after(tslist_t *list, slist_node_t *pos, tslist_t *other)
+{
+    if (pos == list->tail)
+    {
+        tslist_init(other);
+        return;
+    }
+
+    other->head.next = pos->next;
+    other->tail = list->tail;
+    other->tail->next = tslist_list(other);
+    pos->next = tslist_list(list);
+    list->tail = pos;
+}
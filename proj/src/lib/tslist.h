@@ -0,0 +1,381 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*!
+    \file       tslist.h
+
+    \brief      Tail anchored circular singly linked list header file
+
+    \details    A variant of the circular singly linked list (see slist.h) whose
+                control structure additionally tracks the last node. Nodes keep
+                the single pointer layout of `slist_node_t`, but `tslist_push_back`
+                and `tslist_back` no longer walk the circle, which makes the list
+                an O(1) FIFO queue at the cost of one extra pointer per list.
+
+                The nodes are linked through the `slist_t` control node exactly
+                as in an slist, so all read only slist operations (`slist_foreach`,
+                `slist_next`, `slist_find`, `slist_size`, ...) work on the list
+                returned by `tslist_list`. Operations that add or remove nodes
+                must use the tslist macros to keep the tail up to date.
+
+                Removing the last node still needs its predecessor, so
+                `tslist_pop_back` and `tslist_erase` remain O(n), whereas
+                `tslist_erase_after` is O(1).
+*/
+
+#ifndef TSLIST_H_
+#define TSLIST_H_
+
+#include "slist.h"
+
+/*!
+    \brief      Tail anchored singly linked list control structure.
+*/
+typedef struct {
+    slist_t head;           //!< Control node of the circular list
+    slist_node_t *tail;     //!< Last node, the control node if the list is empty
+} tslist_t;
+
+/*!
+    \brief      Returns the circular singly linked list of a tail anchored list.
+
+    \details    For use with the read only slist operations.
+
+    \param list A pointer to the tail anchored list.
+
+    \return A pointer to the `slist_t` control node.
+*/
+#define tslist_list(list) \
+    (&((tslist_t*)(list))->head)
+
+/*!
+    \brief      Iterates through a tail anchored list, see `slist_foreach`.
+
+    \param list      A pointer to the tail anchored list.
+    \param iterator  A pointer to a `slist_node_t` that will be used as the iterator.
+*/
+#define tslist_foreach(list,iterator) \
+    slist_foreach(tslist_list(list),iterator)
+
+/*!
+    \brief      Iterates through a tail anchored list keeping track of the
+                predecessor, see `slist_foreach_prev`.
+
+    \details    The loop body may remove the current node with
+                `tslist_erase_after(list,prev)`.
+
+    \param list      A pointer to the tail anchored list.
+    \param prev      A pointer to a `slist_node_t` that tracks the predecessor.
+    \param iterator  A pointer to a `slist_node_t` that will be used as the iterator.
+*/
+#define tslist_foreach_prev(list,prev,iterator) \
+    slist_foreach_prev(tslist_list(list),prev,iterator)
+
+/*!
+    \brief      Retrieves the next node, see `slist_next`.
+
+    \param list A pointer to the tail anchored list.
+    \param node A pointer to the current node.
+
+    \return A pointer to the next node in the list.
+*/
+#define tslist_next(list,node) \
+    slist_next(tslist_list(list),node)
+
+/*!
+    \brief      Retrieves the node preceding the given node, see `slist_prev`. O(n).
+
+    \param list A pointer to the tail anchored list.
+    \param node A pointer to the node whose predecessor is to be found.
+
+    \return A pointer to the preceding node, or the list control node.
+*/
+#define tslist_prev(list,node) \
+    slist_prev(tslist_list(list),((slist_node_t*)(node)))
+
+/*!
+    \brief      Returns the node two positions before the given node, see `slist_prev_prev`.
+
+    \param list A pointer to the tail anchored list.
+    \param node A pointer to the node for which to find the node two positions before.
+
+    \return A pointer to the node two positions before the given node.
+*/
+#define tslist_prev_prev(list,node) \
+    slist_prev_prev(tslist_list(list),((slist_node_t*)(node)))
+
+/*!
+    \brief      Initializes a tail anchored list to be empty.
+
+    \param list A pointer to the tail anchored list.
+*/
+#define tslist_init(list) \
+    do{ \
+        slist_init(tslist_list(list)); \
+        ((tslist_t*)(list))->tail = tslist_list(list); \
+    }while(0)
+
+/*!
+    \brief      Returns a pointer to the first data node, or the list control node if empty.
+
+    \param list A pointer to the tail anchored list.
+*/
+#define tslist_begin(list) \
+    slist_begin(tslist_list(list))
+
+/*!
+    \brief      Returns a pointer to the first data node, alias for `tslist_begin`.
+
+    \param list A pointer to the tail anchored list.
+*/
+#define tslist_front(list) \
+    slist_front(tslist_list(list))
+
+/*!
+    \brief      Returns a pointer to the past-the-end element, the list control node.
+
+    \param list A pointer to the tail anchored list.
+*/
+#define tslist_end(list) \
+    slist_end(tslist_list(list))
+
+/*!
+    \brief      Returns a pointer to the last data node in O(1).
+
+    \param list A pointer to the tail anchored list.
+
+    \return A pointer to the last data node, or the list control node if the list is empty.
+*/
+#define tslist_back(list) \
+    (((tslist_t*)(list))->tail)
+
+/*!
+    \brief      Checks if the list is empty.
+
+    \param list A pointer to the tail anchored list.
+
+    \return True if the list is empty, false otherwise.
+*/
+#define tslist_empty(list) \
+    slist_empty(tslist_list(list))
+
+/*!
+    \brief      Makes a newly linked node the tail if it has become the last node.
+
+    \details    Used by the inserting macros after linking, so that `pos` may
+                be given as `tslist_back(list)`.
+
+    \param list A pointer to the tail anchored list.
+    \param node A pointer to the node just inserted.
+*/
+#define tslist_update_tail(list,node) \
+    do{ \
+        if (((slist_node_t*)(node))->next == tslist_end(list)) \
+        { \
+            ((tslist_t*)(list))->tail = ((slist_node_t*)(node)); \
+        } \
+    }while(0)
+
+/*!
+    \brief      Inserts a new node at the beginning of the list.
+
+    \param list A pointer to the tail anchored list.
+    \param node A pointer to the new node to be inserted.
+*/
+#define tslist_push_front(list,node) \
+    do{ \
+        slist_push_front(tslist_list(list),node); \
+        tslist_update_tail(list,node); \
+    }while(0)
+
+/*!
+    \brief      Removes the first node from a non empty list.
+
+    \param list A pointer to the tail anchored list.
+*/
+#define tslist_pop_front(list) \
+    do{ \
+        if (tslist_begin(list) == tslist_back(list)) \
+        { \
+            ((tslist_t*)(list))->tail = tslist_list(list); \
+        } \
+        slist_pop_front(tslist_list(list)); \
+    }while(0)
+
+/*!
+    \brief      Inserts a new node at the end of the list in O(1).
+
+    \param list A pointer to the tail anchored list.
+    \param node A pointer to the new node to be inserted.
+*/
+#define tslist_push_back(list,node) \
+    do{ \
+        ((slist_node_t*)(node))->next = tslist_list(list); \
+        ((tslist_t*)(list))->tail->next = ((slist_node_t*)(node)); \
+        ((tslist_t*)(list))->tail = ((slist_node_t*)(node)); \
+    }while(0)
+
+/*!
+    \brief      Removes the last node from a non empty list. O(n).
+
+    \param list A pointer to the tail anchored list.
+*/
+#define tslist_pop_back(list) \
+    do{ \
+        ((tslist_t*)(list))->tail = tslist_prev(list,tslist_back(list)); \
+        ((tslist_t*)(list))->tail->next = tslist_list(list); \
+    }while(0)
+
+/*!
+    \brief      Inserts a new node after a given position in the list.
+
+    \param list A pointer to the tail anchored list.
+    \param pos A pointer to the node after which the new node should be inserted,
+               the list control node inserts at the front.
+    \param node A pointer to the new node to be inserted.
+*/
+#define tslist_insert_after(list,pos,node) \
+    do{ \
+        slist_insert_after(tslist_list(list),pos,node); \
+        tslist_update_tail(list,node); \
+    }while(0)
+
+/*!
+    \brief      Removes the node following a given position from the list in O(1).
+
+    \param list A pointer to the tail anchored list.
+    \param pos A pointer to the node whose successor should be removed, the
+               list control node removes the first node.
+*/
+#define tslist_erase_after(list,pos) \
+    do{ \
+        if (((slist_node_t*)(pos))->next == tslist_back(list)) \
+        { \
+            ((tslist_t*)(list))->tail = ((slist_node_t*)(pos)); \
+        } \
+        slist_erase_after(tslist_list(list),pos); \
+    }while(0)
+
+/*!
+    \brief      Inserts a new node before a given position in the list. O(n).
+
+    \param list A pointer to the tail anchored list.
+    \param pos A pointer to the node before which the new node should be inserted,
+               the list control node inserts at the back.
+    \param node A pointer to the new node to be inserted.
+*/
+#define tslist_insert_before(list,pos,node) \
+    do{ \
+        slist_insert_before(tslist_list(list),pos,node); \
+        tslist_update_tail(list,node); \
+    }while(0)
+
+/*!
+    \brief      Removes a node from the list. O(n).
+
+    \param list A pointer to the tail anchored list.
+    \param node A pointer to the node to be removed from the list.
+*/
+void tslist_erase(tslist_t *list, slist_node_t *node);
+
+/*!
+    \brief      Removes the node following a given position and marks it as
+                unlinked in O(1), see `slist_node_init`.
+
+    \param list A pointer to the tail anchored list.
+    \param pos A pointer to the node whose successor should be removed, the
+               list control node removes the first node.
+*/
+#define tslist_erase_after_safe(list,pos) \
+    do{ \
+        slist_node_t *tslist_erased_ = ((slist_node_t*)(pos))->next; \
+        tslist_erase_after(list,pos); \
+        slist_node_init(tslist_erased_); \
+    }while(0)
+
+/*!
+    \brief      Removes a node from the list and marks it as unlinked. O(n).
+
+    \param list A pointer to the tail anchored list.
+    \param node A pointer to the node to be removed from the list.
+*/
+#define tslist_erase_safe(list,node) \
+    do{ \
+        slist_node_t *tslist_erased_ = ((slist_node_t*)(node)); \
+        tslist_erase(list,tslist_erased_); \
+        slist_node_init(tslist_erased_); \
+    }while(0)
+
+/*!
+    \brief      Returns the number of nodes in the list. O(n).
+
+    \param list A pointer to the tail anchored list.
+
+    \return The number of nodes in the list.
+*/
+#define tslist_size(list) \
+    slist_size(tslist_list(list))
+
+/*!
+    \brief      Searches for a node within the list.
+
+    \param list A pointer to the tail anchored list.
+    \param node The node to search for.
+
+    \return A pointer to the found node if it exists in the list, otherwise NULL.
+*/
+#define tslist_find(list,node) \
+    slist_find(tslist_list(list),((slist_node_t*)(node)))
+
+/*!
+    \brief      Moves all nodes of another tail anchored list after a given position in O(1).
+
+    \details    `other` is empty afterwards. `tslist_splice(list, tslist_back(list), other)`
+                appends `other` to `list`, e.g. to hand over a batch of queued nodes.
+
+    \param list A pointer to the target tail anchored list.
+    \param pos A pointer to the node after which the nodes are inserted, the
+               list control node inserts at the front.
+    \param other A pointer to the tail anchored list to move.
+*/
+void tslist_splice(tslist_t *list, slist_node_t *pos, tslist_t *other);
+
+/*!
+    \brief      Splits a tail anchored list after a node in O(1).
+
+    \details    Moves all nodes after `pos` into `other`, `list` ends with `pos`.
+                Previous contents of `other` are discarded.
+
+    \param list A pointer to the tail anchored list to split.
+    \param pos A pointer to the last node to keep, the list control node moves all nodes.
+    \param other A pointer to the tail anchored list receiving the nodes.
+*/
+void tslist_cut_after(tslist_t *list, slist_node_t *pos, tslist_t *other);
+
+#endif /* TSLIST_H_ */
@@ -0,0 +1,234 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       ulist.c
+
+    \brief      Unrolled linked list
+
+    \details    see header file
+*/
+#include "ulist.h"
+
+#define ulist_chunk_item(list,chunk,index) \
+    ((uint8_t*)(chunk) + (list)->item_offset + (size_t)(index) * (list)->item_size)
+
+#define ulist_chunk_index(list,chunk) \
+    ((size_t)((uint8_t*)(chunk) - (list)->pool_items) / (list)->chunk_size)
+
+/* freed chunks are reused first, then the never used tail of the pool, both O(1) */
+static ulist_chunk_t* ulist_chunk_alloc(ulist_t *list)
+{
+    ulist_chunk_t *chunk;
+
+    if (!dlist_empty(&list->free))
+    {
+        chunk = (ulist_chunk_t*)dlist_front(&list->free);
+        dlist_pop_front(&list->free);
+    }
+    else if (list->unused < list->pool_size)
+    {
+        chunk = (ulist_chunk_t*)(list->pool_items + list->unused * list->chunk_size);
+        list->unused++;
+    }
+    else
+    {
+        return NULL;
+    }
+
+    list->pool_status[ulist_chunk_index(list, chunk)] = ITEMPOOL_ITEM_USED;
+    chunk->count = 0;
+
+    return chunk;
+}
+
+static void ulist_chunk_free(ulist_t *list, ulist_chunk_t *chunk)
+{
+    dlist_erase(&list->chunks, &chunk->node);
+    dlist_push_front(&list->free, &chunk->node);
+    list->pool_status[ulist_chunk_index(list, chunk)] = ITEMPOOL_ITEM_FREE;
+}
+
+void ulist_init(ulist_t *list, uint8_t *pool_items, uint8_t *pool_status, size_t chunk_size, size_t pool_size,
+                size_t item_size, size_t item_offset, uint8_t capacity)
+{
+    dlist_init(&list->chunks);
+    dlist_init(&list->free);
+    list->unused = 0;
+    list->pool_items = pool_items;
+    list->pool_status = pool_status;
+    list->chunk_size = chunk_size;
+    list->pool_size = pool_size;
+    list->item_size = item_size;
+    list->item_offset = item_offset;
+    list->capacity = capacity;
+    list->count = 0;
+
+    memset(pool_status, ITEMPOOL_ITEM_FREE, pool_size);
+}
+
+void* ulist_insert(ulist_t *list, ulist_iterator_t *iterator, const void *item)
+{
+    ulist_chunk_t *chunk = iterator->chunk;
+    uint8_t index = iterator->index;
+    ulist_chunk_t *spare;
+    uint8_t *slot;
+
+    /* past the end appends to the last chunk, if there is one */
+    if ((dlist_node_t*)chunk == dlist_end(&list->chunks) && !dlist_empty(&list->chunks))
+    {
+        chunk = (ulist_chunk_t*)dlist_back(&list->chunks);
+        index = chunk->count;
+    }
+
+    if ((dlist_node_t*)chunk == dlist_end(&list->chunks) || chunk->count == list->capacity)
+    {
+        spare = ulist_chunk_alloc(list);
+
+        if (!spare)
+        {
+            return NULL;
+        }
+
+        if ((dlist_node_t*)chunk == dlist_end(&list->chunks))
+        {
+            /* empty list */
+            dlist_push_back(&list->chunks, &spare->node);
+            chunk = spare;
+            index = 0;
+        }
+        else if (index == chunk->count)
+        {
+            /* appending at a full chunk keeps it full */
+            dlist_insert_after(&list->chunks, &chunk->node, &spare->node);
+            chunk = spare;
+            index = 0;
+        }
+        else
+        {
+            /* split in halves, the upper half moves to the new chunk */
+            uint8_t half = (uint8_t)(chunk->count / 2);
+
+            spare->count = (uint8_t)(chunk->count - half);
+            memcpy(ulist_chunk_item(list, spare, 0), ulist_chunk_item(list, chunk, half), spare->count * list->item_size);
+            chunk->count = half;
+            dlist_insert_after(&list->chunks, &chunk->node, &spare->node);
+
+            if (index > half)
+            {
+                chunk = spare;
+                index = (uint8_t)(index - half);
+            }
+        }
+    }
+
+    slot = ulist_chunk_item(list, chunk, index);
+    memmove(slot + list->item_size, slot, (size_t)(chunk->count - index) * list->item_size);
+
+    if (item)
+    {
+        memcpy(slot, item, list->item_size);
+    }
+
+    chunk->count++;
+    list->count++;
+    iterator->chunk = chunk;
+    iterator->index = index;
+
+    return slot;
+}
+
+void* ulist_push_back(ulist_t *list, const void *item)
+{
+    ulist_iterator_t iterator;
+
+    ulist_end(list, iterator);
+
+    return ulist_insert(list, &iterator, item);
+}
+
+void ulist_erase(ulist_t *list, ulist_iterator_t *iterator)
+{
+    ulist_chunk_t *chunk = iterator->chunk;
+    ulist_chunk_t *prev = (ulist_chunk_t*)dlist_prev(&list->chunks, &chunk->node);
+    ulist_chunk_t *next = (ulist_chunk_t*)dlist_next(&list->chunks, &chunk->node);
+    uint8_t index = iterator->index;
+    uint8_t *slot = ulist_chunk_item(list, chunk, index);
+
+    chunk->count--;
+    list->count--;
+    memmove(slot, slot + list->item_size, (size_t)(chunk->count - index) * list->item_size);
+
+    if (chunk->count == 0)
+    {
+        ulist_chunk_free(list, chunk);
+        iterator->chunk = next;
+        iterator->index = 0;
+        return;
+    }
+
+    /* merges with a neighbour when both fit into one chunk, the predecessor first */
+    if ((dlist_node_t*)prev != dlist_end(&list->chunks) && prev->count + chunk->count <= list->capacity)
+    {
+        memcpy(ulist_chunk_item(list, prev, prev->count), ulist_chunk_item(list, chunk, 0), chunk->count * list->item_size);
+        index = (uint8_t)(prev->count + index);
+        prev->count = (uint8_t)(prev->count + chunk->count);
+        ulist_chunk_free(list, chunk);
+        chunk = prev;
+    }
+    else if ((dlist_node_t*)next != dlist_end(&list->chunks) && chunk->count + next->count <= list->capacity)
+    {
+        memcpy(ulist_chunk_item(list, chunk, chunk->count), ulist_chunk_item(list, next, 0), next->count * list->item_size);
+        chunk->count = (uint8_t)(chunk->count + next->count);
+        ulist_chunk_free(list, next);
+        next = (ulist_chunk_t*)dlist_next(&list->chunks, &chunk->node);
+    }
+
+    if (index == chunk->count)
+    {
+        chunk = next;
+        index = 0;
+    }
+
+    iterator->chunk = chunk;
+    iterator->index = index;
+}
+
+void ulist_clear(ulist_t *list)
+{
+    dlist_node_t *node;
+
+    dlist_foreach(&list->chunks, node)
+    {
+        list->pool_status[ulist_chunk_index(list, node)] = ITEMPOOL_ITEM_FREE;
+    }
+
+    dlist_splice(&list->free, dlist_end(&list->free), &list->chunks);
+
+    list->count = 0;
+}
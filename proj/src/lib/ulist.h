@@ -0,0 +1,314 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/*!
+    \file       ulist.h
+
+    \brief      Unrolled linked list
+
+    \details    An unrolled linked list stores a small array of items in every
+                node instead of a single one. Traversal reads several items per
+                node from consecutive memory, so it misses the cache once per
+                node rather than once per item, and the per item overhead of the
+                links is shared by the whole array. Inserting and erasing only
+                shift the items within one node.
+                [Wikipedia - Unrolled linked list](https://en.wikipedia.org/wiki/Unrolled_linked_list)
+
+                The nodes, called chunks here, are chained in a dlist (see
+                dlist.h) and drawn from an item pool (see itempool.h). Items are
+                copied into the chunks by value. A chunk that runs full when
+                inserting in its middle is split in halves; appending to a full
+                chunk starts a new one, so a list built by appending is densely
+                packed. A chunk that empties is returned to the pool, and erasing
+                merges a chunk with a neighbour when both fit into one.
+
+                Chunks returned to the pool are kept on a free list and handed
+                out again before the never used rest of the pool, so taking a
+                chunk is O(1) rather than a scan of the pool status. The pool
+                of a list must therefore not be shared with `itempool_alloc`.
+
+                Positions are given by iterators, which stay valid until the
+                list is modified other than through them.
+
+                \code
+                typedef struct {
+                    uint16_t id;
+                    uint16_t value;
+                } record_t;
+
+                ULIST_TYPEDEF(records,record_t,16,8);
+                ULIST_T(records) records;
+                ulist_iterator_t iterator;
+
+                ULIST_INIT(records);
+                ulist_push_back(ULIST(records), &record);
+
+                ulist_foreach(ULIST(records), iterator)
+                {
+                    record_t *item = ulist_item(ULIST(records), iterator);
+                    ...
+                }
+                \endcode
+*/
+
+#ifndef ULIST_H_
+#define ULIST_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+#include "dlist.h"
+#include "itempool.h"
+#include "utils.h"
+
+/*!
+    \brief      Header of a chunk, followed by its item array.
+*/
+typedef struct {
+    dlist_node_t node;      //!< Link within the chunk list
+    uint8_t count;          //!< Number of items used in the chunk
+} ulist_chunk_t;
+
+/*!
+    \brief      Unrolled list control structure.
+
+    \details    Usually embedded by `ULIST_TYPEDEF` together with its chunk
+                pool, but can be set up on any chunk pool with `ulist_init`.
+*/
+typedef struct {
+    dlist_t chunks;         //!< Chunks in list order
+    dlist_t free;           //!< Chunks returned to the pool, reused first
+    size_t unused;          //!< Index of the first never used chunk of the pool
+    uint8_t *pool_items;    //!< Chunk array of the pool
+    uint8_t *pool_status;   //!< Status array of the pool
+    size_t chunk_size;      //!< Size of a chunk including its items
+    size_t pool_size;       //!< Number of chunks in the pool
+    size_t item_size;       //!< Size of an item
+    size_t item_offset;     //!< Offset of the item array within a chunk
+    uint8_t capacity;       //!< Number of items per chunk
+    size_t count;           //!< Number of items in the list
+} ulist_t;
+
+/*!
+    \brief      Position of an item within an unrolled list.
+
+    \details    The past-the-end position has `chunk` pointing to the chunk list.
+*/
+typedef struct {
+    ulist_chunk_t *chunk;   //!< Chunk holding the item
+    uint8_t index;          //!< Index of the item within the chunk
+} ulist_iterator_t;
+
+/*!
+    \brief      Defines a new unrolled list type with its own chunk pool.
+
+    \details    Also defines `name##_ulist_chunk_t`, the chunk type, and the
+                item pool type `name##_ulist_itempool_t`.
+
+    \param name     The base name of the new type, the type is `name##_ulist_t`.
+    \param type     The data type of the items.
+    \param capacity The number of items per chunk, 1 to 255, checked at compile time.
+    \param chunks   The number of chunks in the pool.
+*/
+#define ULIST_TYPEDEF(name,type,capacity,chunks) \
+    typedef char name##_ulist_check_t[((capacity) >= 1 && (capacity) <= UINT8_MAX) ? 1 : -1]; \
+    typedef struct { \
+        ulist_chunk_t chunk; \
+        type items[capacity]; \
+    }name##_ulist_chunk_t; \
+    ITEMPOOL_TYPEDEF(name##_ulist,name##_ulist_chunk_t,chunks); \
+    typedef struct { \
+        ulist_t list; \
+        ITEMPOOL_T(name##_ulist) pool; \
+    }name##_ulist_t
+
+/*!
+    \brief      Names an unrolled list type defined with `ULIST_TYPEDEF`.
+
+    \param name     The base name as specified in `ULIST_TYPEDEF`.
+*/
+#define ULIST_T(name) \
+    name##_ulist_t
+
+/*!
+    \brief      Returns a pointer to the control structure of an unrolled list instance.
+
+    \details    All `ulist_*` functions and macros take this pointer.
+
+    \param ulist    The variable of a type defined with `ULIST_TYPEDEF`.
+*/
+#define ULIST(ulist) \
+    (&(ulist).list)
+
+/*!
+    \brief      Initializes an unrolled list instance to be empty.
+
+    \param ulist    The variable of a type defined with `ULIST_TYPEDEF`.
+*/
+#define ULIST_INIT(ulist) \
+    ulist_init(ULIST(ulist), \
+        (uint8_t*)ITEMPOOL_ITEMS((ulist).pool), \
+        ITEMPOOL_STATUS((ulist).pool), \
+        ITEMPOOL_ITEM_SIZE((ulist).pool), \
+        ITEMPOOL_SIZE((ulist).pool), \
+        sizeof(ITEMPOOL_ITEMS((ulist).pool)[0].items[0]), \
+        (size_t)((uint8_t*)ITEMPOOL_ITEMS((ulist).pool)[0].items - (uint8_t*)ITEMPOOL_ITEMS((ulist).pool)), \
+        (uint8_t)(sizeof(ITEMPOOL_ITEMS((ulist).pool)[0].items)/sizeof(ITEMPOOL_ITEMS((ulist).pool)[0].items[0])))
+
+/*!
+    \brief      Returns the number of items in the list.
+
+    \param list Pointer to the unrolled list control structure.
+*/
+#define ulist_size(list) \
+    (((ulist_t*)(list))->count)
+
+/*!
+    \brief      Checks if the list is empty.
+
+    \param list Pointer to the unrolled list control structure.
+*/
+#define ulist_empty(list) \
+    (((ulist_t*)(list))->count == 0)
+
+/*!
+    \brief      Sets an iterator to the first item, or past the end if the list is empty.
+
+    \param list     Pointer to the unrolled list control structure.
+    \param iterator A `ulist_iterator_t` variable.
+*/
+#define ulist_begin(list,iterator) \
+    ((iterator).chunk = (ulist_chunk_t*)dlist_begin(&((ulist_t*)(list))->chunks), (iterator).index = 0)
+
+/*!
+    \brief      Sets an iterator past the last item.
+
+    \param list     Pointer to the unrolled list control structure.
+    \param iterator A `ulist_iterator_t` variable.
+*/
+#define ulist_end(list,iterator) \
+    ((iterator).chunk = (ulist_chunk_t*)dlist_end(&((ulist_t*)(list))->chunks), (iterator).index = 0)
+
+/*!
+    \brief      Checks if an iterator is past the last item.
+
+    \param list     Pointer to the unrolled list control structure.
+    \param iterator A `ulist_iterator_t` variable.
+*/
+#define ulist_is_end(list,iterator) \
+    ((dlist_node_t*)(iterator).chunk == dlist_end(&((ulist_t*)(list))->chunks))
+
+/*!
+    \brief      Advances an iterator to the next item.
+
+    \details    Usually stays within the chunk, only every `capacity` items
+                the next chunk is entered.
+
+    \param list     Pointer to the unrolled list control structure.
+    \param iterator A `ulist_iterator_t` variable, not past the end.
+*/
+#define ulist_next(list,iterator) \
+    (++(iterator).index < (iterator).chunk->count ? (void)0 : \
+        (void)((iterator).chunk = (ulist_chunk_t*)dlist_next(&((ulist_t*)(list))->chunks,(iterator).chunk), (iterator).index = 0))
+
+/*!
+    \brief      Returns a pointer to the item at an iterator.
+
+    \param list     Pointer to the unrolled list control structure.
+    \param iterator A `ulist_iterator_t` variable, not past the end.
+*/
+#define ulist_item(list,iterator) \
+    ((void*)((uint8_t*)(iterator).chunk + ((ulist_t*)(list))->item_offset + \
+        (size_t)(iterator).index * ((ulist_t*)(list))->item_size))
+
+/*!
+    \brief      Iterates over all items of the list.
+
+    \param list     Pointer to the unrolled list control structure.
+    \param iterator A `ulist_iterator_t` variable, see `ulist_item`.
+*/
+#define ulist_foreach(list,iterator) \
+    for(ulist_begin(list,iterator); !ulist_is_end(list,iterator); ulist_next(list,iterator))
+
+/*!
+    \brief      Initializes an empty list on a chunk pool.
+
+    \param list         Pointer to the unrolled list control structure.
+    \param pool_items   Chunk array of the pool.
+    \param pool_status  Status array of the pool, marked free here.
+    \param chunk_size   Size of a chunk including its items.
+    \param pool_size    Number of chunks in the pool.
+    \param item_size    Size of an item.
+    \param item_offset  Offset of the item array within a chunk.
+    \param capacity     Number of items per chunk, at least 1.
+*/
+void ulist_init(ulist_t *list, uint8_t *pool_items, uint8_t *pool_status, size_t chunk_size, size_t pool_size,
+                size_t item_size, size_t item_offset, uint8_t capacity);
+
+/*!
+    \brief      Inserts an item before a position.
+
+    \param list     Pointer to the unrolled list control structure.
+    \param iterator Position to insert before, past the end appends. Points
+                    to the inserted item afterwards.
+    \param item     The item to copy into the list, NULL leaves it uninitialized.
+
+    \return     A pointer to the item within the list, or NULL if the chunk
+                pool is exhausted; the list is unchanged in that case.
+*/
+void* ulist_insert(ulist_t *list, ulist_iterator_t *iterator, const void *item);
+
+/*!
+    \brief      Appends an item to the list.
+
+    \param list     Pointer to the unrolled list control structure.
+    \param item     The item to copy into the list, NULL leaves it uninitialized.
+
+    \return     A pointer to the item within the list, or NULL if the chunk
+                pool is exhausted.
+*/
+void* ulist_push_back(ulist_t *list, const void *item);
+
+/*!
+    \brief      Removes the item at a position.
+
+    \param list     Pointer to the unrolled list control structure.
+    \param iterator Position of the item to remove, points to the following
+                    item afterwards, which allows erasing while iterating.
+*/
+void ulist_erase(ulist_t *list, ulist_iterator_t *iterator);
+
+/*!
+    \brief      Removes all items and returns all chunks to the pool.
+
+    \param list     Pointer to the unrolled list control structure.
+*/
+void ulist_clear(ulist_t *list);
+
+#endif /* ULIST_H_ */
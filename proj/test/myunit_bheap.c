@@ -0,0 +1,191 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#include "myunit.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include "bheap.h"
+
+typedef struct {
+    uint16_t deadline;
+    uint16_t id;
+} event_t;
+
+#define event_less(a,b) \
+    ((a).deadline < (b).deadline)
+
+#define int_greater(a,b) \
+    ((a) > (b))
+
+BHEAP_TYPEDEF(events,event_t,64);
+BHEAP_TYPEDEF(queue,event_t,100);
+BHEAP_TYPEDEF(ints,int,5);
+
+MYUNIT_TESTCASE(bheap_initialization)
+{
+    BHEAP_T(ints) heap;
+    memset(&heap,0xAA,sizeof(heap));
+
+    BHEAP_INIT(heap);
+
+    MYUNIT_ASSERT_EQUAL(BHEAP_COUNT(heap), 0);
+    MYUNIT_ASSERT_EQUAL(BHEAP_SIZE(heap), 5);
+    MYUNIT_ASSERT_TRUE(BHEAP_EMPTY(heap));
+    MYUNIT_ASSERT_FALSE(BHEAP_FULL(heap));
+}
+
+MYUNIT_TESTCASE(bheap_pops_in_order)
+{
+    BHEAP_T(events) heap;
+    event_t event;
+    uint16_t idx;
+    uint16_t prev = 0;
+
+    BHEAP_INIT(heap);
+
+    for (idx = 0; idx < 64; idx++)
+    {
+        event.deadline = (uint16_t)(idx * 29 % 64);
+        event.id = idx;
+        BHEAP_PUSH(heap,event,event_less);
+        MYUNIT_ASSERT_TRUE(BHEAP_TOP_PTR(heap)->deadline <= event.deadline);
+    }
+
+    MYUNIT_ASSERT_TRUE(BHEAP_FULL(heap));
+    MYUNIT_ASSERT_EQUAL(BHEAP_TOP_VAL(heap).deadline, 0);
+
+    for (idx = 0; idx < 64; idx++)
+    {
+        MYUNIT_ASSERT_TRUE(BHEAP_TOP_PTR(heap)->deadline >= prev);
+        MYUNIT_ASSERT_EQUAL(BHEAP_TOP_PTR(heap)->deadline, idx);
+        prev = BHEAP_TOP_PTR(heap)->deadline;
+        BHEAP_POP(heap,event_less);
+    }
+
+    MYUNIT_ASSERT_TRUE(BHEAP_EMPTY(heap));
+}
+
+/* no item orders before its parent */
+static bool bheap_check(BHEAP_T(queue) *heap)
+{
+    size_t idx;
+
+    for (idx = 1; idx < BHEAP_COUNT(*heap); idx++)
+    {
+        if (event_less(BHEAP_ITEMS(*heap)[idx], BHEAP_ITEMS(*heap)[(idx-1)/2]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* pushes and pops interleaved, with duplicate keys */
+MYUNIT_TESTCASE(bheap_interleaved)
+{
+    BHEAP_T(queue) heap;
+    event_t event;
+    uint16_t idx;
+    uint16_t popped = 0;
+
+    BHEAP_INIT(heap);
+
+    for (idx = 0; idx < 200; idx++)
+    {
+        event.deadline = (uint16_t)(idx * 13 % 50);
+        event.id = idx;
+        BHEAP_PUSH(heap,event,event_less);
+        MYUNIT_ASSERT_TRUE(bheap_check(&heap));
+
+        if (idx % 2 == 0)
+        {
+            BHEAP_POP(heap,event_less);
+            MYUNIT_ASSERT_TRUE(bheap_check(&heap));
+        }
+    }
+
+    MYUNIT_ASSERT_EQUAL(BHEAP_COUNT(heap), 100);
+
+    while (!BHEAP_EMPTY(heap))
+    {
+        MYUNIT_ASSERT_TRUE(BHEAP_TOP_PTR(heap)->deadline >= popped);
+        popped = BHEAP_TOP_PTR(heap)->deadline;
+        BHEAP_POP(heap,event_less);
+    }
+
+    MYUNIT_ASSERT_EQUAL(popped, 49);
+}
+
+MYUNIT_TESTCASE(bheap_max_heap)
+{
+    BHEAP_T(ints) heap;
+
+    BHEAP_INIT(heap);
+
+    BHEAP_PUSH(heap,3,int_greater);
+    BHEAP_PUSH(heap,-1,int_greater);
+    BHEAP_PUSH(heap,7,int_greater);
+    BHEAP_PUSH(heap,7,int_greater);
+    BHEAP_PUSH(heap,5,int_greater);
+
+    MYUNIT_ASSERT_TRUE(BHEAP_FULL(heap));
+    MYUNIT_ASSERT_EQUAL(BHEAP_TOP_VAL(heap), 7);
+    BHEAP_POP(heap,int_greater);
+    MYUNIT_ASSERT_EQUAL(BHEAP_TOP_VAL(heap), 7);
+    BHEAP_POP(heap,int_greater);
+    MYUNIT_ASSERT_EQUAL(BHEAP_TOP_VAL(heap), 5);
+    BHEAP_POP(heap,int_greater);
+    MYUNIT_ASSERT_EQUAL(BHEAP_TOP_VAL(heap), 3);
+    BHEAP_POP(heap,int_greater);
+    MYUNIT_ASSERT_EQUAL(BHEAP_TOP_VAL(heap), -1);
+    BHEAP_POP(heap,int_greater);
+    MYUNIT_ASSERT_TRUE(BHEAP_EMPTY(heap));
+}
+
+void myunit_testsuite_setup()
+{
+
+}
+
+void myunit_testsuite_teardown()
+{
+
+}
+
+MYUNIT_TESTSUITE(bheap)
+{
+    MYUNIT_TESTSUITE_BEGIN();
+
+    MYUNIT_EXEC_TESTCASE(bheap_initialization);
+    MYUNIT_EXEC_TESTCASE(bheap_pops_in_order);
+    MYUNIT_EXEC_TESTCASE(bheap_interleaved);
+    MYUNIT_EXEC_TESTCASE(bheap_max_heap);
+
+    MYUNIT_TESTSUITE_END();
+}
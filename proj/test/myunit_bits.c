@@ -604,6 +604,24 @@ MYUNIT_TESTCASE(BITS_TOGGLE_FullWordToggle)
                 allocates memory, or performs other setup tasks needed before executing
                 individual test cases.
 */
+MYUNIT_TESTCASE(BITS_LOG2_Q16_PowersAndFractions)
+{
+    // PRECONDITIONS:
+    uint32_t ten;
+    uint32_t three;
+
+    // EXECUTE TESTCASE:
+    ten = bits_log2_q16(10);          // 3.321928 * 65536 = 217705.5
+    three = bits_log2_q16(3);         // 1.584963 * 65536 = 103872.9
+
+    // POSTCONDITIONS:
+    MYUNIT_ASSERT_EQUAL(bits_log2_q16(1), 0UL);
+    MYUNIT_ASSERT_EQUAL(bits_log2_q16(1024), 10UL << 16);
+    MYUNIT_ASSERT_EQUAL(bits_log2_q16(0x80000000UL), 31UL << 16);
+    MYUNIT_ASSERT_TRUE(ten > 217705UL - 8 && ten <= 217706UL);   // truncated, never above
+    MYUNIT_ASSERT_TRUE(three > 103873UL - 8 && three <= 103873UL);
+}
+
 void myunit_testsuite_setup()
 {
 
@@ -666,6 +684,7 @@ MYUNIT_TESTSUITE(bits)
     MYUNIT_EXEC_TESTCASE(BITS_TOGGLE_NoOpToggle);
     MYUNIT_EXEC_TESTCASE(BITS_TOGGLE_EdgeBits);
     MYUNIT_EXEC_TESTCASE(BITS_TOGGLE_FullWordToggle);
+    MYUNIT_EXEC_TESTCASE(BITS_LOG2_Q16_PowersAndFractions);
 
     MYUNIT_TESTSUITE_END();
 }
@@ -0,0 +1,222 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#include "myunit.h"
+#include <stdint.h>
+#include "bloom.h"
+
+#define KEY_COUNT   2000
+#define PROBE_COUNT 20000
+
+/* 1% at 2^-7 ~ 0.8% */
+BLOOM_TYPEDEF(small,BLOOM_BITS_FOR(KEY_COUNT,7));
+/* power of two sized filter, reduced by masking */
+BLOOM_TYPEDEF(pow2,16384);
+
+BLOOM_T(small) small;
+BLOOM_T(pow2) pow2;
+
+/* keys 0..KEY_COUNT-1 are added, probes start at KEY_COUNT */
+static uint32_t count_false_positives(bloom_t *bloom)
+{
+    uint32_t key;
+    uint32_t hits = 0;
+
+    for (key = KEY_COUNT; key < KEY_COUNT + PROBE_COUNT; key++)
+    {
+        hits += bloom_contains(bloom, &key, sizeof(key));
+    }
+
+    return hits;
+}
+
+static void fill(bloom_t *bloom)
+{
+    uint32_t key;
+
+    for (key = 0; key < KEY_COUNT; key++)
+    {
+        bloom_add(bloom, &key, sizeof(key));
+    }
+}
+
+static bool contains_all(bloom_t *bloom)
+{
+    uint32_t key;
+
+    for (key = 0; key < KEY_COUNT; key++)
+    {
+        if (!bloom_contains(bloom, &key, sizeof(key)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+MYUNIT_TESTCASE(bloom_empty_contains_nothing)
+{
+    BLOOM_INIT(small, BLOOM_HASHES_FOR(7));
+
+    MYUNIT_ASSERT_EQUAL(count_false_positives(BLOOM(small)), 0);
+}
+
+MYUNIT_TESTCASE(bloom_no_false_negatives)
+{
+    BLOOM_INIT(small, BLOOM_HASHES_FOR(7));
+    fill(BLOOM(small));
+    MYUNIT_ASSERT_TRUE(contains_all(BLOOM(small)));
+
+    BLOOM_INIT(pow2, 5);
+    fill(BLOOM(pow2));
+    MYUNIT_ASSERT_TRUE(contains_all(BLOOM(pow2)));
+}
+
+MYUNIT_TESTCASE(bloom_false_positive_rate)
+{
+    uint32_t hits;
+
+    /* expected 2^-7 of PROBE_COUNT ~ 156, allow for variance and the rounding of k */
+    BLOOM_INIT(small, BLOOM_HASHES_FOR(7));
+    fill(BLOOM(small));
+    hits = count_false_positives(BLOOM(small));
+    MYUNIT_ASSERT_TRUE(hits > 60);
+    MYUNIT_ASSERT_TRUE(hits < 300);
+
+    /* 8.19 bits per key and 5 hashes, expected ~ 2.3% */
+    BLOOM_INIT(pow2, 5);
+    fill(BLOOM(pow2));
+    hits = count_false_positives(BLOOM(pow2));
+    MYUNIT_ASSERT_TRUE(hits > 250);
+    MYUNIT_ASSERT_TRUE(hits < 700);
+}
+
+MYUNIT_TESTCASE(bloom_clear)
+{
+    BLOOM_INIT(small, BLOOM_HASHES_FOR(7));
+    fill(BLOOM(small));
+    bloom_clear(BLOOM(small));
+
+    MYUNIT_ASSERT_EQUAL(count_false_positives(BLOOM(small)), 0);
+    MYUNIT_ASSERT_FALSE(contains_all(BLOOM(small)));
+}
+
+MYUNIT_TESTCASE(bloom_sizing)
+{
+    /* 1%: 9.585 bits per key and 7 hashes */
+    MYUNIT_ASSERT_TRUE(bloom_size_for(1000, 10000) >= 9585);
+    MYUNIT_ASSERT_TRUE(bloom_size_for(1000, 10000) <= 9600);
+    MYUNIT_ASSERT_EQUAL(bloom_hashes_for(10000), 7);
+
+    /* 0.1%: 14.378 bits per key and 10 hashes */
+    MYUNIT_ASSERT_TRUE(bloom_size_for(1000, 1000) >= 14378);
+    MYUNIT_ASSERT_TRUE(bloom_size_for(1000, 1000) <= 14392);
+    MYUNIT_ASSERT_EQUAL(bloom_hashes_for(1000), 10);
+
+    /* 50%: 1.443 bits per key and a single hash */
+    MYUNIT_ASSERT_TRUE(bloom_size_for(1000, 500000) >= 1443);
+    MYUNIT_ASSERT_TRUE(bloom_size_for(1000, 500000) <= 1456);
+    MYUNIT_ASSERT_EQUAL(bloom_hashes_for(500000), 1);
+
+    /* out of range rates are clamped, huge key counts saturate */
+    MYUNIT_ASSERT_EQUAL(bloom_hashes_for(0), bloom_hashes_for(1));
+    MYUNIT_ASSERT_TRUE(bloom_hashes_for(2000000) >= 1);
+    MYUNIT_ASSERT_EQUAL(bloom_size_for(0xFFFFFFFFUL, 1), 0x7FFFFFF8UL);
+    MYUNIT_ASSERT_EQUAL(bloom_size_for(0, 10000), 0);
+
+    MYUNIT_ASSERT_EQUAL(BLOOM_BITS_FOR(1000,7), 10104);
+    MYUNIT_ASSERT_EQUAL(BLOOM_BITS_FOR(1000,7) % 8, 0);
+    MYUNIT_ASSERT_EQUAL(BLOOM_HASHES_FOR(7), 7);
+}
+
+#if defined(BLOOM_ENABLE_BLOCKED) && defined(UINT64_MAX)
+
+BLOOM_BLOCKED_TYPEDEF(blocked,(KEY_COUNT*11+511)/512);
+
+BLOOM_BLOCKED_T(blocked) blocked;
+
+MYUNIT_TESTCASE(bloom_blocked)
+{
+    uint32_t key;
+    uint32_t hits = 0;
+
+    BLOOM_BLOCKED_INIT(blocked, 7);
+
+    for (key = 0; key < KEY_COUNT; key++)
+    {
+        bloom_blocked_add(BLOOM(blocked), &key, sizeof(key));
+    }
+
+    for (key = 0; key < KEY_COUNT; key++)
+    {
+        MYUNIT_ASSERT_TRUE(bloom_blocked_contains(BLOOM(blocked), &key, sizeof(key)));
+    }
+
+    /* 11 bits per key, ~ 1% with blocking */
+    for (key = KEY_COUNT; key < KEY_COUNT + PROBE_COUNT; key++)
+    {
+        hits += bloom_blocked_contains(BLOOM(blocked), &key, sizeof(key));
+    }
+
+    MYUNIT_ASSERT_TRUE(hits > 60);
+    MYUNIT_ASSERT_TRUE(hits < 400);
+
+    bloom_blocked_clear(BLOOM(blocked));
+    MYUNIT_ASSERT_FALSE(bloom_blocked_contains(BLOOM(blocked), &key, sizeof(key)));
+
+    MYUNIT_ASSERT_EQUAL(bloom_blocked_blocks_for(KEY_COUNT, 10000), (9600*2+9600*2/8+511)/512);
+}
+
+#endif
+
+void myunit_testsuite_setup()
+{
+
+}
+
+void myunit_testsuite_teardown()
+{
+
+}
+
+MYUNIT_TESTSUITE(bloom)
+{
+    MYUNIT_TESTSUITE_BEGIN();
+
+    MYUNIT_EXEC_TESTCASE(bloom_empty_contains_nothing);
+    MYUNIT_EXEC_TESTCASE(bloom_no_false_negatives);
+    MYUNIT_EXEC_TESTCASE(bloom_false_positive_rate);
+    MYUNIT_EXEC_TESTCASE(bloom_clear);
+    MYUNIT_EXEC_TESTCASE(bloom_sizing);
+#if defined(BLOOM_ENABLE_BLOCKED) && defined(UINT64_MAX)
+    MYUNIT_EXEC_TESTCASE(bloom_blocked);
+#endif
+
+    MYUNIT_TESTSUITE_END();
+}
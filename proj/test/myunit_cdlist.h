@@ -0,0 +1,65 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#ifndef MYUNIT_CDLIST_H_
+#define MYUNIT_CDLIST_H_
+
+
+#include "cdlist.h"
+
+#define myunit_list_type cdlist
+
+typedef cdlist_t list_t;
+typedef dlist_node_t list_node_t;
+
+#define list_next(list,node)                cdlist_next(list,node)
+#define list_prev(list,node)                cdlist_prev(list,node)
+#define list_prev_prev(list,node)           cdlist_prev_prev(list,node)
+#define list_init(list)                     cdlist_init(list)
+#define list_begin(list)                    cdlist_begin(list)
+#define list_front(list)                    cdlist_front(list)
+#define list_end(list)                      cdlist_end(list)
+#define list_back(list)                     cdlist_back(list)
+#define list_foreach(list,it)               cdlist_foreach(list,it)
+#define list_empty(list)                    cdlist_empty(list)
+#define list_push_front(list,node)          cdlist_push_front(list,node)
+#define list_pop_front(list)                cdlist_pop_front(list)
+#define list_push_back(list,node)           cdlist_push_back(list,node)
+#define list_pop_back(list)                 cdlist_pop_back(list)
+#define list_insert_after(list,pos,node)    cdlist_insert_after(list,pos,node)
+#define list_insert_before(list,pos,node)   cdlist_insert_before(list,pos,node)
+#define list_erase(list,node)               cdlist_erase(list,node)
+#define list_erase_safe(list,node)          cdlist_erase_safe(list,node)
+#define list_erase_if_linked(list,node)     cdlist_erase_if_linked(list,node)
+#define list_node_init(node)                dlist_node_init(node)
+#define list_node_is_linked(node)           dlist_node_is_linked(node)
+#define list_size(list)                     cdlist_size(list)
+#define list_find(list,node)                cdlist_find(list,node)
+
+
+#endif /* MYUNIT_CDLIST_H_ */
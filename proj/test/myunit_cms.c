@@ -0,0 +1,301 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#include "myunit.h"
+#include <stdint.h>
+#include <string.h>
+#include "cms.h"
+
+#define KEY_COUNT   1000
+
+CMS_TYPEDEF(pow2,4,256);
+CMS_TYPEDEF(odd,3,251);
+CMS_TOPK_TYPEDEF(nodes,8,uint16_t);
+
+typedef struct {
+    uint8_t bytes[300];
+} blob_t;
+
+CMS_TOPK_TYPEDEF(blobs,3,blob_t);
+
+CMS_T(pow2) pow2;
+CMS_T(odd) odd;
+CMS_TOPK_T(nodes) nodes;
+CMS_TOPK_T(blobs) blobs;
+
+/* skewed stream, key i occurs 2000/(i+1) times, interleaved */
+static uint32_t occurrences(uint16_t key)
+{
+    return 2000UL / (key + 1);
+}
+
+static uint32_t feed(cms_t *cms, cms_topk_t *topk)
+{
+    uint32_t total = 0;
+    uint32_t round;
+    uint16_t key;
+
+    for (round = 0; round < occurrences(0); round++)
+    {
+        for (key = 0; key < KEY_COUNT; key++)
+        {
+            if (round < occurrences(key))
+            {
+                uint32_t estimate = cms_add(cms, &key, sizeof(key), 1);
+
+                if (topk)
+                {
+                    cms_topk_offer(topk, &key, estimate);
+                }
+
+                total++;
+            }
+        }
+    }
+
+    return total;
+}
+
+static void check_estimates(cms_t *cms, uint32_t total)
+{
+    uint32_t error = 0;
+    uint16_t key;
+
+    for (key = 0; key < KEY_COUNT; key++)
+    {
+        uint32_t estimate = cms_estimate(cms, &key, sizeof(key));
+
+        MYUNIT_ASSERT_TRUE(estimate >= occurrences(key));
+        error += estimate - occurrences(key);
+    }
+
+    /* e/w of the total is the bound per key with high probability, the mean is far lower */
+    MYUNIT_ASSERT_TRUE(error / KEY_COUNT < total * 3 / cms->width);
+}
+
+MYUNIT_TESTCASE(cms_empty)
+{
+    uint16_t key = 42;
+
+    CMS_INIT(pow2);
+
+    MYUNIT_ASSERT_EQUAL(CMS(pow2)->rows, 4);
+    MYUNIT_ASSERT_EQUAL(CMS(pow2)->width, 256);
+    MYUNIT_ASSERT_EQUAL(cms_estimate(CMS(pow2), &key, sizeof(key)), 0);
+}
+
+MYUNIT_TESTCASE(cms_never_underestimates)
+{
+    uint32_t total;
+
+    CMS_INIT(pow2);
+    total = feed(CMS(pow2), NULL);
+    check_estimates(CMS(pow2), total);
+
+    CMS_INIT(odd);
+    total = feed(CMS(odd), NULL);
+    check_estimates(CMS(odd), total);
+}
+
+MYUNIT_TESTCASE(cms_heavy_keys_are_accurate)
+{
+    uint16_t key;
+
+    CMS_INIT(pow2);
+    feed(CMS(pow2), NULL);
+
+    for (key = 0; key < 10; key++)
+    {
+        uint32_t estimate = cms_estimate(CMS(pow2), &key, sizeof(key));
+
+        MYUNIT_ASSERT_TRUE(estimate - occurrences(key) <= occurrences(key) / 10 + 20);
+    }
+}
+
+MYUNIT_TESTCASE(cms_add_counts)
+{
+    uint16_t key = 7;
+
+    CMS_INIT(pow2);
+
+    MYUNIT_ASSERT_EQUAL(cms_add(CMS(pow2), &key, sizeof(key), 5), 5);
+    MYUNIT_ASSERT_EQUAL(cms_add(CMS(pow2), &key, sizeof(key), 10), 15);
+    MYUNIT_ASSERT_EQUAL(cms_estimate(CMS(pow2), &key, sizeof(key)), 15);
+
+    /* saturates instead of wrapping */
+    MYUNIT_ASSERT_EQUAL(cms_add(CMS(pow2), &key, sizeof(key), UINT32_MAX), UINT32_MAX);
+    MYUNIT_ASSERT_EQUAL(cms_add(CMS(pow2), &key, sizeof(key), 1), UINT32_MAX);
+
+    cms_clear(CMS(pow2));
+    MYUNIT_ASSERT_EQUAL(cms_estimate(CMS(pow2), &key, sizeof(key)), 0);
+}
+
+MYUNIT_TESTCASE(cms_topk)
+{
+    uint16_t key;
+
+    CMS_INIT(pow2);
+    CMS_TOPK_INIT(nodes);
+
+    feed(CMS(pow2), CMS_TOPK(nodes));
+    cms_topk_sort(CMS_TOPK(nodes));
+
+    MYUNIT_ASSERT_EQUAL(cms_topk_size(CMS_TOPK(nodes)), 8);
+
+    for (key = 0; key < 8; key++)
+    {
+        MYUNIT_ASSERT_EQUAL(nodes.entries[key].key, key);
+        MYUNIT_ASSERT_EQUAL(nodes.entries[key].count, cms_estimate(CMS(pow2), &key, sizeof(key)));
+    }
+
+    cms_topk_clear(CMS_TOPK(nodes));
+    MYUNIT_ASSERT_EQUAL(cms_topk_size(CMS_TOPK(nodes)), 0);
+}
+
+MYUNIT_TESTCASE(cms_topk_replaces_lightest)
+{
+    uint16_t key;
+
+    CMS_TOPK_INIT(nodes);
+
+    for (key = 0; key < 8; key++)
+    {
+        MYUNIT_ASSERT_TRUE(cms_topk_offer(CMS_TOPK(nodes), &key, 10 + key));
+    }
+
+    /* not heavier than the lightest */
+    key = 100;
+    MYUNIT_ASSERT_FALSE(cms_topk_offer(CMS_TOPK(nodes), &key, 10));
+
+    /* replaces key 0 */
+    MYUNIT_ASSERT_TRUE(cms_topk_offer(CMS_TOPK(nodes), &key, 11));
+
+    /* updates a tracked key in place */
+    key = 3;
+    MYUNIT_ASSERT_TRUE(cms_topk_offer(CMS_TOPK(nodes), &key, 50));
+
+    cms_topk_sort(CMS_TOPK(nodes));
+
+    MYUNIT_ASSERT_EQUAL(cms_topk_size(CMS_TOPK(nodes)), 8);
+    MYUNIT_ASSERT_EQUAL(nodes.entries[0].key, 3);
+    MYUNIT_ASSERT_EQUAL(nodes.entries[0].count, 50);
+    MYUNIT_ASSERT_EQUAL(nodes.entries[1].key, 7);
+
+    for (key = 0; key < 8; key++)
+    {
+        MYUNIT_ASSERT_TRUE(nodes.entries[key].key != 0);
+    }
+
+    for (key = 1; key < 8; key++)
+    {
+        MYUNIT_ASSERT_TRUE(nodes.entries[key - 1].count >= nodes.entries[key].count);
+    }
+}
+
+/* more rows than supported are clamped, not written past the slot arrays */
+MYUNIT_TESTCASE(cms_rows_clamped)
+{
+    uint32_t counters[CMS_ROWS_MAX + 4][64];
+    cms_t cms;
+    uint16_t key = 42;
+
+    cms_init(&cms, &counters[0][0], CMS_ROWS_MAX + 4, 64);
+
+    MYUNIT_ASSERT_EQUAL(cms.rows, CMS_ROWS_MAX);
+    MYUNIT_ASSERT_EQUAL(cms_add(&cms, &key, sizeof(key), 3), 3);
+    MYUNIT_ASSERT_EQUAL(cms_estimate(&cms, &key, sizeof(key)), 3);
+}
+
+/* a zero width is rejected, updates must not index into the counters */
+MYUNIT_TESTCASE(cms_zero_width_rejected)
+{
+    uint32_t counters[4][1] = {{0}};
+    cms_t cms;
+    uint16_t key = 42;
+
+    MYUNIT_ASSERT_FALSE(cms_init(&cms, &counters[0][0], 4, 0));
+    MYUNIT_ASSERT_FALSE(cms_init(&cms, &counters[0][0], 0, 1));
+    MYUNIT_ASSERT_EQUAL(cms.rows, 0);
+
+    cms_add(&cms, &key, sizeof(key), 3);
+    MYUNIT_ASSERT_EQUAL(counters[0][0], 0);
+
+    MYUNIT_ASSERT_TRUE(cms_init(&cms, &counters[0][0], 4, 1));
+    MYUNIT_ASSERT_EQUAL(cms_add(&cms, &key, sizeof(key), 3), 3);
+}
+
+/* keys and entries larger than 255 bytes */
+MYUNIT_TESTCASE(cms_topk_large_keys)
+{
+    blob_t key;
+    uint8_t idx;
+
+    CMS_TOPK_INIT(blobs);
+
+    for (idx = 0; idx < 3; idx++)
+    {
+        memset(&key, idx, sizeof(key));
+        MYUNIT_ASSERT_TRUE(cms_topk_offer(CMS_TOPK(blobs), &key, 10 + idx));
+    }
+
+    cms_topk_sort(CMS_TOPK(blobs));
+
+    for (idx = 0; idx < 3; idx++)
+    {
+        memset(&key, 2 - idx, sizeof(key));
+        MYUNIT_ASSERT_EQUAL(blobs.entries[idx].count, (uint32_t)(12 - idx));
+        MYUNIT_ASSERT_MEM_EQUAL(&blobs.entries[idx].key, &key, sizeof(key));
+    }
+}
+
+void myunit_testsuite_setup()
+{
+
+}
+
+void myunit_testsuite_teardown()
+{
+
+}
+
+MYUNIT_TESTSUITE(cms)
+{
+    MYUNIT_TESTSUITE_BEGIN();
+
+    MYUNIT_EXEC_TESTCASE(cms_empty);
+    MYUNIT_EXEC_TESTCASE(cms_never_underestimates);
+    MYUNIT_EXEC_TESTCASE(cms_heavy_keys_are_accurate);
+    MYUNIT_EXEC_TESTCASE(cms_add_counts);
+    MYUNIT_EXEC_TESTCASE(cms_topk);
+    MYUNIT_EXEC_TESTCASE(cms_topk_replaces_lightest);
+    MYUNIT_EXEC_TESTCASE(cms_rows_clamped);
+    MYUNIT_EXEC_TESTCASE(cms_zero_width_rejected);
+    MYUNIT_EXEC_TESTCASE(cms_topk_large_keys);
+
+    MYUNIT_TESTSUITE_END();
+}
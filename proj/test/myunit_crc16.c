@@ -28,10 +28,57 @@
 */
 #include "myunit.h"
 #include <stdint.h>
+#include <string.h>
 #include "crc16.h"
+#include "ringbuffer.h"
 
 char* text = "Hello World!";
 
+typedef struct {
+    uint16_t (*crc)(const uint8_t *data, size_t size);
+    uint16_t (*init)(void);
+    uint16_t (*update)(uint16_t seed, const uint8_t *data, size_t size);
+    uint16_t (*finalize)(uint16_t seed);
+}crc16_specialized_t;
+
+#define CRC16_SPECIALIZED(name) \
+    {crc16_##name, crc16_##name##_init, crc16_##name##_update, crc16_##name##_finalize}
+
+/* same order as crc16_id_t */
+const crc16_specialized_t crc16_specialized[] = {
+    CRC16_SPECIALIZED(arc),
+    CRC16_SPECIALIZED(cdma2000),
+    CRC16_SPECIALIZED(cms),
+    CRC16_SPECIALIZED(dds_110),
+    CRC16_SPECIALIZED(dect_r),
+    CRC16_SPECIALIZED(dect_x),
+    CRC16_SPECIALIZED(dnp),
+    CRC16_SPECIALIZED(en_13757),
+    CRC16_SPECIALIZED(genibus),
+    CRC16_SPECIALIZED(gsm),
+    CRC16_SPECIALIZED(ibm_3740),
+    CRC16_SPECIALIZED(ibm_sdlc),
+    CRC16_SPECIALIZED(iso_iec_14443_3_a),
+    CRC16_SPECIALIZED(kermit),
+    CRC16_SPECIALIZED(lj1200),
+    CRC16_SPECIALIZED(m17),
+    CRC16_SPECIALIZED(maxim_dow),
+    CRC16_SPECIALIZED(mcrf4xx),
+    CRC16_SPECIALIZED(modbus),
+    CRC16_SPECIALIZED(nrsc_5),
+    CRC16_SPECIALIZED(opensafety_a),
+    CRC16_SPECIALIZED(opensafety_b),
+    CRC16_SPECIALIZED(profibus),
+    CRC16_SPECIALIZED(riello),
+    CRC16_SPECIALIZED(spi_fujitsu),
+    CRC16_SPECIALIZED(t10_dif),
+    CRC16_SPECIALIZED(teledisk),
+    CRC16_SPECIALIZED(tms37157),
+    CRC16_SPECIALIZED(umts),
+    CRC16_SPECIALIZED(usb),
+    CRC16_SPECIALIZED(xmodem),
+};
+
 MYUNIT_TESTCASE(crc16_check_all)
 {
     for (int id = 0; id < crc16_conf_count(); id++)
@@ -45,6 +92,140 @@ MYUNIT_TESTCASE(crc16_check_all)
     }
 }
 
+MYUNIT_TESTCASE(crc16_check_specialized)
+{
+    MYUNIT_ASSERT_EQUAL(sizeof(crc16_specialized)/sizeof(*crc16_specialized), crc16_conf_count());
+
+    for (int id = 0; id < crc16_conf_count(); id++)
+    {
+        const crc16_conf_t *conf = crc16_get_conf(id);
+        const crc16_specialized_t *spec = &crc16_specialized[id];
+        size_t split = strlen(text)/2;
+        uint16_t seed;
+
+        MYUNIT_ASSERT_EQUAL(spec->crc((uint8_t*)text, strlen(text)), conf->result);
+        MYUNIT_ASSERT_EQUAL(spec->init(), conf->init);
+
+        // chunked update, mixing specialized and generic api
+        seed = spec->update(spec->init(), (uint8_t*)text, split);
+        seed = crc16_update(id, seed, (uint8_t*)text+split, strlen(text)-split);
+        MYUNIT_ASSERT_EQUAL(spec->finalize(seed), conf->result);
+    }
+}
+
+MYUNIT_TESTCASE(crc16_combine_all_splits)
+{
+    size_t len = strlen(text);
+
+    for (int id = 0; id < crc16_conf_count(); id++)
+    {
+        const crc16_conf_t *conf = crc16_get_conf(id);
+
+        for (size_t split = 0; split <= len; split++)
+        {
+            uint16_t crc_a = crc16(id, (uint8_t*)text, split);
+            uint16_t crc_b = crc16(id, (uint8_t*)text+split, len-split);
+
+            MYUNIT_ASSERT_EQUAL(crc16_combine(id, crc_a, crc_b, len-split), conf->result);
+        }
+    }
+}
+
+MYUNIT_TESTCASE(crc16_combine_out_of_order)
+{
+    static uint8_t data[3000];
+    uint16_t crc_a, crc_b, crc_c;
+
+    for (size_t idx = 0; idx < sizeof(data); idx++)
+    {
+        data[idx] = (uint8_t)(idx * 131 + (idx >> 7));
+    }
+
+    for (int id = 0; id < crc16_conf_count(); id++)
+    {
+        // compute the chunks in reverse order and merge afterwards
+        crc_c = crc16(id, data+1700, 1300);
+        crc_b = crc16(id, data+1, 1699);
+        crc_a = crc16(id, data, 1);
+
+        MYUNIT_ASSERT_EQUAL(crc16_combine(id, crc16_combine(id, crc_a, crc_b, 1699), crc_c, 1300), crc16(id, data, sizeof(data)));
+    }
+}
+
+#if defined(CRC16_ENABLE_PARALLEL)
+MYUNIT_TESTCASE(crc16_parallel_matches_serial)
+{
+    static uint8_t data[4*CRC16_PARALLEL_MIN_CHUNK+123];
+
+    for (size_t idx = 0; idx < sizeof(data); idx++)
+    {
+        data[idx] = (uint8_t)(idx ^ (idx >> 8) ^ (idx >> 16));
+    }
+
+    for (int id = 0; id < crc16_conf_count(); id++)
+    {
+        uint16_t crc = crc16(id, data, sizeof(data));
+
+        MYUNIT_ASSERT_EQUAL(crc16_parallel(id, data, sizeof(data), 3), crc);
+        MYUNIT_ASSERT_EQUAL(crc16_parallel(id, data, sizeof(data), 0), crc);
+        MYUNIT_ASSERT_EQUAL(crc16_parallel(id, data, CRC16_PARALLEL_MIN_CHUNK, 4), crc16(id, data, CRC16_PARALLEL_MIN_CHUNK));
+    }
+}
+#endif
+
+RINGBUFFER_TYPEDEF(bytering,uint8_t,16);
+
+MYUNIT_TESTCASE(crc16_ringbuffer_in_place)
+{
+    RINGBUFFER_T(bytering) ring;
+    size_t len = 12;
+
+    for (int id = 0; id < crc16_conf_count(); id++)
+    {
+        const crc16_conf_t *conf = crc16_get_conf(id);
+
+        // every head position, the frame wraps around for head > 4
+        for (size_t head = 0; head < RINGBUFFER_SIZE(ring); head++)
+        {
+            RINGBUFFER_INIT(ring);
+            RINGBUFFER_HEAD(ring) = head;
+            RINGBUFFER_TAIL(ring) = head;
+
+            for (size_t idx = 0; idx < len; idx++)
+            {
+                RINGBUFFER_WRITE(ring, (uint8_t)text[idx]);
+            }
+
+            MYUNIT_ASSERT_EQUAL(CRC16_RINGBUFFER(id, ring, RINGBUFFER_COUNT(ring)), conf->result);
+            MYUNIT_ASSERT_EQUAL(crc16_finalize(id, CRC16_UPDATE_RINGBUFFER(id, conf->init, ring, 0)), crc16(id, NULL, 0));
+            MYUNIT_ASSERT_EQUAL(RINGBUFFER_HEAD(ring), head);
+            MYUNIT_ASSERT_EQUAL(RINGBUFFER_COUNT(ring), len);
+        }
+    }
+}
+
+/* offsets past the end wrap around, sizes beyond the ring are clamped */
+MYUNIT_TESTCASE(crc16_update_ring_bounds)
+{
+    uint8_t ring[12];
+    uint8_t rotated[12];
+
+    memcpy(ring, text, sizeof(ring));
+    memcpy(rotated, ring + 3, sizeof(ring) - 3);
+    memcpy(rotated + sizeof(ring) - 3, ring, 3);
+
+    for (int id = 0; id < crc16_conf_count(); id++)
+    {
+        const crc16_conf_t *conf = crc16_get_conf(id);
+        uint16_t expected = crc16_update(id, conf->init, rotated, sizeof(rotated));
+
+        MYUNIT_ASSERT_EQUAL(crc16_update_ring(id, conf->init, ring, sizeof(ring), 3, sizeof(ring)), expected);
+        MYUNIT_ASSERT_EQUAL(crc16_update_ring(id, conf->init, ring, sizeof(ring), sizeof(ring) + 3, sizeof(ring)), expected);
+        MYUNIT_ASSERT_EQUAL(crc16_update_ring(id, conf->init, ring, sizeof(ring), 3, 2 * sizeof(ring)), expected);
+        MYUNIT_ASSERT_EQUAL(crc16_update_ring(id, conf->init, ring, 0, 3, 5), conf->init);
+    }
+}
+
 void myunit_testsuite_setup()
 {
 
@@ -70,6 +251,14 @@ MYUNIT_TESTSUITE(crc16)
     MYUNIT_TESTSUITE_BEGIN();
 
     MYUNIT_EXEC_TESTCASE(crc16_check_all);
+    MYUNIT_EXEC_TESTCASE(crc16_check_specialized);
+    MYUNIT_EXEC_TESTCASE(crc16_combine_all_splits);
+    MYUNIT_EXEC_TESTCASE(crc16_combine_out_of_order);
+    MYUNIT_EXEC_TESTCASE(crc16_ringbuffer_in_place);
+    MYUNIT_EXEC_TESTCASE(crc16_update_ring_bounds);
+#if defined(CRC16_ENABLE_PARALLEL)
+    MYUNIT_EXEC_TESTCASE(crc16_parallel_matches_serial);
+#endif
 
     MYUNIT_TESTSUITE_END();
 }
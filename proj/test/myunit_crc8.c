@@ -0,0 +1,109 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#include "myunit.h"
+#include <stdint.h>
+#include "crc8.h"
+
+char* text = "Hello World!";
+char* check = "123456789";
+
+MYUNIT_TESTCASE(crc8_check_all)
+{
+    for (int id = 0; id < crc8_conf_count(); id++)
+    {
+        uint8_t result = crc8(id, (uint8_t*)text, strlen(text));
+        uint8_t check_result = crc8(id, (uint8_t*)check, strlen(check));
+
+        const crc8_conf_t *conf = crc8_get_conf(id);
+
+        MYUNIT_PRINTF("conf: %s - expected: %02lX computed: %02lX \n", conf->text, (unsigned long)conf->result, (unsigned long)result);
+        MYUNIT_ASSERT_EQUAL(conf->result,result);
+        MYUNIT_ASSERT_EQUAL(conf->check,check_result);
+    }
+}
+
+MYUNIT_TESTCASE(crc8_kernels_match_bitwise)
+{
+    static uint8_t data[1000];
+
+    for (size_t idx = 0; idx < sizeof(data); idx++)
+    {
+        data[idx] = (uint8_t)(idx * 167 + (idx >> 5));
+    }
+
+    for (int id = 0; id < crc8_conf_count(); id++)
+    {
+        const crc8_conf_t *conf = crc8_get_conf(id);
+
+        // odd offsets and lengths exercise unaligned heads and tails of the word kernels
+        for (size_t offset = 0; offset < 9; offset++)
+        {
+            size_t size = sizeof(data) - offset - offset*7;
+            uint8_t bitwise = conf->init;
+            uint8_t bulk = crc8_update(id, conf->init, data+offset, size);
+
+            for (size_t idx = 0; idx < size; idx++)
+            {
+                bitwise = crc8_update_byte(id, bitwise, data[offset+idx]);
+            }
+
+            MYUNIT_ASSERT_EQUAL(bulk, bitwise);
+        }
+    }
+}
+
+void myunit_testsuite_setup()
+{
+
+
+}
+/*!
+    \brief      Cleans up resources after unit test suite execution.
+
+    \details    This function deallocates any memory, releases resources, and performs
+                necessary cleanup tasks that were set up during the initialization of the
+                test suite. It ensures that no residual state is left behind that could
+                affect subsequent tests or system stability.
+*/
+void myunit_testsuite_teardown()
+{
+
+}
+
+
+
+MYUNIT_TESTSUITE(crc8)
+{
+    MYUNIT_TESTSUITE_BEGIN();
+
+    MYUNIT_EXEC_TESTCASE(crc8_check_all);
+    MYUNIT_EXEC_TESTCASE(crc8_kernels_match_bitwise);
+
+    MYUNIT_TESTSUITE_END();
+}
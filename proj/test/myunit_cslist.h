@@ -0,0 +1,66 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#ifndef MYUNIT_CSLIST_H_
+#define MYUNIT_CSLIST_H_
+
+
+#include "cslist.h"
+
+#define myunit_list_type cslist
+
+typedef cslist_t list_t;
+typedef slist_node_t list_node_t;
+
+#define list_next(list,node)                cslist_next(list,node)
+#define list_prev(list,node)                cslist_prev(list,node)
+#define list_prev_prev(list,node)           cslist_prev_prev(list,node)
+#define list_init(list)                     cslist_init(list)
+#define list_begin(list)                    cslist_begin(list)
+#define list_front(list)                    cslist_front(list)
+#define list_end(list)                      cslist_end(list)
+#define list_back(list)                     cslist_back(list)
+#define list_foreach(list,it)               cslist_foreach(list,it)
+#define list_foreach_prev(list,prev,it)     cslist_foreach_prev(list,prev,it)
+#define list_empty(list)                    cslist_empty(list)
+#define list_push_front(list,node)          cslist_push_front(list,node)
+#define list_pop_front(list)                cslist_pop_front(list)
+#define list_push_back(list,node)           cslist_push_back(list,node)
+#define list_pop_back(list)                 cslist_pop_back(list)
+#define list_insert_after(list,pos,node)    cslist_insert_after(list,pos,node)
+#define list_insert_before(list,pos,node)   cslist_insert_before(list,pos,node)
+#define list_erase(list,node)               cslist_erase(list,node)
+#define list_erase_safe(list,node)          cslist_erase_safe(list,node)
+#define list_node_init(node)                slist_node_init(node)
+#define list_node_is_linked(node)           slist_node_is_linked(node)
+#define list_erase_after(list,pos)          cslist_erase_after(list,pos)
+#define list_size(list)                     cslist_size(list)
+#define list_find(list,node)                cslist_find(list,node)
+
+
+#endif /* MYUNIT_CSLIST_H_ */
@@ -54,8 +54,17 @@ typedef dlist_node_t list_node_t;
 #define list_insert_after(list,pos,node)    dlist_insert_after(list,pos,node)
 #define list_insert_before(list,pos,node)   dlist_insert_before(list,pos,node)
 #define list_erase(list,node)               dlist_erase(list,node)
+#define list_erase_safe(list,node)          dlist_erase_safe(list,node)
+#define list_erase_if_linked(list,node)     dlist_erase_if_linked(list,node)
+#define list_node_init(node)                dlist_node_init(node)
+#define list_node_is_linked(node)           dlist_node_is_linked(node)
 #define list_size(list)                     dlist_size(list)
 #define list_find(list,node)                dlist_find(list,node)
+#define list_splice_back(list,other)        dlist_splice(list,dlist_end(list),other)
+#define list_cut(list,node,other)           dlist_cut(list,node,other)
+#define list_sort(list,cmp)                 dlist_sort(list,cmp)
+#define list_insert_sorted(list,node,cmp)   dlist_insert_sorted(list,node,cmp)
+#define list_merge(list,other,cmp)          dlist_merge(list,other,cmp)
 
 
 #endif /* MYUNIT_DLIST_H_ */
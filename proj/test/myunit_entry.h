@@ -0,0 +1,66 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#ifndef MYUNIT_ENTRY_H_
+#define MYUNIT_ENTRY_H_
+
+/*
+    Test entries shared by the intrusive container tests. Before including,
+    typedef the container node as entry_node_t and define ENTRY_COUNT.
+*/
+
+#include <stdint.h>
+#include "itempool.h"
+#include "utils.h"
+
+typedef struct {
+    entry_node_t node;
+    uint16_t key;
+    uint16_t seq;       /* insertion order, tells equal keys apart */
+} entry_t;
+
+ITEMPOOL_TYPEDEF(entries,entry_t,ENTRY_COUNT);
+
+ITEMPOOL_T(entries) entries;
+
+static entry_t* entry_new(uint16_t key, uint16_t seq)
+{
+    entry_t *entry = ITEMPOOL_ALLOC(entries);
+    entry->key = key;
+    entry->seq = seq;
+    return entry;
+}
+
+#define entry_key(entrynode) \
+    (container_of(entrynode, entry_t, node)->key)
+
+#define entry_order(a,b) \
+    ((a) < (b) ? -1 : (a) > (b))
+
+
+#endif /* MYUNIT_ENTRY_H_ */
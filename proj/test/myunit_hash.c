@@ -40,6 +40,218 @@ MYUNIT_TESTCASE(sdbm)
     MYUNIT_ASSERT_EQUAL(hash_sdbm(0,(uint8_t*)text,strlen(text)),sdbm_result);
 }
 
+MYUNIT_TESTCASE(sdbm_matches_bytewise)
+{
+    uint8_t data[80];
+    uint32_t seeds[] = {0, 1, 0xDEADBEEF};
+
+    for (size_t idx = 0; idx < sizeof(data); idx++)
+    {
+        data[idx] = (uint8_t)(idx * 251 + 7);
+    }
+
+    for (size_t seed = 0; seed < sizeof(seeds)/sizeof(*seeds); seed++)
+    {
+        for (size_t offset = 0; offset < 8; offset++)
+        {
+            for (size_t size = 0; size + offset <= sizeof(data); size++)
+            {
+                uint32_t expected = seeds[seed];
+
+                for (size_t idx = 0; idx < size; idx++)
+                {
+                    expected = hash_sdbm_acc(expected, data[offset+idx]);
+                }
+
+                MYUNIT_ASSERT_EQUAL(hash_sdbm(seeds[seed], data+offset, size), expected);
+            }
+        }
+    }
+}
+
+typedef struct {
+    const char *text;
+    uint32_t fnv1a;
+    uint32_t murmur3;
+    uint32_t murmur3_seeded;
+    uint32_t xxh32;
+    uint32_t xxh32_seeded;
+    uint64_t xxh64;
+    uint64_t xxh64_seeded;
+} hash_vector_t;
+
+#define FOX "The quick brown fox jumps over the lazy dog"
+
+/* murmur3 seeded with 0x9747B28C, xxh32 with 0x9E3779B1, xxh64 with 0x9E3779B185EBCA87 */
+const hash_vector_t hash_vectors[] = {
+    {"",             0x811C9DC5, 0x00000000, 0xEBB6C228, 0x02CC5D05, 0x36B78AE7, 0xEF46DB3751D8E999ULL, 0x6EC6D05F61C7E7A7ULL},
+    {"a",            0xE40C292C, 0x3C2569B2, 0x7FA09EA6, 0x550D7456, 0x9E1633E4, 0xD24EC4F1A98C6E5BULL, 0x727C10E0D238E188ULL},
+    {"abc",          0x1A47E90B, 0xB3DD93FA, 0xC84A62DD, 0x32D153FF, 0xA1AE7709, 0x44BC2CF5AD770999ULL, 0xA7CB2AAC405E36C7ULL},
+    {"Hello World!", 0xB1EA4872, 0xDC09357D, 0xFB86EA72, 0x0BD69788, 0x5209308A, 0xA52B286A3E7F4D91ULL, 0xDF9A4B77C0EF34F3ULL},
+    {FOX,            0x048FFF90, 0x2E4FF723, 0x2FA826CD, 0xE85EA4DE, 0x98C7F3BF, 0x0B242D361FDA71BCULL, 0xB8A8089ADD7E03D9ULL},
+    {FOX FOX FOX,    0xDFD12786, 0xC65A1BA1, 0x9B514FDB, 0x903B2D5E, 0x633AC121, 0xC652B4DBFCD6B853ULL, 0x7B60F0A30557CA01ULL},
+};
+
+#define HASH_VECTOR_COUNT (sizeof(hash_vectors)/sizeof(*hash_vectors))
+
+MYUNIT_TESTCASE(fnv1a)
+{
+    /* standard FNV-1a test vector */
+    MYUNIT_ASSERT_EQUAL(hash_fnv1a(HASH_FNV1A_INIT,"foobar",6),0xBF9CF968);
+
+    for (size_t idx = 0; idx < HASH_VECTOR_COUNT; idx++)
+    {
+        const char *text = hash_vectors[idx].text;
+        MYUNIT_ASSERT_EQUAL(hash_fnv1a(HASH_FNV1A_INIT,(void*)text,strlen(text)),hash_vectors[idx].fnv1a);
+    }
+}
+
+MYUNIT_TESTCASE(murmur3)
+{
+    for (size_t idx = 0; idx < HASH_VECTOR_COUNT; idx++)
+    {
+        const char *text = hash_vectors[idx].text;
+        MYUNIT_ASSERT_EQUAL(hash_murmur3(0,(void*)text,strlen(text)),hash_vectors[idx].murmur3);
+        MYUNIT_ASSERT_EQUAL(hash_murmur3(0x9747B28C,(void*)text,strlen(text)),hash_vectors[idx].murmur3_seeded);
+    }
+}
+
+MYUNIT_TESTCASE(xxh32)
+{
+    for (size_t idx = 0; idx < HASH_VECTOR_COUNT; idx++)
+    {
+        const char *text = hash_vectors[idx].text;
+        MYUNIT_ASSERT_EQUAL(hash_xxh32(0,(void*)text,strlen(text)),hash_vectors[idx].xxh32);
+        MYUNIT_ASSERT_EQUAL(hash_xxh32(0x9E3779B1,(void*)text,strlen(text)),hash_vectors[idx].xxh32_seeded);
+    }
+}
+
+MYUNIT_TESTCASE(xxh64)
+{
+    for (size_t idx = 0; idx < HASH_VECTOR_COUNT; idx++)
+    {
+        const char *text = hash_vectors[idx].text;
+        MYUNIT_ASSERT_EQUAL(hash_xxh64(0,(void*)text,strlen(text)),hash_vectors[idx].xxh64);
+        MYUNIT_ASSERT_EQUAL(hash_xxh64(0x9E3779B185EBCA87ULL,(void*)text,strlen(text)),hash_vectors[idx].xxh64_seeded);
+    }
+}
+
+/*
+    Feeds data[0..size) in pieces of `chunk` bytes, the first piece is
+    `first` bytes long, and compares against the one-shot function.
+*/
+#define HASH_STREAM_CHECK(name, seed, data, size, first, chunk) \
+    do { \
+        hash_##name##_ctx_t ctx; \
+        size_t pos = (first) < (size) ? (first) : (size); \
+        hash_##name##_init(&ctx, seed); \
+        hash_##name##_update(&ctx, data, pos); \
+        while (pos < (size)) { \
+            size_t piece = (size) - pos < (chunk) ? (size) - pos : (chunk); \
+            hash_##name##_update(&ctx, (data) + pos, piece); \
+            pos += piece; \
+        } \
+        MYUNIT_ASSERT_EQUAL(hash_##name##_final(&ctx), hash_##name(seed, data, size)); \
+    } while(0)
+
+MYUNIT_TESTCASE(streaming_matches_oneshot)
+{
+    uint8_t data[100];
+
+    for (size_t idx = 0; idx < sizeof(data); idx++)
+    {
+        data[idx] = (uint8_t)(idx * 167 + 13);
+    }
+
+    for (size_t size = 0; size <= sizeof(data); size++)
+    {
+        for (size_t first = 0; first <= 40; first++)
+        {
+            for (size_t chunk = 1; chunk <= 40; chunk += 3)
+            {
+                HASH_STREAM_CHECK(sdbm, 0x12345678, data, size, first, chunk);
+                HASH_STREAM_CHECK(fnv1a, HASH_FNV1A_INIT, data, size, first, chunk);
+                HASH_STREAM_CHECK(murmur3, 0x9747B28C, data, size, first, chunk);
+                HASH_STREAM_CHECK(xxh32, 0x9E3779B1, data, size, first, chunk);
+                HASH_STREAM_CHECK(xxh64, 0x9E3779B185EBCA87ULL, data, size, first, chunk);
+            }
+        }
+    }
+}
+
+MYUNIT_TESTCASE(streaming_final_keeps_context)
+{
+    hash_xxh32_ctx_t ctx;
+
+    hash_xxh32_init(&ctx, 0);
+    hash_xxh32_update(&ctx, "Hello ", 6);
+    MYUNIT_ASSERT_EQUAL(hash_xxh32_final(&ctx), hash_xxh32(0, "Hello ", 6));
+    hash_xxh32_update(&ctx, "World!", 6);
+    MYUNIT_ASSERT_EQUAL(hash_xxh32_final(&ctx), 0x0BD69788);
+}
+
+#define LONGEST "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef"
+
+static const uint32_t compile_time_sdbm[] = {
+    HASH_SDBM_LITERAL(0, ""),
+    HASH_SDBM_LITERAL(0, "Hello World!"),
+    HASH_SDBM_LITERAL(0x12345678, "\xFF\x80 signed chars"),
+    HASH_SDBM_LITERAL(0, LONGEST),
+};
+
+static const uint32_t compile_time_fnv1a[] = {
+    HASH_FNV1A_LITERAL(HASH_FNV1A_INIT, ""),
+    HASH_FNV1A_LITERAL(HASH_FNV1A_INIT, "Hello World!"),
+    HASH_FNV1A_LITERAL(0x12345678, "\xFF\x80 signed chars"),
+    HASH_FNV1A_LITERAL(HASH_FNV1A_INIT, LONGEST),
+};
+
+static const char *compile_time_text[] = {"", "Hello World!", "\xFF\x80 signed chars", LONGEST};
+static const uint32_t compile_time_seed[] = {0, 0, 0x12345678, 0};
+
+MYUNIT_TESTCASE(compile_time_literal)
+{
+    for (size_t idx = 0; idx < sizeof(compile_time_text)/sizeof(*compile_time_text); idx++)
+    {
+        void *text = (void*)compile_time_text[idx];
+        size_t size = strlen(compile_time_text[idx]);
+        uint32_t fnv1a_seed = compile_time_seed[idx] ? compile_time_seed[idx] : HASH_FNV1A_INIT;
+
+        MYUNIT_ASSERT_EQUAL(compile_time_sdbm[idx], hash_sdbm(compile_time_seed[idx], text, size));
+        MYUNIT_ASSERT_EQUAL(compile_time_fnv1a[idx], hash_fnv1a(fnv1a_seed, text, size));
+    }
+}
+
+static int compile_time_dispatch(const char *name)
+{
+    switch (hash_sdbm(0, (void*)name, strlen(name)))
+    {
+        case HASH_SDBM_CHARS(0, 't','e','m','p'): return 1;
+        case HASH_SDBM_CHARS(0, 'h','u','m'): return 2;
+        case HASH_SDBM_CHARS(0, '0','1','2','3','4','5','6','7','8','9','a','b','c','d','e','f',
+                                '0','1','2','3','4','5','6','7','8','9','a','b','c','d','e','f'): return 3;
+    }
+
+    switch (hash_fnv1a(HASH_FNV1A_INIT, (void*)name, strlen(name)))
+    {
+        case HASH_FNV1A_CHARS(HASH_FNV1A_INIT, 'p','r','e','s','s'): return 4;
+        case HASH_FNV1A_CHARS(HASH_FNV1A_INIT, '\xFF'): return 5;
+    }
+
+    return 0;
+}
+
+MYUNIT_TESTCASE(compile_time_chars)
+{
+    MYUNIT_ASSERT_EQUAL(compile_time_dispatch("temp"), 1);
+    MYUNIT_ASSERT_EQUAL(compile_time_dispatch("hum"), 2);
+    MYUNIT_ASSERT_EQUAL(compile_time_dispatch("0123456789abcdef0123456789abcdef"), 3);
+    MYUNIT_ASSERT_EQUAL(compile_time_dispatch("press"), 4);
+    MYUNIT_ASSERT_EQUAL(compile_time_dispatch("\xFF"), 5);
+    MYUNIT_ASSERT_EQUAL(compile_time_dispatch("wind"), 0);
+    MYUNIT_ASSERT_EQUAL(HASH_SDBM_CHARS(0, 'H','e','l','l','o',' ','W','o','r','l','d','!'), HASH_SDBM_LITERAL(0, "Hello World!"));
+}
+
 void myunit_testsuite_setup()
 {
 
@@ -65,6 +277,15 @@ MYUNIT_TESTSUITE(hash)
     MYUNIT_TESTSUITE_BEGIN();
 
     MYUNIT_EXEC_TESTCASE(sdbm);
+    MYUNIT_EXEC_TESTCASE(sdbm_matches_bytewise);
+    MYUNIT_EXEC_TESTCASE(fnv1a);
+    MYUNIT_EXEC_TESTCASE(murmur3);
+    MYUNIT_EXEC_TESTCASE(xxh32);
+    MYUNIT_EXEC_TESTCASE(xxh64);
+    MYUNIT_EXEC_TESTCASE(streaming_matches_oneshot);
+    MYUNIT_EXEC_TESTCASE(streaming_final_keeps_context);
+    MYUNIT_EXEC_TESTCASE(compile_time_literal);
+    MYUNIT_EXEC_TESTCASE(compile_time_chars);
 
     MYUNIT_TESTSUITE_END();
 }
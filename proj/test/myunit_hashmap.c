@@ -0,0 +1,249 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#include "myunit.h"
+#include <stdint.h>
+#include "hashmap.h"
+#include "itempool.h"
+#include "hash.h"
+
+typedef struct {
+    hashmap_node_t node;
+    uint16_t id;
+    int value;
+} entry_t;
+
+#define ENTRY_COUNT 200
+
+ITEMPOOL_TYPEDEF(entries,entry_t,ENTRY_COUNT);
+HASHMAP_TYPEDEF(pow2,64);
+HASHMAP_TYPEDEF(prime,61);
+HASHMAP_TYPEDEF(single,1);
+
+ITEMPOOL_T(entries) entries;
+
+static uint32_t entry_hash(const void *key)
+{
+    return hash_murmur3(0, (void*)key, sizeof(uint16_t));
+}
+
+/* all keys collide, exercises the chains */
+static uint32_t entry_hash_constant(const void *key)
+{
+    (void)key;
+    return 0x1234;
+}
+
+static bool entry_equal(const hashmap_node_t *node, const void *key)
+{
+    return container_of(node, entry_t, node)->id == *(const uint16_t*)key;
+}
+
+static entry_t* entry_new(uint16_t id)
+{
+    entry_t *entry = ITEMPOOL_ALLOC(entries);
+    entry->id = id;
+    entry->value = id * 3;
+    return entry;
+}
+
+/* inserts ENTRY_COUNT entries, finds them all, erases every other one and checks the rest */
+static void hashmap_exercise(hashmap_t *map)
+{
+    uint16_t id;
+    hashmap_node_t *iterator;
+    size_t visited = 0;
+
+    ITEMPOOL_INIT(entries);
+
+    MYUNIT_ASSERT_TRUE(hashmap_empty(map));
+    MYUNIT_ASSERT_IS_NULL(hashmap_first(map));
+
+    for (id = 0; id < ENTRY_COUNT; id++)
+    {
+        entry_t *entry = entry_new((uint16_t)(id * 7));
+        MYUNIT_ASSERT_EQUAL(hashmap_insert(map, &entry->node, &entry->id), &entry->node);
+    }
+
+    MYUNIT_ASSERT_EQUAL(hashmap_size(map), ENTRY_COUNT);
+
+    for (id = 0; id < ENTRY_COUNT * 7; id++)
+    {
+        hashmap_node_t *node = hashmap_find(map, &id);
+
+        if (id % 7)
+        {
+            MYUNIT_ASSERT_IS_NULL(node);
+        }
+        else
+        {
+            MYUNIT_ASSERT_NOT_NULL(node);
+            MYUNIT_ASSERT_EQUAL(container_of(node, entry_t, node)->value, id * 3);
+        }
+    }
+
+    hashmap_foreach(map, iterator)
+    {
+        MYUNIT_ASSERT_EQUAL(container_of(iterator, entry_t, node)->id % 7, 0);
+        visited++;
+    }
+
+    MYUNIT_ASSERT_EQUAL(visited, ENTRY_COUNT);
+
+    for (id = 0; id < ENTRY_COUNT; id += 2)
+    {
+        uint16_t key = (uint16_t)(id * 7);
+        hashmap_node_t *node = hashmap_find(map, &key);
+
+        if (id % 4)
+        {
+            hashmap_erase(map, node);
+        }
+        else
+        {
+            MYUNIT_ASSERT_EQUAL(hashmap_remove(map, &key), node);
+        }
+
+        MYUNIT_ASSERT_IS_NULL(hashmap_find(map, &key));
+        MYUNIT_ASSERT_IS_NULL(hashmap_remove(map, &key));
+    }
+
+    MYUNIT_ASSERT_EQUAL(hashmap_size(map), ENTRY_COUNT / 2);
+
+    for (id = 1; id < ENTRY_COUNT; id += 2)
+    {
+        uint16_t key = (uint16_t)(id * 7);
+        MYUNIT_ASSERT_NOT_NULL(hashmap_find(map, &key));
+    }
+
+    hashmap_clear(map);
+    MYUNIT_ASSERT_TRUE(hashmap_empty(map));
+    MYUNIT_ASSERT_IS_NULL(hashmap_first(map));
+}
+
+MYUNIT_TESTCASE(hashmap_pow2_buckets)
+{
+    HASHMAP_T(pow2) map;
+
+    HASHMAP_INIT(map, entry_hash, entry_equal);
+    MYUNIT_ASSERT_EQUAL(HASHMAP_SIZE(map), 64);
+    hashmap_exercise(HASHMAP(map));
+}
+
+MYUNIT_TESTCASE(hashmap_prime_buckets)
+{
+    HASHMAP_T(prime) map;
+
+    HASHMAP_INIT(map, entry_hash, entry_equal);
+    MYUNIT_ASSERT_EQUAL(HASHMAP_SIZE(map), 61);
+    hashmap_exercise(HASHMAP(map));
+}
+
+MYUNIT_TESTCASE(hashmap_colliding_hashes)
+{
+    HASHMAP_T(prime) map;
+
+    HASHMAP_INIT(map, entry_hash_constant, entry_equal);
+    hashmap_exercise(HASHMAP(map));
+}
+
+MYUNIT_TESTCASE(hashmap_single_bucket)
+{
+    HASHMAP_T(single) map;
+
+    HASHMAP_INIT(map, entry_hash, entry_equal);
+    hashmap_exercise(HASHMAP(map));
+}
+
+MYUNIT_TESTCASE(hashmap_insert_rejects_duplicate_key)
+{
+    HASHMAP_T(pow2) map;
+    entry_t *first;
+    entry_t *second;
+
+    ITEMPOOL_INIT(entries);
+    HASHMAP_INIT(map, entry_hash, entry_equal);
+
+    first = entry_new(42);
+    second = entry_new(42);
+
+    MYUNIT_ASSERT_EQUAL(hashmap_insert(HASHMAP(map), &first->node, &first->id), &first->node);
+    MYUNIT_ASSERT_EQUAL(hashmap_insert(HASHMAP(map), &second->node, &second->id), &first->node);
+    MYUNIT_ASSERT_EQUAL(hashmap_size(HASHMAP(map)), 1);
+}
+
+MYUNIT_TESTCASE(hashmap_erase_during_foreach)
+{
+    HASHMAP_T(prime) map;
+    hashmap_node_t *iterator;
+    uint16_t id;
+
+    ITEMPOOL_INIT(entries);
+    HASHMAP_INIT(map, entry_hash, entry_equal);
+
+    for (id = 0; id < 10; id++)
+    {
+        entry_t *entry = entry_new(id);
+        hashmap_insert(HASHMAP(map), &entry->node, &entry->id);
+    }
+
+    while (!hashmap_empty(HASHMAP(map)))
+    {
+        hashmap_foreach(HASHMAP(map), iterator)
+        {
+            hashmap_erase(HASHMAP(map), iterator);
+            break;
+        }
+    }
+
+    MYUNIT_ASSERT_IS_NULL(hashmap_first(HASHMAP(map)));
+}
+
+void myunit_testsuite_setup()
+{
+
+}
+
+void myunit_testsuite_teardown()
+{
+
+}
+
+MYUNIT_TESTSUITE(hashmap)
+{
+    MYUNIT_TESTSUITE_BEGIN();
+
+    MYUNIT_EXEC_TESTCASE(hashmap_pow2_buckets);
+    MYUNIT_EXEC_TESTCASE(hashmap_prime_buckets);
+    MYUNIT_EXEC_TESTCASE(hashmap_colliding_hashes);
+    MYUNIT_EXEC_TESTCASE(hashmap_single_bucket);
+    MYUNIT_EXEC_TESTCASE(hashmap_insert_rejects_duplicate_key);
+    MYUNIT_EXEC_TESTCASE(hashmap_erase_during_foreach);
+
+    MYUNIT_TESTSUITE_END();
+}
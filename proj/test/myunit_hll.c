@@ -0,0 +1,189 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#include "myunit.h"
+#include <stdint.h>
+#include <string.h>
+#include "hll.h"
+
+HLL_TYPEDEF(tiny,HLL_PRECISION_MIN);
+HLL_TYPEDEF(small,8);
+HLL_TYPEDEF(large,12);
+
+HLL_T(tiny) tiny;
+HLL_T(small) small;
+HLL_T(large) large;
+HLL_T(large) other;
+
+static void add_range(hll_t *hll, uint32_t first, uint32_t last)
+{
+    uint32_t key;
+
+    for (key = first; key < last; key++)
+    {
+        hll_add(hll, &key, sizeof(key));
+    }
+}
+
+/* true if estimate is within percent of expected */
+static bool close_to(uint32_t estimate, uint32_t expected, uint32_t percent)
+{
+    uint32_t delta = estimate > expected ? estimate - expected : expected - estimate;
+
+    return delta <= expected / 100 * percent + 1;
+}
+
+MYUNIT_TESTCASE(hll_empty)
+{
+    HLL_INIT(tiny);
+    HLL_INIT(large);
+
+    MYUNIT_ASSERT_EQUAL(HLL(tiny)->precision, HLL_PRECISION_MIN);
+    MYUNIT_ASSERT_EQUAL(HLL(large)->precision, 12);
+    MYUNIT_ASSERT_EQUAL(hll_count(HLL(tiny)), 0);
+    MYUNIT_ASSERT_EQUAL(hll_count(HLL(large)), 0);
+}
+
+MYUNIT_TESTCASE(hll_small_counts_are_exact)
+{
+    HLL_INIT(large);
+
+    add_range(HLL(large), 0, 1);
+    MYUNIT_ASSERT_EQUAL(hll_count(HLL(large)), 1);
+
+    add_range(HLL(large), 1, 20);
+    MYUNIT_ASSERT_EQUAL(hll_count(HLL(large)), 20);
+}
+
+MYUNIT_TESTCASE(hll_duplicates_do_not_count)
+{
+    uint32_t estimate;
+
+    HLL_INIT(small);
+    add_range(HLL(small), 0, 1000);
+    estimate = hll_count(HLL(small));
+
+    add_range(HLL(small), 0, 1000);
+    add_range(HLL(small), 500, 1000);
+    MYUNIT_ASSERT_EQUAL(hll_count(HLL(small)), estimate);
+
+    hll_add(HLL(small), &estimate, sizeof(estimate));
+    MYUNIT_ASSERT_FALSE(hll_add(HLL(small), &estimate, sizeof(estimate)));
+}
+
+/* standard errors are 6.5% for p = 8 and 1.6% for p = 12, allow about 3 sigma */
+MYUNIT_TESTCASE(hll_accuracy)
+{
+    static const uint32_t counts[] = {100, 1000, 10000, 100000, 1000000};
+    uint32_t last = 0;
+    uint8_t idx;
+
+    HLL_INIT(small);
+    HLL_INIT(large);
+
+    for (idx = 0; idx < sizeof(counts)/sizeof(*counts); idx++)
+    {
+        add_range(HLL(small), last, counts[idx]);
+        add_range(HLL(large), last, counts[idx]);
+        last = counts[idx];
+
+        MYUNIT_ASSERT_TRUE(close_to(hll_count(HLL(small)), last, 20));
+        MYUNIT_ASSERT_TRUE(close_to(hll_count(HLL(large)), last, 6));
+    }
+}
+
+MYUNIT_TESTCASE(hll_merge)
+{
+    HLL_INIT(large);
+    HLL_INIT(other);
+    HLL_INIT(small);
+
+    add_range(HLL(large), 0, 30000);
+    add_range(HLL(other), 20000, 50000);
+
+    MYUNIT_ASSERT_FALSE(hll_merge(HLL(large), HLL(small)));
+    MYUNIT_ASSERT_TRUE(hll_merge(HLL(large), HLL(other)));
+    MYUNIT_ASSERT_TRUE(close_to(hll_count(HLL(large)), 50000, 6));
+
+    /* merging equals adding all keys to one sketch */
+    HLL_INIT(other);
+    add_range(HLL(other), 0, 50000);
+    MYUNIT_ASSERT_MEM_EQUAL(HLL(large)->registers, HLL(other)->registers, sizeof(large.registers));
+}
+
+MYUNIT_TESTCASE(hll_clear)
+{
+    HLL_INIT(small);
+    add_range(HLL(small), 0, 1000);
+    hll_clear(HLL(small));
+
+    MYUNIT_ASSERT_EQUAL(hll_count(HLL(small)), 0);
+}
+
+MYUNIT_TESTCASE(hll_add_hash)
+{
+    HLL_INIT(tiny);
+
+    /* register 0, 28 zero bits after the index */
+    MYUNIT_ASSERT_TRUE(hll_add_hash(HLL(tiny), 0x00000008UL));
+    MYUNIT_ASSERT_EQUAL(tiny.registers[0], 25);
+    MYUNIT_ASSERT_FALSE(hll_add_hash(HLL(tiny), 0x00000008UL));
+
+    /* register 15, no remaining bit set */
+    MYUNIT_ASSERT_TRUE(hll_add_hash(HLL(tiny), 0xF0000000UL));
+    MYUNIT_ASSERT_EQUAL(tiny.registers[15], 29);
+
+    /* register 1, leading one right after the index */
+    MYUNIT_ASSERT_TRUE(hll_add_hash(HLL(tiny), 0x18000000UL));
+    MYUNIT_ASSERT_EQUAL(tiny.registers[1], 1);
+}
+
+void myunit_testsuite_setup()
+{
+
+}
+
+void myunit_testsuite_teardown()
+{
+
+}
+
+MYUNIT_TESTSUITE(hll)
+{
+    MYUNIT_TESTSUITE_BEGIN();
+
+    MYUNIT_EXEC_TESTCASE(hll_empty);
+    MYUNIT_EXEC_TESTCASE(hll_small_counts_are_exact);
+    MYUNIT_EXEC_TESTCASE(hll_duplicates_do_not_count);
+    MYUNIT_EXEC_TESTCASE(hll_accuracy);
+    MYUNIT_EXEC_TESTCASE(hll_merge);
+    MYUNIT_EXEC_TESTCASE(hll_clear);
+    MYUNIT_EXEC_TESTCASE(hll_add_hash);
+
+    MYUNIT_TESTSUITE_END();
+}
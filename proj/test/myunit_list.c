@@ -58,6 +58,16 @@
      - insert_after: Tests inserting a new node after a specified node.
      - insert_before: Tests inserting a new node before a specified node.
      - erase: Tests deleting a node from the list.
+     - back_follows_updates: Tests that the back of the list is correct after every kind of update.
+     - erase_after: Tests removing the successor of a node (singly linked lists).
+     - foreach_prev_filter: Tests removing nodes while iterating with the predecessor (singly linked lists).
+     - node_is_linked: Tests the O(1) membership check of nodes removed with the safe erase.
+     - erase_if_linked: Tests that removing an unlinked node again is harmless (doubly linked lists).
+     - splice_cut: Tests moving whole lists and splitting lists.
+     - splice_range: Tests moving ranges of nodes between and within lists.
+     - sort: Tests the stable in place merge sort.
+     - insert_sorted: Tests building a sorted list by sorted insertion.
+     - merge: Tests merging two sorted lists.
      - find_empty_list: Tests searching for a node in an empty list.
      - find_node_present: Tests searching for a node that exists in the list.
      - find_node_not_present: Tests searching for a node that does not exist in the list.
@@ -74,11 +84,20 @@
 
 #define UNITTEST_LIST_TYPE_SLIST 0
 #define UNITTEST_LIST_TYPE_DLIST 1
+#define UNITTEST_LIST_TYPE_TSLIST 2
+#define UNITTEST_LIST_TYPE_CSLIST 3
+#define UNITTEST_LIST_TYPE_CDLIST 4
 
 #if ( UNITTEST_LIST_TYPE == UNITTEST_LIST_TYPE_SLIST )
     #include"myunit_slist.h"
 #elif ( UNITTEST_LIST_TYPE == UNITTEST_LIST_TYPE_DLIST )
     #include"myunit_dlist.h"
+#elif ( UNITTEST_LIST_TYPE == UNITTEST_LIST_TYPE_TSLIST )
+    #include"myunit_tslist.h"
+#elif ( UNITTEST_LIST_TYPE == UNITTEST_LIST_TYPE_CSLIST )
+    #include"myunit_cslist.h"
+#elif ( UNITTEST_LIST_TYPE == UNITTEST_LIST_TYPE_CDLIST )
+    #include"myunit_cdlist.h"
 #else
     #error "Unknown list type"
 #endif
@@ -333,7 +352,7 @@ MYUNIT_TESTCASE(next_prev_stepbystep)
   // PRECONDITIONS :
     // -------------------------------------------------
     list_t list;
-    list_node_t *iterator = &list;
+    list_node_t *iterator = list_end(&list);
     test_fixture_setup(FIXTURE_NORMAL, &list);
 
 
@@ -341,7 +360,7 @@ MYUNIT_TESTCASE(next_prev_stepbystep)
     // -------------------------------------------------
 
   // Forward iteration using dlist_next
-  MYUNIT_ASSERT_EQUAL(iterator, &list);
+  MYUNIT_ASSERT_EQUAL(iterator, list_end(&list));
   iterator = list_next(&list, iterator);
   MYUNIT_ASSERT_TRUE(mynode_check(iterator, NODE0));
   iterator = list_next(&list, iterator);
@@ -349,10 +368,10 @@ MYUNIT_TESTCASE(next_prev_stepbystep)
   iterator = list_next(&list, iterator);
   MYUNIT_ASSERT_TRUE(mynode_check(iterator, NODE2));
   iterator = list_next(&list, iterator);
-  MYUNIT_ASSERT_EQUAL(iterator, &list);
+  MYUNIT_ASSERT_EQUAL(iterator, list_end(&list));
 
   // Reverse iteration using dlist_prev
-  MYUNIT_ASSERT_EQUAL(iterator, &list);
+  MYUNIT_ASSERT_EQUAL(iterator, list_end(&list));
   iterator = list_prev(&list, iterator);
   MYUNIT_ASSERT_TRUE(mynode_check(iterator, NODE2));
   iterator = list_prev(&list, iterator);
@@ -360,12 +379,12 @@ MYUNIT_TESTCASE(next_prev_stepbystep)
   iterator = list_prev(&list, iterator);
   MYUNIT_ASSERT_TRUE(mynode_check(iterator, NODE0));
   iterator = list_prev(&list, iterator);
-  MYUNIT_ASSERT_EQUAL(iterator, &list);
+  MYUNIT_ASSERT_EQUAL(iterator, list_end(&list));
 
 
   // POSTCONDITIONS :
   // -------------------------------------------------
-  MYUNIT_ASSERT_EQUAL(iterator, &list);
+  MYUNIT_ASSERT_EQUAL(iterator, list_end(&list));
 }
 
 
@@ -388,7 +407,7 @@ MYUNIT_TESTCASE(prev_prev_empty) {
     result = list_prev_prev(&list, &list);
 
    // POSTCONDITIONS:
-   MYUNIT_ASSERT_EQUAL(result, &list);
+   MYUNIT_ASSERT_EQUAL(result, list_end(&list));
 }
 
 /*!
@@ -463,7 +482,7 @@ MYUNIT_TESTCASE(initial_check_of_all_nodes)
         MYUNIT_ASSERT_EQUAL(mynode_check(&mynodes[idx].node,idx), true);
         MYUNIT_ASSERT_EQUAL(mynodes[idx].node.next, 0);
 
-#if ( UNITTEST_LIST_TYPE == UNITTEST_LIST_TYPE_DLIST )
+#if ( UNITTEST_LIST_TYPE == UNITTEST_LIST_TYPE_DLIST ) || ( UNITTEST_LIST_TYPE == UNITTEST_LIST_TYPE_CDLIST )
         MYUNIT_ASSERT_EQUAL(mynodes[idx].node.prev, 0);
 #endif
 
@@ -899,6 +918,488 @@ MYUNIT_TESTCASE(erase)
 }
 
 
+#if defined(list_erase_after)
+
+/*!
+  \brief   Tests removing the successor of a node.
+
+  \details Removes the first node via the list control node and the last node
+           via its predecessor, and checks the remaining list and its back.
+*/
+MYUNIT_TESTCASE(erase_after)
+{
+   list_t list;
+   test_fixture_setup(FIXTURE_NORMAL, &list);
+
+   list_erase_after(&list,list_end(&list));
+   MYUNIT_ASSERT_EQUAL(list_size(&list), 2);
+   MYUNIT_ASSERT_TRUE(mynode_check(list_front(&list), NODE1));
+
+   list_erase_after(&list,&mynodes[NODE1].node);
+   MYUNIT_ASSERT_EQUAL(list_size(&list), 1);
+   MYUNIT_ASSERT_TRUE(mynode_check(list_back(&list), NODE1));
+   MYUNIT_ASSERT_EQUAL(list_next(&list,&mynodes[NODE1].node), list_end(&list));
+
+   list_erase_after(&list,list_end(&list));
+   MYUNIT_ASSERT_TRUE(list_empty(&list));
+   MYUNIT_ASSERT_EQUAL(list_back(&list), list_end(&list));
+}
+
+/*!
+  \brief   Tests filtering a list in a single pass.
+
+  \details Iterates with `list_foreach_prev`, checks that `prev` always
+           precedes the iterator and removes the first and the last node
+           while iterating. A second pass removes every node.
+*/
+MYUNIT_TESTCASE(foreach_prev_filter)
+{
+   list_t list;
+   list_node_t *prev;
+   list_node_t *iterator;
+   size_t nodecount = 0;
+   test_fixture_setup(FIXTURE_NORMAL, &list);
+
+   list_foreach_prev(&list, prev, iterator)
+   {
+       MYUNIT_ASSERT_EQUAL(list_next(&list,prev), iterator);
+       MYUNIT_ASSERT_TRUE(mynode_check(iterator, nodecount));
+       nodecount++;
+
+       if (iterator != &mynodes[NODE1].node)
+       {
+           list_erase_after(&list,prev);
+       }
+   }
+
+   MYUNIT_ASSERT_EQUAL(nodecount, NODES);
+   MYUNIT_ASSERT_EQUAL(list_size(&list), 1);
+   MYUNIT_ASSERT_TRUE(mynode_check(list_front(&list), NODE1));
+   MYUNIT_ASSERT_TRUE(mynode_check(list_back(&list), NODE1));
+
+   list_push_back(&list,&mynodes[NODE2].node);
+   nodecount = 0;
+
+   list_foreach_prev(&list, prev, iterator)
+   {
+       MYUNIT_ASSERT_EQUAL(prev, list_end(&list));
+       list_erase_after(&list,prev);
+       nodecount++;
+   }
+
+   MYUNIT_ASSERT_EQUAL(nodecount, 2);
+   MYUNIT_ASSERT_TRUE(list_empty(&list));
+   MYUNIT_ASSERT_EQUAL(list_back(&list), list_end(&list));
+}
+
+#endif
+
+#if defined(list_sort)
+
+#define SORT_NODES 300
+
+/*! Node with a key that is sorted by and the original position to verify stability. */
+typedef struct {
+    uint16_t key;
+    uint16_t seq;
+    list_node_t node;
+} keyed_t;
+
+static keyed_t keyed[SORT_NODES];
+
+static int keyed_compare(const list_node_t *a, const list_node_t *b)
+{
+    uint16_t ka = container_of(a, keyed_t, node)->key;
+    uint16_t kb = container_of(b, keyed_t, node)->key;
+
+    return (ka > kb) - (ka < kb);
+}
+
+/* fills the nodes with keys in 0..range-1 in pseudo random order, range small enough for many ties */
+static void keyed_setup(uint16_t range)
+{
+    uint32_t state = 12345;
+    uint16_t idx;
+
+    for (idx = 0; idx < SORT_NODES; idx++)
+    {
+        state = state * 1103515245UL + 12345;
+        keyed[idx].key = (uint16_t)((state >> 16) % range);
+        keyed[idx].seq = idx;
+    }
+}
+
+/* true if the list holds count nodes ordered by key and, on equal keys, by seq */
+static bool keyed_check_sorted(list_t *list, size_t count)
+{
+    list_node_t *iterator;
+    keyed_t *last = NULL;
+    size_t nodes = 0;
+
+    list_foreach(list, iterator)
+    {
+        keyed_t *current = container_of(iterator, keyed_t, node);
+
+        if (last && (last->key > current->key || (last->key == current->key && last->seq > current->seq)))
+        {
+            return false;
+        }
+
+        last = current;
+        nodes++;
+    }
+
+    return nodes == count && (count == 0 || list_back(list) == &last->node);
+}
+
+/*!
+  \brief   Tests the stable in place merge sort.
+
+  \details Sorts an empty list, a single node, a list with many equal keys,
+           an already sorted and a reversed list, and checks the order,
+           stability, node count and the links at the end of the list.
+*/
+MYUNIT_TESTCASE(sort)
+{
+   list_t list;
+   uint16_t idx;
+
+   list_init(&list);
+   list_sort(&list, keyed_compare);
+   MYUNIT_ASSERT_TRUE(list_empty(&list));
+
+   keyed_setup(10);
+   list_push_back(&list, &keyed[0].node);
+   list_sort(&list, keyed_compare);
+   MYUNIT_ASSERT_TRUE(keyed_check_sorted(&list, 1));
+
+   list_init(&list);
+
+   for (idx = 0; idx < SORT_NODES; idx++)
+   {
+       list_push_back(&list, &keyed[idx].node);
+   }
+
+   list_sort(&list, keyed_compare);
+   MYUNIT_ASSERT_TRUE(keyed_check_sorted(&list, SORT_NODES));
+
+   /* sorting a sorted list keeps it */
+   list_sort(&list, keyed_compare);
+   MYUNIT_ASSERT_TRUE(keyed_check_sorted(&list, SORT_NODES));
+
+   /* descending keys, distinct */
+   list_init(&list);
+
+   for (idx = 0; idx < SORT_NODES; idx++)
+   {
+       keyed[idx].key = SORT_NODES - idx;
+       list_push_back(&list, &keyed[idx].node);
+   }
+
+   list_sort(&list, keyed_compare);
+   MYUNIT_ASSERT_TRUE(keyed_check_sorted(&list, SORT_NODES));
+   MYUNIT_ASSERT_EQUAL(list_front(&list), &keyed[SORT_NODES - 1].node);
+   MYUNIT_ASSERT_EQUAL(list_size(&list), SORT_NODES);
+}
+
+/*!
+  \brief   Tests building a sorted list by sorted insertion.
+*/
+MYUNIT_TESTCASE(insert_sorted)
+{
+   list_t list;
+   uint16_t idx;
+
+   keyed_setup(20);
+   list_init(&list);
+
+   for (idx = 0; idx < SORT_NODES; idx++)
+   {
+       list_insert_sorted(&list, &keyed[idx].node, keyed_compare);
+   }
+
+   MYUNIT_ASSERT_TRUE(keyed_check_sorted(&list, SORT_NODES));
+}
+
+/*!
+  \brief   Tests merging two sorted lists.
+
+  \details Merges two interleaved sorted lists, a list into an empty one and
+           an empty list into a list. On equal keys the nodes of the target
+           list come first, which the seq order of the halves verifies.
+*/
+MYUNIT_TESTCASE(merge)
+{
+   list_t list;
+   list_t other;
+   uint16_t idx;
+
+   keyed_setup(25);
+   list_init(&list);
+   list_init(&other);
+
+   for (idx = 0; idx < SORT_NODES; idx++)
+   {
+       if (idx < SORT_NODES / 2)
+       {
+           list_push_back(&list, &keyed[idx].node);
+       }
+       else
+       {
+           list_push_back(&other, &keyed[idx].node);
+       }
+   }
+
+   list_sort(&list, keyed_compare);
+   list_sort(&other, keyed_compare);
+   list_merge(&list, &other, keyed_compare);
+
+   MYUNIT_ASSERT_TRUE(list_empty(&other));
+   MYUNIT_ASSERT_TRUE(keyed_check_sorted(&list, SORT_NODES));
+
+   list_merge(&list, &other, keyed_compare);
+   MYUNIT_ASSERT_TRUE(keyed_check_sorted(&list, SORT_NODES));
+
+   list_merge(&other, &list, keyed_compare);
+   MYUNIT_ASSERT_TRUE(list_empty(&list));
+   MYUNIT_ASSERT_TRUE(keyed_check_sorted(&other, SORT_NODES));
+}
+
+#endif
+
+#if defined(list_erase_safe)
+
+/*!
+  \brief   Tests the O(1) membership check of nodes removed with the safe erase.
+*/
+MYUNIT_TESTCASE(node_is_linked)
+{
+   list_t list;
+   static mynode_t unlinked;
+   test_fixture_setup(FIXTURE_NORMAL, &list);
+
+   /* zero initialised static nodes are unlinked */
+   MYUNIT_ASSERT_FALSE(list_node_is_linked(&unlinked.node));
+   MYUNIT_ASSERT_TRUE(list_node_is_linked(&mynodes[NODE1].node));
+
+   list_erase_safe(&list, &mynodes[NODE1].node);
+   MYUNIT_ASSERT_FALSE(list_node_is_linked(&mynodes[NODE1].node));
+   MYUNIT_ASSERT_EQUAL(list_size(&list), NODES - 1);
+   MYUNIT_ASSERT_TRUE(mynode_check(list_front(&list), NODE0));
+   MYUNIT_ASSERT_TRUE(mynode_check(list_back(&list), NODE2));
+
+   list_erase_safe(&list, list_front(&list));
+   MYUNIT_ASSERT_FALSE(list_node_is_linked(&mynodes[NODE0].node));
+   MYUNIT_ASSERT_TRUE(mynode_check(list_front(&list), NODE2));
+
+   list_erase_safe(&list, list_back(&list));
+   MYUNIT_ASSERT_FALSE(list_node_is_linked(&mynodes[NODE2].node));
+   MYUNIT_ASSERT_TRUE(list_empty(&list));
+
+   list_push_back(&list, &mynodes[NODE1].node);
+   MYUNIT_ASSERT_TRUE(list_node_is_linked(&mynodes[NODE1].node));
+
+   list_node_init(&mynodes[NODE0].node);
+   MYUNIT_ASSERT_FALSE(list_node_is_linked(&mynodes[NODE0].node));
+}
+
+#endif
+
+#if defined(list_erase_if_linked)
+
+/*!
+  \brief   Tests that removing an unlinked node again is harmless.
+*/
+MYUNIT_TESTCASE(erase_if_linked)
+{
+   list_t list;
+   static mynode_t unlinked;
+   test_fixture_setup(FIXTURE_NORMAL, &list);
+
+   list_erase_if_linked(&list, &mynodes[NODE1].node);
+   MYUNIT_ASSERT_FALSE(list_node_is_linked(&mynodes[NODE1].node));
+   MYUNIT_ASSERT_EQUAL(list_size(&list), NODES - 1);
+
+   /* a second cancel and a never linked node leave the list untouched */
+   list_erase_if_linked(&list, &mynodes[NODE1].node);
+   list_erase_if_linked(&list, &unlinked.node);
+   MYUNIT_ASSERT_EQUAL(list_size(&list), NODES - 1);
+   MYUNIT_ASSERT_TRUE(mynode_check(list_front(&list), NODE0));
+   MYUNIT_ASSERT_TRUE(mynode_check(list_back(&list), NODE2));
+
+   list_erase_if_linked(&list, list_front(&list));
+   list_erase_if_linked(&list, list_back(&list));
+   MYUNIT_ASSERT_TRUE(list_empty(&list));
+   MYUNIT_ASSERT_EQUAL(list_size(&list), 0);
+}
+
+#endif
+
+#if defined(list_splice_back)
+
+/*!
+  \brief   Checks that a list holds the given nodes of `mynodes` in order.
+*/
+static bool list_check_nodes(list_t *list, uint8_t first, uint8_t count)
+{
+   list_node_t *iterator;
+   uint8_t nodeid = first;
+
+   list_foreach(list, iterator)
+   {
+       if (!mynode_check(iterator, nodeid))
+       {
+           return false;
+       }
+
+       nodeid++;
+   }
+
+   return nodeid == first + count && list_size(list) == count &&
+          (count == 0 ? list_back(list) == list_end(list) : mynode_check(list_back(list), first + count - 1));
+}
+
+/*!
+  \brief   Tests moving whole lists and splitting lists.
+
+  \details Cuts the list in the middle, at the front and at the end and
+           splices the parts back, including into and from empty lists.
+*/
+MYUNIT_TESTCASE(splice_cut)
+{
+   list_t list;
+   list_t other;
+   test_fixture_setup(FIXTURE_NORMAL, &list);
+   list_init(&other);
+
+   list_cut(&list, &mynodes[NODE1].node, &other);
+   MYUNIT_ASSERT_TRUE(list_check_nodes(&list, NODE0, 1));
+   MYUNIT_ASSERT_TRUE(list_check_nodes(&other, NODE1, 2));
+
+   list_splice_back(&list, &other);
+   MYUNIT_ASSERT_TRUE(list_check_nodes(&list, NODE0, NODES));
+   MYUNIT_ASSERT_TRUE(list_check_nodes(&other, NODE0, 0));
+
+   list_cut(&list, &mynodes[NODE0].node, &other);
+   MYUNIT_ASSERT_TRUE(list_check_nodes(&list, NODE0, 0));
+   MYUNIT_ASSERT_TRUE(list_check_nodes(&other, NODE0, NODES));
+
+   list_cut(&other, list_end(&other), &list);
+   MYUNIT_ASSERT_TRUE(list_check_nodes(&list, NODE0, 0));
+   MYUNIT_ASSERT_TRUE(list_check_nodes(&other, NODE0, NODES));
+
+   list_splice_back(&list, &other);
+   MYUNIT_ASSERT_TRUE(list_check_nodes(&list, NODE0, NODES));
+   MYUNIT_ASSERT_TRUE(list_check_nodes(&other, NODE0, 0));
+
+   list_splice_back(&list, &other);
+   MYUNIT_ASSERT_TRUE(list_check_nodes(&list, NODE0, NODES));
+
+   /* the parts keep working as lists */
+   list_cut(&list, &mynodes[NODE2].node, &other);
+   list_pop_back(&list);
+   list_push_back(&other, &mynodes[NODE1].node);
+   MYUNIT_ASSERT_TRUE(list_check_nodes(&list, NODE0, 1));
+   MYUNIT_ASSERT_EQUAL(list_size(&other), 2);
+   MYUNIT_ASSERT_TRUE(mynode_check(list_back(&other), NODE1));
+}
+
+#endif
+
+#if ( UNITTEST_LIST_TYPE == UNITTEST_LIST_TYPE_SLIST ) || ( UNITTEST_LIST_TYPE == UNITTEST_LIST_TYPE_DLIST )
+
+/*!
+  \brief   Tests moving ranges of nodes between and within lists.
+*/
+MYUNIT_TESTCASE(splice_range)
+{
+   list_t list;
+   list_t other;
+   test_fixture_setup(FIXTURE_NORMAL, &list);
+   list_init(&other);
+
+#if ( UNITTEST_LIST_TYPE == UNITTEST_LIST_TYPE_SLIST )
+   slist_splice_after(&other, &other, &mynodes[NODE0].node, &mynodes[NODE2].node);
+#else
+   dlist_splice_range(&other, dlist_end(&other), &mynodes[NODE1].node, &mynodes[NODE2].node);
+#endif
+
+   MYUNIT_ASSERT_TRUE(list_check_nodes(&list, NODE0, 1));
+   MYUNIT_ASSERT_TRUE(list_check_nodes(&other, NODE1, 2));
+
+   /* within a list, NODE2 to the front */
+#if ( UNITTEST_LIST_TYPE == UNITTEST_LIST_TYPE_SLIST )
+   slist_splice_after(&other, &other, &mynodes[NODE1].node, &mynodes[NODE2].node);
+#else
+   dlist_splice_range(&other, &mynodes[NODE1].node, &mynodes[NODE2].node, &mynodes[NODE2].node);
+#endif
+
+   MYUNIT_ASSERT_TRUE(mynode_check(list_front(&other), NODE2));
+   MYUNIT_ASSERT_TRUE(mynode_check(list_back(&other), NODE1));
+   MYUNIT_ASSERT_EQUAL(list_size(&other), 2);
+
+   /* back behind NODE0 */
+#if ( UNITTEST_LIST_TYPE == UNITTEST_LIST_TYPE_SLIST )
+   slist_splice_after(&list, &mynodes[NODE0].node, &other, &mynodes[NODE1].node);
+#else
+   dlist_splice_range(&list, dlist_end(&list), &mynodes[NODE2].node, &mynodes[NODE1].node);
+#endif
+
+   MYUNIT_ASSERT_TRUE(list_empty(&other));
+   MYUNIT_ASSERT_EQUAL(list_size(&list), NODES);
+   MYUNIT_ASSERT_TRUE(mynode_check(list_back(&list), NODE1));
+}
+
+#endif
+
+/*!
+  \brief   Tests that the back of the list follows every kind of update.
+
+  \details Mixes all operations that may add or remove the last node and
+           checks `list_back` after each, then appends with `list_push_back`
+           to verify the order. Covers the tail tracking of the tail anchored
+           list as well as the plain lists.
+*/
+MYUNIT_TESTCASE(back_follows_updates)
+{
+   list_t list;
+   list_node_t *iterator;
+   size_t nodecount = 0;
+   test_fixture_setup(FIXTURE_EMPTY, &list);
+
+   list_push_front(&list,&mynodes[NODE0].node);
+   MYUNIT_ASSERT_TRUE(mynode_check(list_back(&list), NODE0));
+
+   list_pop_front(&list);
+   MYUNIT_ASSERT_EQUAL(list_back(&list), list_end(&list));
+
+   list_push_back(&list,&mynodes[NODE0].node);
+   list_insert_after(&list,list_back(&list),&mynodes[NODE1].node);
+   MYUNIT_ASSERT_TRUE(mynode_check(list_back(&list), NODE1));
+
+   list_pop_back(&list);
+   MYUNIT_ASSERT_TRUE(mynode_check(list_back(&list), NODE0));
+
+   list_insert_before(&list,list_end(&list),&mynodes[NODE1].node);
+   MYUNIT_ASSERT_TRUE(mynode_check(list_back(&list), NODE1));
+
+   list_erase(&list,&mynodes[NODE1].node);
+   MYUNIT_ASSERT_TRUE(mynode_check(list_back(&list), NODE0));
+
+   list_push_back(&list,&mynodes[NODE1].node);
+   list_push_back(&list,&mynodes[NODE2].node);
+   MYUNIT_ASSERT_TRUE(mynode_check(list_back(&list), NODE2));
+
+   list_foreach(&list, iterator)
+   {
+       MYUNIT_ASSERT_TRUE(mynode_check(iterator,nodecount));
+       nodecount++;
+   }
+
+   MYUNIT_ASSERT_EQUAL(nodecount, NODES);
+}
+
+
 
 
 
@@ -1132,6 +1633,28 @@ MYUNIT_TESTSUITE_EXP(myunit_list_type)
     MYUNIT_EXEC_TESTCASE(insert_before);
 
     MYUNIT_EXEC_TESTCASE(erase);
+    MYUNIT_EXEC_TESTCASE(back_follows_updates);
+#if defined(list_erase_after)
+    MYUNIT_EXEC_TESTCASE(erase_after);
+    MYUNIT_EXEC_TESTCASE(foreach_prev_filter);
+#endif
+#if defined(list_erase_safe)
+    MYUNIT_EXEC_TESTCASE(node_is_linked);
+#endif
+#if defined(list_erase_if_linked)
+    MYUNIT_EXEC_TESTCASE(erase_if_linked);
+#endif
+#if defined(list_splice_back)
+    MYUNIT_EXEC_TESTCASE(splice_cut);
+#endif
+#if ( UNITTEST_LIST_TYPE == UNITTEST_LIST_TYPE_SLIST ) || ( UNITTEST_LIST_TYPE == UNITTEST_LIST_TYPE_DLIST )
+    MYUNIT_EXEC_TESTCASE(splice_range);
+#endif
+#if defined(list_sort)
+    MYUNIT_EXEC_TESTCASE(sort);
+    MYUNIT_EXEC_TESTCASE(insert_sorted);
+    MYUNIT_EXEC_TESTCASE(merge);
+#endif
 
     MYUNIT_EXEC_TESTCASE(find_empty_list);
     MYUNIT_EXEC_TESTCASE(find_node_present);
@@ -0,0 +1,219 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#include "myunit.h"
+#include <stdint.h>
+#include "pheap.h"
+
+typedef pheap_node_t entry_node_t;
+
+#define ENTRY_COUNT 200
+
+#include "myunit_entry.h"
+
+static int entry_compare(const pheap_node_t *a, const pheap_node_t *b)
+{
+    return entry_order(entry_key(a), entry_key(b));
+}
+
+/* pops all nodes, true if they come out in ascending order and match the count */
+static bool pheap_drain_sorted(pheap_t *heap)
+{
+    size_t count = pheap_size(heap);
+    pheap_node_t *prev = NULL;
+    pheap_node_t *node;
+
+    while ((node = pheap_pop(heap)) != NULL)
+    {
+        if (prev && entry_key(prev) > entry_key(node))
+        {
+            return false;
+        }
+
+        prev = node;
+        count--;
+    }
+
+    return count == 0 && pheap_empty(heap);
+}
+
+MYUNIT_TESTCASE(pheap_empty)
+{
+    pheap_t heap;
+
+    pheap_init(&heap, entry_compare);
+
+    MYUNIT_ASSERT_TRUE(pheap_empty(&heap));
+    MYUNIT_ASSERT_EQUAL(pheap_size(&heap), 0);
+    MYUNIT_ASSERT_IS_NULL(pheap_min(&heap));
+    MYUNIT_ASSERT_IS_NULL(pheap_pop(&heap));
+}
+
+MYUNIT_TESTCASE(pheap_insert_pop_sorted)
+{
+    pheap_t heap;
+    uint16_t idx;
+
+    ITEMPOOL_INIT(entries);
+    pheap_init(&heap, entry_compare);
+
+    for (idx = 0; idx < ENTRY_COUNT; idx++)
+    {
+        entry_t *entry = entry_new((uint16_t)(idx * 37 % 101), idx);
+        pheap_insert(&heap, &entry->node);
+        MYUNIT_ASSERT_TRUE(entry_key(pheap_min(&heap)) <= entry->key);
+    }
+
+    MYUNIT_ASSERT_EQUAL(pheap_size(&heap), ENTRY_COUNT);
+    MYUNIT_ASSERT_EQUAL(entry_key(pheap_min(&heap)), 0);
+    MYUNIT_ASSERT_TRUE(pheap_drain_sorted(&heap));
+}
+
+MYUNIT_TESTCASE(pheap_decrease_key)
+{
+    pheap_t heap;
+    entry_t *entry[ENTRY_COUNT];
+    uint16_t idx;
+
+    ITEMPOOL_INIT(entries);
+    pheap_init(&heap, entry_compare);
+
+    for (idx = 0; idx < ENTRY_COUNT; idx++)
+    {
+        entry[idx] = entry_new((uint16_t)(1000 + idx * 7 % ENTRY_COUNT), idx);
+        pheap_insert(&heap, &entry[idx]->node);
+    }
+
+    /* the structure is built up by a pop before nodes deep in the tree are moved */
+    pheap_pop(&heap);
+
+    entry[150]->key = 5;
+    pheap_decrease_key(&heap, &entry[150]->node);
+    MYUNIT_ASSERT_EQUAL(pheap_min(&heap), &entry[150]->node);
+
+    for (idx = 1; idx < ENTRY_COUNT; idx += 3)
+    {
+        if (idx != 150)
+        {
+            entry[idx]->key -= 500;
+            pheap_decrease_key(&heap, &entry[idx]->node);
+        }
+    }
+
+    /* the root itself */
+    entry[150]->key = 1;
+    pheap_decrease_key(&heap, &entry[150]->node);
+    MYUNIT_ASSERT_EQUAL(pheap_min(&heap), &entry[150]->node);
+
+    MYUNIT_ASSERT_EQUAL(pheap_size(&heap), ENTRY_COUNT - 1);
+    MYUNIT_ASSERT_TRUE(pheap_drain_sorted(&heap));
+}
+
+MYUNIT_TESTCASE(pheap_erase)
+{
+    pheap_t heap;
+    entry_t *entry[ENTRY_COUNT];
+    uint16_t idx;
+    size_t erased = 0;
+
+    ITEMPOOL_INIT(entries);
+    pheap_init(&heap, entry_compare);
+
+    for (idx = 0; idx < ENTRY_COUNT; idx++)
+    {
+        entry[idx] = entry_new((uint16_t)(idx * 7 % ENTRY_COUNT), idx);
+        pheap_insert(&heap, &entry[idx]->node);
+    }
+
+    pheap_pop(&heap);
+
+    /* every third node, leaves as well as inner nodes */
+    for (idx = 2; idx < ENTRY_COUNT; idx += 3)
+    {
+        pheap_erase(&heap, &entry[idx]->node);
+        erased++;
+    }
+
+    pheap_erase(&heap, pheap_min(&heap));
+
+    MYUNIT_ASSERT_EQUAL(pheap_size(&heap), ENTRY_COUNT - 2 - erased);
+    MYUNIT_ASSERT_TRUE(pheap_drain_sorted(&heap));
+}
+
+MYUNIT_TESTCASE(pheap_meld)
+{
+    pheap_t heap;
+    pheap_t other;
+    uint16_t idx;
+
+    ITEMPOOL_INIT(entries);
+    pheap_init(&heap, entry_compare);
+    pheap_init(&other, entry_compare);
+
+    for (idx = 0; idx < 50; idx++)
+    {
+        pheap_insert(idx % 2 ? &heap : &other, &entry_new((uint16_t)(100 - idx), idx)->node);
+    }
+
+    pheap_meld(&heap, &other);
+
+    MYUNIT_ASSERT_TRUE(pheap_empty(&other));
+    MYUNIT_ASSERT_EQUAL(pheap_size(&other), 0);
+    MYUNIT_ASSERT_EQUAL(pheap_size(&heap), 50);
+    MYUNIT_ASSERT_EQUAL(entry_key(pheap_min(&heap)), 51);
+
+    pheap_meld(&heap, &other);
+    MYUNIT_ASSERT_EQUAL(pheap_size(&heap), 50);
+
+    pheap_meld(&other, &heap);
+    MYUNIT_ASSERT_EQUAL(pheap_size(&other), 50);
+    MYUNIT_ASSERT_TRUE(pheap_drain_sorted(&other));
+}
+
+void myunit_testsuite_setup()
+{
+
+}
+
+void myunit_testsuite_teardown()
+{
+
+}
+
+MYUNIT_TESTSUITE(pheap)
+{
+    MYUNIT_TESTSUITE_BEGIN();
+
+    MYUNIT_EXEC_TESTCASE(pheap_empty);
+    MYUNIT_EXEC_TESTCASE(pheap_insert_pop_sorted);
+    MYUNIT_EXEC_TESTCASE(pheap_decrease_key);
+    MYUNIT_EXEC_TESTCASE(pheap_erase);
+    MYUNIT_EXEC_TESTCASE(pheap_meld);
+
+    MYUNIT_TESTSUITE_END();
+}
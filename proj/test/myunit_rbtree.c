@@ -0,0 +1,342 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#include "myunit.h"
+#include <stdint.h>
+#include "rbtree.h"
+
+typedef rbtree_node_t entry_node_t;
+
+#define ENTRY_COUNT 300
+
+#include "myunit_entry.h"
+
+static int entry_compare(const rbtree_node_t *node, const void *key)
+{
+    return entry_order(entry_key(node), *(const uint16_t*)key);
+}
+
+/* black height of the subtree, -1 if a red-black property or a link is broken */
+static int rbtree_check_subtree(rbtree_node_t *node, rbtree_node_t *parent)
+{
+    int left;
+    int right;
+
+    if (node == NULL)
+    {
+        return 0;
+    }
+
+    if (node->parent != parent)
+    {
+        return -1;
+    }
+
+    if (node->color == RBTREE_RED &&
+        ((node->left && node->left->color == RBTREE_RED) || (node->right && node->right->color == RBTREE_RED)))
+    {
+        return -1;
+    }
+
+    left = rbtree_check_subtree(node->left, node);
+    right = rbtree_check_subtree(node->right, node);
+
+    if (left < 0 || left != right)
+    {
+        return -1;
+    }
+
+    return left + (node->color == RBTREE_BLACK);
+}
+
+/* checks balance, links, ascending order and the node count */
+static bool rbtree_check(rbtree_t *tree)
+{
+    rbtree_node_t *iterator;
+    rbtree_node_t *prev = NULL;
+    size_t count = 0;
+
+    if (tree->root && tree->root->color != RBTREE_BLACK)
+    {
+        return false;
+    }
+
+    if (rbtree_check_subtree(tree->root, NULL) < 0)
+    {
+        return false;
+    }
+
+    rbtree_foreach(tree, iterator)
+    {
+        if (prev && entry_key(prev) > entry_key(iterator))
+        {
+            return false;
+        }
+
+        prev = iterator;
+        count++;
+    }
+
+    return count == rbtree_size(tree);
+}
+
+MYUNIT_TESTCASE(rbtree_empty)
+{
+    rbtree_t tree;
+    uint16_t key = 5;
+
+    rbtree_init(&tree, entry_compare);
+
+    MYUNIT_ASSERT_TRUE(rbtree_empty(&tree));
+    MYUNIT_ASSERT_EQUAL(rbtree_size(&tree), 0);
+    MYUNIT_ASSERT_IS_NULL(rbtree_first(&tree));
+    MYUNIT_ASSERT_IS_NULL(rbtree_last(&tree));
+    MYUNIT_ASSERT_IS_NULL(rbtree_find(&tree, &key));
+    MYUNIT_ASSERT_IS_NULL(rbtree_lower_bound(&tree, &key));
+}
+
+/* inserts the keys 0,2,4,... in a scrambled order, finds them, erases half and checks the rest */
+MYUNIT_TESTCASE(rbtree_insert_find_erase)
+{
+    rbtree_t tree;
+    rbtree_node_t *iterator;
+    uint16_t idx;
+    uint16_t expected;
+
+    ITEMPOOL_INIT(entries);
+    rbtree_init(&tree, entry_compare);
+
+    for (idx = 0; idx < ENTRY_COUNT; idx++)
+    {
+        /* 7 is coprime to ENTRY_COUNT, every key is inserted once */
+        entry_t *entry = entry_new((uint16_t)((idx * 7 % ENTRY_COUNT) * 2), idx);
+        MYUNIT_ASSERT_EQUAL(rbtree_insert(&tree, &entry->node, &entry->key), &entry->node);
+    }
+
+    MYUNIT_ASSERT_EQUAL(rbtree_size(&tree), ENTRY_COUNT);
+    MYUNIT_ASSERT_TRUE(rbtree_check(&tree));
+
+    expected = 0;
+
+    rbtree_foreach(&tree, iterator)
+    {
+        MYUNIT_ASSERT_EQUAL(entry_key(iterator), expected);
+        expected += 2;
+    }
+
+    MYUNIT_ASSERT_EQUAL(expected, ENTRY_COUNT * 2);
+
+    rbtree_foreach_reverse(&tree, iterator)
+    {
+        expected -= 2;
+        MYUNIT_ASSERT_EQUAL(entry_key(iterator), expected);
+    }
+
+    for (idx = 0; idx < ENTRY_COUNT * 2; idx++)
+    {
+        rbtree_node_t *node = rbtree_find(&tree, &idx);
+
+        if (idx % 2)
+        {
+            MYUNIT_ASSERT_IS_NULL(node);
+        }
+        else
+        {
+            MYUNIT_ASSERT_NOT_NULL(node);
+            MYUNIT_ASSERT_EQUAL(entry_key(node), idx);
+        }
+    }
+
+    /* erases every multiple of 4 once, scrambled */
+    for (idx = 0; idx < ENTRY_COUNT * 2; idx += 4)
+    {
+        uint16_t key = (uint16_t)((idx * 7) % (ENTRY_COUNT * 2));
+        rbtree_node_t *node = rbtree_find(&tree, &key);
+
+        MYUNIT_ASSERT_NOT_NULL(node);
+        rbtree_erase(&tree, node);
+        MYUNIT_ASSERT_IS_NULL(rbtree_find(&tree, &key));
+    }
+
+    MYUNIT_ASSERT_EQUAL(rbtree_size(&tree), ENTRY_COUNT / 2);
+    MYUNIT_ASSERT_TRUE(rbtree_check(&tree));
+
+    while (!rbtree_empty(&tree))
+    {
+        rbtree_erase(&tree, rbtree_first(&tree));
+        MYUNIT_ASSERT_TRUE(rbtree_check(&tree));
+    }
+
+    MYUNIT_ASSERT_EQUAL(rbtree_size(&tree), 0);
+}
+
+MYUNIT_TESTCASE(rbtree_insert_rejects_duplicate_key)
+{
+    rbtree_t tree;
+    entry_t *first;
+    entry_t *second;
+
+    ITEMPOOL_INIT(entries);
+    rbtree_init(&tree, entry_compare);
+
+    first = entry_new(42, 0);
+    second = entry_new(42, 1);
+
+    MYUNIT_ASSERT_EQUAL(rbtree_insert(&tree, &first->node, &first->key), &first->node);
+    MYUNIT_ASSERT_EQUAL(rbtree_insert(&tree, &second->node, &second->key), &first->node);
+    MYUNIT_ASSERT_EQUAL(rbtree_size(&tree), 1);
+}
+
+/* equal keys keep their insertion order, find and lower_bound return the first of them */
+MYUNIT_TESTCASE(rbtree_insert_multi_is_stable)
+{
+    rbtree_t tree;
+    rbtree_node_t *iterator;
+    uint16_t idx;
+    uint16_t key = 3;
+    entry_t *prev = NULL;
+
+    ITEMPOOL_INIT(entries);
+    rbtree_init(&tree, entry_compare);
+
+    for (idx = 0; idx < 100; idx++)
+    {
+        entry_t *entry = entry_new((uint16_t)(idx * 13 % 8), idx);
+        rbtree_insert_multi(&tree, &entry->node, &entry->key);
+    }
+
+    MYUNIT_ASSERT_EQUAL(rbtree_size(&tree), 100);
+    MYUNIT_ASSERT_TRUE(rbtree_check(&tree));
+
+    rbtree_foreach(&tree, iterator)
+    {
+        entry_t *entry = container_of(iterator, entry_t, node);
+
+        if (prev && prev->key == entry->key)
+        {
+            MYUNIT_ASSERT_TRUE(prev->seq < entry->seq);
+        }
+
+        prev = entry;
+    }
+
+    iterator = rbtree_find(&tree, &key);
+    MYUNIT_ASSERT_NOT_NULL(iterator);
+    MYUNIT_ASSERT_EQUAL(rbtree_lower_bound(&tree, &key), iterator);
+    MYUNIT_ASSERT_EQUAL(entry_key(iterator), 3);
+    MYUNIT_ASSERT_EQUAL(entry_key(rbtree_prev(&tree, iterator)), 2);
+    MYUNIT_ASSERT_EQUAL(entry_key(rbtree_upper_bound(&tree, &key)), 4);
+}
+
+MYUNIT_TESTCASE(rbtree_bounds)
+{
+    rbtree_t tree;
+    uint16_t idx;
+    uint16_t key;
+
+    ITEMPOOL_INIT(entries);
+    rbtree_init(&tree, entry_compare);
+
+    /* keys 10,20,...,100 */
+    for (idx = 10; idx > 0; idx--)
+    {
+        entry_t *entry = entry_new((uint16_t)(idx * 10), idx);
+        rbtree_insert(&tree, &entry->node, &entry->key);
+    }
+
+    key = 0;
+    MYUNIT_ASSERT_EQUAL(entry_key(rbtree_lower_bound(&tree, &key)), 10);
+    key = 10;
+    MYUNIT_ASSERT_EQUAL(entry_key(rbtree_lower_bound(&tree, &key)), 10);
+    MYUNIT_ASSERT_EQUAL(entry_key(rbtree_upper_bound(&tree, &key)), 20);
+    key = 55;
+    MYUNIT_ASSERT_EQUAL(entry_key(rbtree_lower_bound(&tree, &key)), 60);
+    MYUNIT_ASSERT_EQUAL(entry_key(rbtree_upper_bound(&tree, &key)), 60);
+    key = 100;
+    MYUNIT_ASSERT_EQUAL(entry_key(rbtree_lower_bound(&tree, &key)), 100);
+    MYUNIT_ASSERT_IS_NULL(rbtree_upper_bound(&tree, &key));
+    key = 101;
+    MYUNIT_ASSERT_IS_NULL(rbtree_lower_bound(&tree, &key));
+
+    MYUNIT_ASSERT_EQUAL(entry_key(rbtree_first(&tree)), 10);
+    MYUNIT_ASSERT_EQUAL(entry_key(rbtree_last(&tree)), 100);
+    MYUNIT_ASSERT_IS_NULL(rbtree_next(&tree, rbtree_last(&tree)));
+    MYUNIT_ASSERT_IS_NULL(rbtree_prev(&tree, rbtree_first(&tree)));
+}
+
+/* erases the root, inner nodes and leaves in turn */
+MYUNIT_TESTCASE(rbtree_erase_any_position)
+{
+    rbtree_t tree;
+    uint16_t idx;
+
+    ITEMPOOL_INIT(entries);
+    rbtree_init(&tree, entry_compare);
+
+    for (idx = 0; idx < 64; idx++)
+    {
+        entry_t *entry = entry_new(idx, idx);
+        rbtree_insert(&tree, &entry->node, &entry->key);
+    }
+
+    MYUNIT_ASSERT_TRUE(rbtree_check(&tree));
+
+    for (idx = 0; idx < 32; idx++)
+    {
+        rbtree_erase(&tree, tree.root);
+        MYUNIT_ASSERT_TRUE(rbtree_check(&tree));
+        rbtree_erase(&tree, rbtree_last(&tree));
+        MYUNIT_ASSERT_TRUE(rbtree_check(&tree));
+    }
+
+    MYUNIT_ASSERT_TRUE(rbtree_empty(&tree));
+}
+
+void myunit_testsuite_setup()
+{
+
+}
+
+void myunit_testsuite_teardown()
+{
+
+}
+
+MYUNIT_TESTSUITE(rbtree)
+{
+    MYUNIT_TESTSUITE_BEGIN();
+
+    MYUNIT_EXEC_TESTCASE(rbtree_empty);
+    MYUNIT_EXEC_TESTCASE(rbtree_insert_find_erase);
+    MYUNIT_EXEC_TESTCASE(rbtree_insert_rejects_duplicate_key);
+    MYUNIT_EXEC_TESTCASE(rbtree_insert_multi_is_stable);
+    MYUNIT_EXEC_TESTCASE(rbtree_bounds);
+    MYUNIT_EXEC_TESTCASE(rbtree_erase_any_position);
+
+    MYUNIT_TESTSUITE_END();
+}
@@ -0,0 +1,293 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#include "myunit.h"
+#include <stdint.h>
+#include "skiplist.h"
+
+typedef skiplist_node_t entry_node_t;
+
+#define ENTRY_COUNT 300
+
+#include "myunit_entry.h"
+
+static int entry_compare(const skiplist_node_t *node, const void *key)
+{
+    return entry_order(entry_key(node), *(const uint16_t*)key);
+}
+
+/* every level is sorted and holds exactly the nodes at least that tall, level 0 holds count nodes */
+static bool skiplist_check(skiplist_t *list)
+{
+    uint8_t level;
+
+    for (level = 0; level < SKIPLIST_LEVELS; level++)
+    {
+        slist_node_t *iterator;
+        skiplist_node_t *prev = NULL;
+        size_t tall = 0;
+        size_t count = 0;
+
+        slist_foreach(skiplist_list(list), iterator)
+        {
+            tall += skiplist_entry(iterator,0)->levels > level;
+        }
+
+        slist_foreach(&list->head.link[level], iterator)
+        {
+            skiplist_node_t *node = skiplist_entry(iterator,level);
+
+            if (node->levels <= level || (prev && entry_key(prev) > entry_key(node)))
+            {
+                return false;
+            }
+
+            prev = node;
+            count++;
+        }
+
+        if (count != tall || (level == 0 && count != skiplist_size(list)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+MYUNIT_TESTCASE(skiplist_empty)
+{
+    skiplist_t list;
+    uint16_t key = 5;
+
+    skiplist_init(&list, entry_compare);
+
+    MYUNIT_ASSERT_TRUE(skiplist_empty(&list));
+    MYUNIT_ASSERT_EQUAL(skiplist_size(&list), 0);
+    MYUNIT_ASSERT_IS_NULL(skiplist_first(&list));
+    MYUNIT_ASSERT_IS_NULL(skiplist_find(&list, &key));
+    MYUNIT_ASSERT_IS_NULL(skiplist_lower_bound(&list, &key));
+    MYUNIT_ASSERT_TRUE(skiplist_check(&list));
+}
+
+/* inserts the keys 0,2,4,... in a scrambled order, finds them, erases half and checks the rest */
+MYUNIT_TESTCASE(skiplist_insert_find_erase)
+{
+    skiplist_t list;
+    skiplist_node_t *iterator;
+    uint16_t idx;
+    uint16_t expected = 0;
+    bool towers = false;
+
+    ITEMPOOL_INIT(entries);
+    skiplist_init(&list, entry_compare);
+
+    for (idx = 0; idx < ENTRY_COUNT; idx++)
+    {
+        entry_t *entry = entry_new((uint16_t)((idx * 7 % ENTRY_COUNT) * 2), idx);
+        MYUNIT_ASSERT_EQUAL(skiplist_insert(&list, &entry->node, &entry->key), &entry->node);
+        towers |= entry->node.levels > 1;
+    }
+
+    MYUNIT_ASSERT_TRUE(towers);
+    MYUNIT_ASSERT_EQUAL(skiplist_size(&list), ENTRY_COUNT);
+    MYUNIT_ASSERT_TRUE(skiplist_check(&list));
+
+    skiplist_foreach(&list, iterator)
+    {
+        MYUNIT_ASSERT_EQUAL(entry_key(iterator), expected);
+        expected += 2;
+    }
+
+    MYUNIT_ASSERT_EQUAL(expected, ENTRY_COUNT * 2);
+
+    for (idx = 0; idx < ENTRY_COUNT * 2; idx++)
+    {
+        skiplist_node_t *node = skiplist_find(&list, &idx);
+
+        if (idx % 2)
+        {
+            MYUNIT_ASSERT_IS_NULL(node);
+
+            if (idx + 1 < ENTRY_COUNT * 2)
+            {
+                MYUNIT_ASSERT_EQUAL(entry_key(skiplist_lower_bound(&list, &idx)), idx + 1);
+            }
+            else
+            {
+                MYUNIT_ASSERT_IS_NULL(skiplist_lower_bound(&list, &idx));
+            }
+        }
+        else
+        {
+            MYUNIT_ASSERT_NOT_NULL(node);
+            MYUNIT_ASSERT_EQUAL(entry_key(node), idx);
+        }
+    }
+
+    /* erases every multiple of 4 once, scrambled */
+    for (idx = 0; idx < ENTRY_COUNT * 2; idx += 4)
+    {
+        uint16_t key = (uint16_t)((idx * 7) % (ENTRY_COUNT * 2));
+        skiplist_node_t *node = skiplist_find(&list, &key);
+
+        MYUNIT_ASSERT_NOT_NULL(node);
+        skiplist_erase(&list, node, &key);
+        MYUNIT_ASSERT_IS_NULL(skiplist_find(&list, &key));
+    }
+
+    MYUNIT_ASSERT_EQUAL(skiplist_size(&list), ENTRY_COUNT / 2);
+    MYUNIT_ASSERT_TRUE(skiplist_check(&list));
+
+    while (!skiplist_empty(&list))
+    {
+        iterator = skiplist_first(&list);
+        skiplist_erase(&list, iterator, &entry_key(iterator));
+    }
+
+    MYUNIT_ASSERT_EQUAL(skiplist_size(&list), 0);
+    MYUNIT_ASSERT_TRUE(skiplist_check(&list));
+}
+
+MYUNIT_TESTCASE(skiplist_insert_rejects_duplicate_key)
+{
+    skiplist_t list;
+    entry_t *first;
+    entry_t *second;
+
+    ITEMPOOL_INIT(entries);
+    skiplist_init(&list, entry_compare);
+
+    first = entry_new(42, 0);
+    second = entry_new(42, 1);
+
+    MYUNIT_ASSERT_EQUAL(skiplist_insert(&list, &first->node, &first->key), &first->node);
+    MYUNIT_ASSERT_EQUAL(skiplist_insert(&list, &second->node, &second->key), &first->node);
+    MYUNIT_ASSERT_EQUAL(skiplist_size(&list), 1);
+}
+
+/* equal keys keep their insertion order, any of them can be erased */
+MYUNIT_TESTCASE(skiplist_duplicates)
+{
+    skiplist_t list;
+    skiplist_node_t *iterator;
+    entry_t *entry[100];
+    entry_t *prev = NULL;
+    uint16_t idx;
+    uint16_t key = 3;
+
+    ITEMPOOL_INIT(entries);
+    skiplist_init(&list, entry_compare);
+
+    for (idx = 0; idx < 100; idx++)
+    {
+        entry[idx] = entry_new((uint16_t)(idx * 13 % 8), idx);
+        skiplist_insert_multi(&list, &entry[idx]->node, &entry[idx]->key);
+    }
+
+    MYUNIT_ASSERT_TRUE(skiplist_check(&list));
+
+    skiplist_foreach(&list, iterator)
+    {
+        entry_t *current = container_of(iterator, entry_t, node);
+
+        if (prev && prev->key == current->key)
+        {
+            MYUNIT_ASSERT_TRUE(prev->seq < current->seq);
+        }
+
+        prev = current;
+    }
+
+    MYUNIT_ASSERT_EQUAL(entry_key(skiplist_find(&list, &key)), 3);
+
+    /* from the middle of runs of equal keys */
+    for (idx = 50; idx < 100; idx++)
+    {
+        skiplist_erase(&list, &entry[idx]->node, &entry[idx]->key);
+        MYUNIT_ASSERT_TRUE(skiplist_check(&list));
+    }
+
+    MYUNIT_ASSERT_EQUAL(skiplist_size(&list), 50);
+
+    skiplist_foreach(&list, iterator)
+    {
+        MYUNIT_ASSERT_TRUE(container_of(iterator, entry_t, node)->seq < 50);
+    }
+}
+
+/* the level 0 list is an ordinary slist */
+MYUNIT_TESTCASE(skiplist_as_slist)
+{
+    skiplist_t list;
+    slist_node_t *iterator;
+    uint16_t idx;
+    uint16_t expected = 10;
+
+    ITEMPOOL_INIT(entries);
+    skiplist_init(&list, entry_compare);
+
+    for (idx = 20; idx > 10; idx--)
+    {
+        entry_t *entry = entry_new(idx, idx);
+        skiplist_insert(&list, &entry->node, &entry->key);
+    }
+
+    MYUNIT_ASSERT_EQUAL(slist_size(skiplist_list(&list)), 10);
+    MYUNIT_ASSERT_EQUAL(entry_key(skiplist_entry(slist_front(skiplist_list(&list)),0)), 11);
+    MYUNIT_ASSERT_EQUAL(entry_key(skiplist_entry(slist_back(skiplist_list(&list)),0)), 20);
+
+    slist_foreach(skiplist_list(&list), iterator)
+    {
+        expected++;
+        MYUNIT_ASSERT_EQUAL(entry_key(skiplist_entry(iterator,0)), expected);
+    }
+}
+
+void myunit_testsuite_setup()
+{
+
+}
+
+void myunit_testsuite_teardown()
+{
+
+}
+
+MYUNIT_TESTSUITE(skiplist)
+{
+    MYUNIT_TESTSUITE_BEGIN();
+
+    MYUNIT_EXEC_TESTCASE(skiplist_empty);
+    MYUNIT_EXEC_TESTCASE(skiplist_insert_find_erase);
+    MYUNIT_EXEC_TESTCASE(skiplist_insert_rejects_duplicate_key);
+    MYUNIT_EXEC_TESTCASE(skiplist_duplicates);
+    MYUNIT_EXEC_TESTCASE(skiplist_as_slist);
+
+    MYUNIT_TESTSUITE_END();
+}
@@ -46,6 +46,7 @@ typedef slist_node_t list_node_t;
 #define list_end(list)                      slist_end(list)
 #define list_back(list)                     slist_back(list)
 #define list_foreach(list,it)               slist_foreach(list,it)
+#define list_foreach_prev(list,prev,it)     slist_foreach_prev(list,prev,it)
 #define list_empty(list)                    slist_empty(list)
 #define list_push_front(list,node)          slist_push_front(list,node)
 #define list_pop_front(list)                slist_pop_front(list)
@@ -54,8 +55,17 @@ typedef slist_node_t list_node_t;
 #define list_insert_after(list,pos,node)    slist_insert_after(list,pos,node)
 #define list_insert_before(list,pos,node)   slist_insert_before(list,pos,node)
 #define list_erase(list,node)               slist_erase(list,node)
+#define list_erase_safe(list,node)          slist_erase_safe(list,node)
+#define list_node_init(node)                slist_node_init(node)
+#define list_node_is_linked(node)           slist_node_is_linked(node)
+#define list_erase_after(list,pos)          slist_erase_after(list,pos)
 #define list_size(list)                     slist_size(list)
 #define list_find(list,node)                slist_find(list,node)
+#define list_splice_back(list,other)        slist_splice(list,slist_back(list),other)
+#define list_cut(list,node,other)           slist_cut_after(list,slist_prev(list,node),other)
+#define list_sort(list,cmp)                 slist_sort(list,cmp)
+#define list_insert_sorted(list,node,cmp)   slist_insert_sorted(list,node,cmp)
+#define list_merge(list,other,cmp)          slist_merge(list,other,cmp)
 
 
 #endif /* MYUNIT_SLIST_H_ */
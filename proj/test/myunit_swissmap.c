@@ -0,0 +1,228 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#include "myunit.h"
+#include <stdint.h>
+#include "swissmap.h"
+#include "hash.h"
+
+typedef struct {
+    uint32_t value;
+    uint32_t key;
+} entry_t;
+
+#define KEY_SPACE 4096
+
+static swissmap_t map;
+
+static uint32_t hash_murmur3_key(const void *key)
+{
+    return hash_murmur3(0, (void*)key, sizeof(uint32_t));
+}
+
+static uint32_t hash_constant(const void *key)
+{
+    (void)key;
+    return 0xDEADBEEF;
+}
+
+static bool key_equal(const void *a, const void *b)
+{
+    return *(const uint32_t*)a == *(const uint32_t*)b;
+}
+
+static bool overflow_all_zero(void)
+{
+    size_t group;
+
+    for (group = 0; group < map.groups; group++)
+    {
+        if (map.overflow[group])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+    Random inserts and removals checked against a presence table. With
+    colliding hashes the overflow counts saturate and stay, otherwise
+    erasing everything has to leave no trace on the probe paths.
+*/
+static void swissmap_exercise(bool saturates)
+{
+    static bool present[KEY_SPACE];
+    uint32_t state = 12345;
+    uint32_t key;
+    size_t count = 0;
+    size_t visited = 0;
+    entry_t *entry;
+    int round;
+
+    memset(present, 0, sizeof(present));
+
+    for (round = 0; round < 40000; round++)
+    {
+        bool inserted;
+
+        state = state * 1103515245UL + 12345;
+        key = (state >> 8) % KEY_SPACE;
+
+        /* grow during the first half, shrink during the second half */
+        if ((state >> 4) % 4 < (round < 20000 ? 3U : 1U))
+        {
+            entry = swissmap_insert(&map, &key, &inserted);
+            MYUNIT_ASSERT_NOT_NULL(entry);
+            MYUNIT_ASSERT_EQUAL(inserted, !present[key]);
+            MYUNIT_ASSERT_EQUAL(entry->key, key);
+
+            if (inserted)
+            {
+                entry->value = key * 3;
+                present[key] = true;
+                count++;
+            }
+        }
+        else
+        {
+            MYUNIT_ASSERT_EQUAL(swissmap_remove(&map, &key), present[key]);
+
+            if (present[key])
+            {
+                present[key] = false;
+                count--;
+            }
+        }
+
+        MYUNIT_ASSERT_EQUAL(swissmap_size(&map), count);
+    }
+
+    for (key = 0; key < KEY_SPACE; key++)
+    {
+        entry = swissmap_find(&map, &key);
+
+        if (present[key])
+        {
+            MYUNIT_ASSERT_NOT_NULL(entry);
+            MYUNIT_ASSERT_EQUAL(entry->value, key * 3);
+        }
+        else
+        {
+            MYUNIT_ASSERT_IS_NULL(entry);
+        }
+    }
+
+    swissmap_foreach(&map, entry)
+    {
+        MYUNIT_ASSERT_TRUE(present[entry->key]);
+        visited++;
+    }
+
+    MYUNIT_ASSERT_EQUAL(visited, count);
+
+    swissmap_foreach(&map, entry)
+    {
+        swissmap_erase(&map, entry);
+    }
+
+    MYUNIT_ASSERT_TRUE(swissmap_empty(&map));
+    MYUNIT_ASSERT_IS_NULL(swissmap_first(&map));
+    MYUNIT_ASSERT_EQUAL(overflow_all_zero(), !saturates);
+}
+
+MYUNIT_TESTCASE(swissmap_default_hash)
+{
+    swissmap_init(&map, sizeof(entry_t), offsetof(entry_t, key), sizeof(uint32_t), NULL, NULL);
+    swissmap_exercise(false);
+    swissmap_free(&map);
+}
+
+MYUNIT_TESTCASE(swissmap_user_callbacks)
+{
+    swissmap_init(&map, sizeof(entry_t), offsetof(entry_t, key), sizeof(uint32_t), hash_murmur3_key, key_equal);
+    swissmap_exercise(false);
+    swissmap_free(&map);
+}
+
+MYUNIT_TESTCASE(swissmap_colliding_hashes)
+{
+    swissmap_init(&map, sizeof(entry_t), offsetof(entry_t, key), sizeof(uint32_t), hash_constant, NULL);
+    swissmap_exercise(true);
+    swissmap_free(&map);
+}
+
+MYUNIT_TESTCASE(swissmap_reserve_keeps_entries_in_place)
+{
+    entry_t *first;
+    uint32_t key;
+
+    swissmap_init(&map, sizeof(entry_t), offsetof(entry_t, key), sizeof(uint32_t), NULL, NULL);
+    MYUNIT_ASSERT_TRUE(swissmap_reserve(&map, 1000));
+
+    key = 0;
+    first = swissmap_insert(&map, &key, NULL);
+
+    for (key = 1; key < 1000; key++)
+    {
+        swissmap_insert(&map, &key, NULL);
+    }
+
+    key = 0;
+    MYUNIT_ASSERT_EQUAL(swissmap_find(&map, &key), first);
+
+    swissmap_clear(&map);
+    MYUNIT_ASSERT_IS_NULL(swissmap_find(&map, &key));
+    MYUNIT_ASSERT_TRUE(overflow_all_zero());
+
+    swissmap_free(&map);
+    MYUNIT_ASSERT_IS_NULL(swissmap_find(&map, &key));
+}
+
+void myunit_testsuite_setup()
+{
+
+}
+
+void myunit_testsuite_teardown()
+{
+
+}
+
+MYUNIT_TESTSUITE(swissmap)
+{
+    MYUNIT_TESTSUITE_BEGIN();
+
+    MYUNIT_EXEC_TESTCASE(swissmap_default_hash);
+    MYUNIT_EXEC_TESTCASE(swissmap_user_callbacks);
+    MYUNIT_EXEC_TESTCASE(swissmap_colliding_hashes);
+    MYUNIT_EXEC_TESTCASE(swissmap_reserve_keeps_entries_in_place);
+
+    MYUNIT_TESTSUITE_END();
+}
@@ -0,0 +1,68 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#ifndef MYUNIT_TSLIST_H_
+#define MYUNIT_TSLIST_H_
+
+
+#include "tslist.h"
+
+#define myunit_list_type tslist
+
+typedef tslist_t list_t;
+typedef slist_node_t list_node_t;
+
+#define list_next(list,node)                tslist_next(list,node)
+#define list_prev(list,node)                tslist_prev(list,node)
+#define list_prev_prev(list,node)           tslist_prev_prev(list,node)
+#define list_init(list)                     tslist_init(list)
+#define list_begin(list)                    tslist_begin(list)
+#define list_front(list)                    tslist_front(list)
+#define list_end(list)                      tslist_end(list)
+#define list_back(list)                     tslist_back(list)
+#define list_foreach(list,it)               tslist_foreach(list,it)
+#define list_foreach_prev(list,prev,it)     tslist_foreach_prev(list,prev,it)
+#define list_empty(list)                    tslist_empty(list)
+#define list_push_front(list,node)          tslist_push_front(list,node)
+#define list_pop_front(list)                tslist_pop_front(list)
+#define list_push_back(list,node)           tslist_push_back(list,node)
+#define list_pop_back(list)                 tslist_pop_back(list)
+#define list_insert_after(list,pos,node)    tslist_insert_after(list,pos,node)
+#define list_insert_before(list,pos,node)   tslist_insert_before(list,pos,node)
+#define list_erase(list,node)               tslist_erase(list,node)
+#define list_erase_safe(list,node)          tslist_erase_safe(list,node)
+#define list_node_init(node)                slist_node_init(node)
+#define list_node_is_linked(node)           slist_node_is_linked(node)
+#define list_erase_after(list,pos)          tslist_erase_after(list,pos)
+#define list_size(list)                     tslist_size(list)
+#define list_find(list,node)                tslist_find(list,node)
+#define list_splice_back(list,other)        tslist_splice(list,tslist_back(list),other)
+#define list_cut(list,node,other)           tslist_cut_after(list,tslist_prev(list,node),other)
+
+
+#endif /* MYUNIT_TSLIST_H_ */
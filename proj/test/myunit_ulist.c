@@ -0,0 +1,259 @@
+/*!
+    Copyright (c) 2025, Marco Bacchi <marco@bacchi.at>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#include "myunit.h"
+#include <stdint.h>
+#include "ulist.h"
+
+#define CAPACITY 4
+#define CHUNKS 40
+
+ULIST_TYPEDEF(values,uint16_t,CAPACITY,CHUNKS);
+
+ULIST_T(values) values;
+
+/* the reference contents */
+static uint16_t expected[CAPACITY * CHUNKS];
+static size_t expected_count;
+
+static void expected_insert(size_t index, uint16_t value)
+{
+    memmove(&expected[index + 1], &expected[index], (expected_count - index) * sizeof(expected[0]));
+    expected[index] = value;
+    expected_count++;
+}
+
+static void expected_erase(size_t index)
+{
+    expected_count--;
+    memmove(&expected[index], &expected[index + 1], (expected_count - index) * sizeof(expected[0]));
+}
+
+/* compares the list against the reference, no chunk may be empty */
+static bool ulist_check(ulist_t *list)
+{
+    ulist_iterator_t iterator;
+    dlist_node_t *chunk;
+    size_t index = 0;
+
+    if (ulist_size(list) != expected_count)
+    {
+        return false;
+    }
+
+    dlist_foreach(&list->chunks, chunk)
+    {
+        if (((ulist_chunk_t*)chunk)->count == 0 || ((ulist_chunk_t*)chunk)->count > CAPACITY)
+        {
+            return false;
+        }
+    }
+
+    ulist_foreach(list, iterator)
+    {
+        if (index >= expected_count || *(uint16_t*)ulist_item(list, iterator) != expected[index])
+        {
+            return false;
+        }
+
+        index++;
+    }
+
+    return index == expected_count;
+}
+
+/* moves an iterator to an index */
+static void ulist_seek(ulist_t *list, ulist_iterator_t *iterator, size_t index)
+{
+    ulist_begin(list, *iterator);
+
+    while (index--)
+    {
+        ulist_next(list, *iterator);
+    }
+}
+
+MYUNIT_TESTCASE(ulist_initialization)
+{
+    ulist_iterator_t iterator;
+
+    ULIST_INIT(values);
+    expected_count = 0;
+
+    MYUNIT_ASSERT_TRUE(ulist_empty(ULIST(values)));
+    MYUNIT_ASSERT_EQUAL(ULIST(values)->capacity, CAPACITY);
+    MYUNIT_ASSERT_EQUAL(ULIST(values)->item_size, sizeof(uint16_t));
+    MYUNIT_ASSERT_EQUAL(ULIST(values)->pool_size, CHUNKS);
+
+    ulist_begin(ULIST(values), iterator);
+    MYUNIT_ASSERT_TRUE(ulist_is_end(ULIST(values), iterator));
+    MYUNIT_ASSERT_TRUE(ulist_check(ULIST(values)));
+}
+
+/* appending fills every chunk up to its capacity */
+MYUNIT_TESTCASE(ulist_push_back_dense)
+{
+    uint16_t value;
+
+    ULIST_INIT(values);
+    expected_count = 0;
+
+    for (value = 0; value < CAPACITY * CHUNKS; value++)
+    {
+        uint16_t *item = ulist_push_back(ULIST(values), &value);
+
+        MYUNIT_ASSERT_NOT_NULL(item);
+        MYUNIT_ASSERT_EQUAL(*item, value);
+        expected_insert(expected_count, value);
+    }
+
+    MYUNIT_ASSERT_TRUE(ulist_check(ULIST(values)));
+    MYUNIT_ASSERT_EQUAL(dlist_size(&ULIST(values)->chunks), CHUNKS);
+
+    /* the pool is exhausted */
+    MYUNIT_ASSERT_IS_NULL(ulist_push_back(ULIST(values), &value));
+    MYUNIT_ASSERT_TRUE(ulist_check(ULIST(values)));
+
+    /* cleared chunks are handed out again until the pool is exhausted anew */
+    ulist_clear(ULIST(values));
+    expected_count = 0;
+    MYUNIT_ASSERT_TRUE(ulist_check(ULIST(values)));
+
+    for (value = 0; value < CAPACITY * CHUNKS; value++)
+    {
+        MYUNIT_ASSERT_NOT_NULL(ulist_push_back(ULIST(values), &value));
+        expected_insert(expected_count, value);
+    }
+
+    MYUNIT_ASSERT_TRUE(ulist_check(ULIST(values)));
+    MYUNIT_ASSERT_IS_NULL(ulist_push_back(ULIST(values), &value));
+}
+
+/* inserts at the front, the back and into full chunks, which splits them */
+MYUNIT_TESTCASE(ulist_insert)
+{
+    ulist_iterator_t iterator;
+    uint16_t value;
+
+    ULIST_INIT(values);
+    expected_count = 0;
+
+    for (value = 0; value < 20; value++)
+    {
+        ulist_push_back(ULIST(values), &value);
+        expected_insert(expected_count, value);
+    }
+
+    for (value = 100; value < 160; value++)
+    {
+        size_t index = (size_t)(value * 7) % (expected_count + 1);
+        uint16_t *item;
+
+        ulist_seek(ULIST(values), &iterator, index);
+        item = ulist_insert(ULIST(values), &iterator, &value);
+        expected_insert(index, value);
+
+        MYUNIT_ASSERT_NOT_NULL(item);
+        MYUNIT_ASSERT_EQUAL(ulist_item(ULIST(values), iterator), item);
+        MYUNIT_ASSERT_TRUE(ulist_check(ULIST(values)));
+    }
+
+    ulist_begin(ULIST(values), iterator);
+    value = 1000;
+    ulist_insert(ULIST(values), &iterator, &value);
+    expected_insert(0, value);
+    MYUNIT_ASSERT_TRUE(ulist_check(ULIST(values)));
+}
+
+/* erases while iterating, chunks are merged and freed on the way */
+MYUNIT_TESTCASE(ulist_erase)
+{
+    ulist_iterator_t iterator;
+    uint16_t value;
+    size_t index = 0;
+
+    ULIST_INIT(values);
+    expected_count = 0;
+
+    for (value = 0; value < 100; value++)
+    {
+        ulist_push_back(ULIST(values), &value);
+        expected_insert(expected_count, value);
+    }
+
+    ulist_begin(ULIST(values), iterator);
+
+    while (!ulist_is_end(ULIST(values), iterator))
+    {
+        if (*(uint16_t*)ulist_item(ULIST(values), iterator) % 3)
+        {
+            ulist_erase(ULIST(values), &iterator);
+            expected_erase(index);
+        }
+        else
+        {
+            ulist_next(ULIST(values), iterator);
+            index++;
+        }
+    }
+
+    MYUNIT_ASSERT_TRUE(ulist_check(ULIST(values)));
+    MYUNIT_ASSERT_TRUE(dlist_size(&ULIST(values)->chunks) <= 2 * ulist_size(ULIST(values)) / CAPACITY + 1);
+
+    while (!ulist_empty(ULIST(values)))
+    {
+        ulist_seek(ULIST(values), &iterator, ulist_size(ULIST(values)) / 2);
+        ulist_erase(ULIST(values), &iterator);
+        expected_erase(expected_count / 2);
+        MYUNIT_ASSERT_TRUE(ulist_check(ULIST(values)));
+    }
+
+    MYUNIT_ASSERT_TRUE(dlist_empty(&ULIST(values)->chunks));
+}
+
+void myunit_testsuite_setup()
+{
+
+}
+
+void myunit_testsuite_teardown()
+{
+
+}
+
+MYUNIT_TESTSUITE(ulist)
+{
+    MYUNIT_TESTSUITE_BEGIN();
+
+    MYUNIT_EXEC_TESTCASE(ulist_initialization);
+    MYUNIT_EXEC_TESTCASE(ulist_push_back_dense);
+    MYUNIT_EXEC_TESTCASE(ulist_insert);
+    MYUNIT_EXEC_TESTCASE(ulist_erase);
+
+    MYUNIT_TESTSUITE_END();
+}